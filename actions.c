@@ -13,9 +13,9 @@
 #include "dungeon.h"
 #include <inttypes.h>
 
-static int fill(verb_t, obj_t);
+static int fill(struct session_t*, verb_t, obj_t);
 
-static int attack(command_t command)
+static int attack(struct session_t* session, command_t command)
 /*  Attack.  Assume target if unambiguous.  "Throw" also links here.
  *  Attackable objects fall into two categories: enemies (snake,
  *  dwarf, etc.)  and others (bird, clam, machine).  Ambiguous if 2
@@ -26,7 +26,7 @@ static int attack(command_t command)
 
     if (obj == INTRANSITIVE) {
         int changes = 0;
-        if (atdwrf(game.loc) > 0) {
+        if (atdwrf(session, session->game.loc) > 0) {
             obj = DWARF;
             ++changes;
         }
@@ -34,7 +34,7 @@ static int attack(command_t command)
             obj = SNAKE;
             ++changes;
         }
-        if (AT(DRAGON) && game.prop[DRAGON] == DRAGON_BARS) {
+        if (AT(DRAGON) && session->game.prop[DRAGON] == DRAGON_BARS) {
             obj = DRAGON;
             ++changes;
         }
@@ -46,7 +46,7 @@ static int attack(command_t command)
             obj = OGRE;
             ++changes;
         }
-        if (HERE(BEAR) && game.prop[BEAR] == UNTAMED_BEAR) {
+        if (HERE(BEAR) && session->game.prop[BEAR] == UNTAMED_BEAR) {
             obj = BEAR;
             ++changes;
         }
@@ -73,84 +73,84 @@ static int attack(command_t command)
     }
 
     if (obj == BIRD) {
-        if (game.closed) {
-            rspeak(UNHAPPY_BIRD);
+        if (session->game.closed) {
+            rspeak(session, UNHAPPY_BIRD);
         } else {
             DESTROY(BIRD);
-            rspeak(BIRD_DEAD);
+            rspeak(session, BIRD_DEAD);
         }
         return GO_CLEAROBJ;
     }
     if (obj == VEND) {
-        state_change(VEND,
-                     game.prop[VEND] == VEND_BLOCKS ? VEND_UNBLOCKS : VEND_BLOCKS);
+        state_change(session, VEND,
+                     session->game.prop[VEND] == VEND_BLOCKS ? VEND_UNBLOCKS : VEND_BLOCKS);
         return GO_CLEAROBJ;
     }
 
     if (obj == BEAR) {
-        switch (game.prop[BEAR]) {
+        switch (session->game.prop[BEAR]) {
         case UNTAMED_BEAR:
-            rspeak(BEAR_HANDS);
+            rspeak(session, BEAR_HANDS);
             break;
         case SITTING_BEAR:
-            rspeak(BEAR_CONFUSED);
+            rspeak(session, BEAR_CONFUSED);
             break;
         case CONTENTED_BEAR:
-            rspeak(BEAR_CONFUSED);
+            rspeak(session, BEAR_CONFUSED);
             break;
         case BEAR_DEAD:
-            rspeak(ALREADY_DEAD);
+            rspeak(session, ALREADY_DEAD);
             break;
         }
         return GO_CLEAROBJ;
     }
-    if (obj == DRAGON && game.prop[DRAGON] == DRAGON_BARS) {
+    if (obj == DRAGON && session->game.prop[DRAGON] == DRAGON_BARS) {
         /*  Fun stuff for dragon.  If he insists on attacking it, win!
          *  Set game.prop to dead, move dragon to central loc (still
          *  fixed), move rug there (not fixed), and move him there,
          *  too.  Then do a null motion to get new description. */
-        rspeak(BARE_HANDS_QUERY);
-        if (!silent_yes()) {
-            speak(arbitrary_messages[NASTY_DRAGON]);
+        rspeak(session, BARE_HANDS_QUERY);
+        if (!silent_yes(session)) {
+            speak(session, arbitrary_messages[NASTY_DRAGON]);
             return GO_MOVE;
         }
-        state_change(DRAGON, DRAGON_DEAD);
-        game.prop[RUG] = RUG_FLOOR;
+        state_change(session, DRAGON, DRAGON_DEAD);
+        SETPROP(RUG, RUG_FLOOR);
         /* Hardcoding LOC_SECRET5 as the dragon's death location is ugly.
          * The way it was computed before was worse; it depended on the
          * two dragon locations being LOC_SECRET4 and LOC_SECRET6 and
          * LOC_SECRET5 being right between them.
          */
-        move(DRAGON + NOBJECTS, IS_FIXED);
-        move(RUG + NOBJECTS, IS_FREE);
-        move(DRAGON, LOC_SECRET5);
-        move(RUG, LOC_SECRET5);
-        drop(BLOOD, LOC_SECRET5);
+        move(session, DRAGON + NOBJECTS, IS_FIXED);
+        move(session, RUG + NOBJECTS, IS_FREE);
+        move(session, DRAGON, LOC_SECRET5);
+        move(session, RUG, LOC_SECRET5);
+        drop(session, BLOOD, LOC_SECRET5);
         for (obj_t i = 1; i <= NOBJECTS; i++) {
-            if (game.place[i] == objects[DRAGON].plac ||
-                game.place[i] == objects[DRAGON].fixd)
-                move(i, LOC_SECRET5);
+            if (session->game.place[i] == object_plac[DRAGON] ||
+                session->game.place[i] == object_fixd[DRAGON])
+                move(session, i, LOC_SECRET5);
         }
-        game.loc = LOC_SECRET5;
+        session->game.loc = LOC_SECRET5;
         return GO_MOVE;
     }
 
     if (obj == OGRE) {
-        rspeak(OGRE_DODGE);
-        if (atdwrf(game.loc) == 0)
+        rspeak(session, OGRE_DODGE);
+        if (atdwrf(session, session->game.loc) == 0)
             return GO_CLEAROBJ;
 
-        rspeak(KNIFE_THROWN);
+        rspeak(session, KNIFE_THROWN);
         DESTROY(OGRE);
         int dwarves = 0;
         for (int i = 1; i < PIRATE; i++) {
-            if (game.dloc[i] == game.loc) {
+            if (session->game.dloc[i] == session->game.loc) {
                 ++dwarves;
-                game.dloc[i] = LOC_LONGWEST;
-                game.dseen[i] = false;
+                session->game.dloc[i] = LOC_LONGWEST;
+                session->game.dseen[i] = false;
             }
         }
-        rspeak((dwarves > 1) ?
+        rspeak(session, (dwarves > 1) ?
                OGRE_PANIC1 :
                OGRE_PANIC2);
         return GO_CLEAROBJ;
@@ -158,192 +158,193 @@ static int attack(command_t command)
 
     switch (obj) {
     case INTRANSITIVE:
-        rspeak(NO_TARGET);
+        rspeak(session, NO_TARGET);
         break;
     case CLAM:
     case OYSTER:
-        rspeak(SHELL_IMPERVIOUS);
+        rspeak(session, SHELL_IMPERVIOUS);
         break;
     case SNAKE:
-        rspeak(SNAKE_WARNING);
+        rspeak(session, SNAKE_WARNING);
         break;
     case DWARF:
-        if (game.closed) {
+        if (session->game.closed) {
             return GO_DWARFWAKE;
         }
-        rspeak(BARE_HANDS_QUERY);
+        rspeak(session, BARE_HANDS_QUERY);
         break;
     case DRAGON:
-        rspeak(ALREADY_DEAD);
+        rspeak(session, ALREADY_DEAD);
         break;
     case TROLL:
-        rspeak(ROCKY_TROLL);
+        rspeak(session, ROCKY_TROLL);
         break;
     default:
-        speak(actions[verb].message);
+        speak(session, actions[verb].message);
     }
     return GO_CLEAROBJ;
 }
 
-static int bigwords(vocab_t id)
+static int bigwords(struct session_t* session, vocab_t id)
 /*  FEE FIE FOE FOO (AND FUM).  Advance to next state if given in proper order.
  *  Look up foo in special section of vocab to determine which word we've got.
  *  Last word zips the eggs back to the giant room (unless already there). */
 {
-    if ((game.foobar == WORD_EMPTY && id == FEE) ||
-        (game.foobar == FEE && id == FIE) ||
-        (game.foobar == FIE && id == FOE) ||
-        (game.foobar == FOE && id == FOO) ||
-        (game.foobar == FOE && id == FUM)) {
-        game.foobar = id;
+    if ((session->game.foobar == WORD_EMPTY && id == FEE) ||
+        (session->game.foobar == FEE && id == FIE) ||
+        (session->game.foobar == FIE && id == FOE) ||
+        (session->game.foobar == FOE && id == FOO) ||
+        (session->game.foobar == FOE && id == FUM)) {
+        session->game.foobar = id;
         if ((id != FOO) && (id != FUM)) {
-            rspeak(OK_MAN);
+            rspeak(session, OK_MAN);
             return GO_CLEAROBJ;
         }
-        game.foobar = WORD_EMPTY;
-        if (game.place[EGGS] == objects[EGGS].plac ||
-            (TOTING(EGGS) && game.loc == objects[EGGS].plac)) {
-            rspeak(NOTHING_HAPPENS);
+        session->game.foobar = WORD_EMPTY;
+        if (session->game.place[EGGS] == object_plac[EGGS] ||
+            (TOTING(EGGS) && session->game.loc == object_plac[EGGS])) {
+            rspeak(session, NOTHING_HAPPENS);
             return GO_CLEAROBJ;
         } else {
             /*  Bring back troll if we steal the eggs back from him before
              *  crossing. */
-            if (game.place[EGGS] == LOC_NOWHERE && game.place[TROLL] == LOC_NOWHERE && game.prop[TROLL] == TROLL_UNPAID)
-                game.prop[TROLL] = TROLL_PAIDONCE;
+            if (session->game.place[EGGS] == LOC_NOWHERE && session->game.place[TROLL] == LOC_NOWHERE && session->game.prop[TROLL] == TROLL_UNPAID)
+                SETPROP(TROLL, TROLL_PAIDONCE);
             if (HERE(EGGS))
-                pspeak(EGGS, look, EGGS_VANISHED, true);
-            else if (game.loc == objects[EGGS].plac)
-                pspeak(EGGS, look, EGGS_HERE, true);
+                pspeak(session, EGGS, look, EGGS_VANISHED, true);
+            else if (session->game.loc == object_plac[EGGS])
+                pspeak(session, EGGS, look, EGGS_HERE, true);
             else
-                pspeak(EGGS, look, EGGS_DONE, true);
-            move(EGGS, objects[EGGS].plac);
+                pspeak(session, EGGS, look, EGGS_DONE, true);
+            move(session, EGGS, object_plac[EGGS]);
 
             return GO_CLEAROBJ;
         }
     } else {
-        if (game.loc == LOC_GIANTROOM) {
-            rspeak(START_OVER);
+        if (session->game.loc == LOC_GIANTROOM) {
+            rspeak(session, START_OVER);
         } else {
             /* This is new begavior in Open Adventure - sounds better when
              * player isn't in the Giant Room. */
-            rspeak(WELL_POINTLESS);
+            rspeak(session, WELL_POINTLESS);
         }
-        game.foobar = WORD_EMPTY;
+        session->game.foobar = WORD_EMPTY;
         return GO_CLEAROBJ;
     }
 }
 
-static void blast(void)
+static void blast(struct session_t* session)
 /*  Blast.  No effect unless you've got dynamite, which is a neat trick! */
 {
-    if (game.prop[ROD2] == STATE_NOTFOUND ||
-        !game.closed)
-        rspeak(REQUIRES_DYNAMITE);
+    if (session->game.prop[ROD2] == STATE_NOTFOUND ||
+        !session->game.closed)
+        rspeak(session, REQUIRES_DYNAMITE);
     else {
         if (HERE(ROD2)) {
-            game.bonus = splatter;
-            rspeak(SPLATTER_MESSAGE);
-        } else if (game.loc == LOC_NE) {
-            game.bonus = defeat;
-            rspeak(DEFEAT_MESSAGE);
+            session->game.bonus = splatter;
+            rspeak(session, SPLATTER_MESSAGE);
+        } else if (session->game.loc == LOC_NE) {
+            session->game.bonus = defeat;
+            rspeak(session, DEFEAT_MESSAGE);
         } else {
-            game.bonus = victory;
-            rspeak(VICTORY_MESSAGE);
+            session->game.bonus = victory;
+            rspeak(session, VICTORY_MESSAGE);
         }
-        terminate(endgame);
+        rescore_flags(session);
+        terminate(session, endgame);
     }
 }
 
-static int vbreak(verb_t verb, obj_t obj)
+static int vbreak(struct session_t* session, verb_t verb, obj_t obj)
 /*  Break.  Only works for mirror in repository and, of course, the vase. */
 {
     switch (obj) {
     case MIRROR:
-        if (game.closed) {
-            state_change(MIRROR, MIRROR_BROKEN);
+        if (session->game.closed) {
+            state_change(session, MIRROR, MIRROR_BROKEN);
             return GO_DWARFWAKE;
         } else {
-            rspeak(TOO_FAR);
+            rspeak(session, TOO_FAR);
             break;
         }
     case VASE:
-        if (game.prop[VASE] == VASE_WHOLE) {
+        if (session->game.prop[VASE] == VASE_WHOLE) {
             if (TOTING(VASE))
-                drop(VASE, game.loc);
-            state_change(VASE, VASE_BROKEN);
-            game.fixed[VASE] = IS_FIXED;
+                drop(session, VASE, session->game.loc);
+            state_change(session, VASE, VASE_BROKEN);
+            SETFIXED(VASE, IS_FIXED);
             break;
         }
     /* FALLTHRU */
     default:
-        speak(actions[verb].message);
+        speak(session, actions[verb].message);
     }
     return (GO_CLEAROBJ);
 }
 
-static int brief(void)
+static int brief(struct session_t* session)
 /*  Brief.  Intransitive only.  Suppress full descriptions after first time. */
 {
-    game.abbnum = 10000;
-    game.detail = 3;
-    rspeak(BRIEF_CONFIRM);
+    session->game.abbnum = 10000;
+    session->game.detail = 3;
+    rspeak(session, BRIEF_CONFIRM);
     return GO_CLEAROBJ;
 }
 
-static int vcarry(verb_t verb, obj_t obj)
+static int vcarry(struct session_t* session, verb_t verb, obj_t obj)
 /*  Carry an object.  Special cases for bird and cage (if bird in cage, can't
  *  take one without the other).  Liquids also special, since they depend on
  *  status of bottle.  Also various side effects, etc. */
 {
     if (obj == INTRANSITIVE) {
         /*  Carry, no object given yet.  OK if only one object present. */
-        if (game.atloc[game.loc] == NO_OBJECT ||
-            game.link[game.atloc[game.loc]] != 0 ||
-            atdwrf(game.loc) > 0)
+        if (session->game.atloc[session->game.loc] == NO_OBJECT ||
+            session->game.link[session->game.atloc[session->game.loc]] != 0 ||
+            atdwrf(session, session->game.loc) > 0)
             return GO_UNKNOWN;
-        obj = game.atloc[game.loc];
+        obj = session->game.atloc[session->game.loc];
     }
 
     if (TOTING(obj)) {
-        speak(actions[verb].message);
+        speak(session, actions[verb].message);
         return GO_CLEAROBJ;
     }
 
     if (obj == MESSAG) {
-        rspeak(REMOVE_MESSAGE);
+        rspeak(session, REMOVE_MESSAGE);
         DESTROY(MESSAG);
         return GO_CLEAROBJ;
     }
 
-    if (game.fixed[obj] != IS_FREE) {
+    if (session->game.fixed[obj] != IS_FREE) {
         switch (obj) {
         case PLANT:
             /* Next guard tests whether plant is tiny or stashed */
-            rspeak(game.prop[PLANT] <= PLANT_THIRSTY ? DEEP_ROOTS : YOU_JOKING);
+            rspeak(session, session->game.prop[PLANT] <= PLANT_THIRSTY ? DEEP_ROOTS : YOU_JOKING);
             break;
         case BEAR:
-            rspeak( game.prop[BEAR] == SITTING_BEAR ? BEAR_CHAINED : YOU_JOKING);
+            rspeak(session,  session->game.prop[BEAR] == SITTING_BEAR ? BEAR_CHAINED : YOU_JOKING);
             break;
         case CHAIN:
-            rspeak( game.prop[BEAR] != UNTAMED_BEAR ? STILL_LOCKED : YOU_JOKING);
+            rspeak(session,  session->game.prop[BEAR] != UNTAMED_BEAR ? STILL_LOCKED : YOU_JOKING);
             break;
         case RUG:
-            rspeak(game.prop[RUG] == RUG_HOVER ? RUG_HOVERS : YOU_JOKING);
+            rspeak(session, session->game.prop[RUG] == RUG_HOVER ? RUG_HOVERS : YOU_JOKING);
             break;
         case URN:
-            rspeak(URN_NOBUDGE);
+            rspeak(session, URN_NOBUDGE);
             break;
         case CAVITY:
-            rspeak(DOUGHNUT_HOLES);
+            rspeak(session, DOUGHNUT_HOLES);
             break;
         case BLOOD:
-            rspeak(FEW_DROPS);
+            rspeak(session, FEW_DROPS);
             break;
         case SIGN:
-            rspeak(HAND_PASSTHROUGH);
+            rspeak(session, HAND_PASSTHROUGH);
             break;
         default:
-            rspeak(YOU_JOKING);
+            rspeak(session, YOU_JOKING);
         }
         return GO_CLEAROBJ;
     }
@@ -353,113 +354,113 @@ static int vcarry(verb_t verb, obj_t obj)
         if (!HERE(BOTTLE) ||
             LIQUID() != obj) {
             if (!TOTING(BOTTLE)) {
-                rspeak(NO_CONTAINER);
+                rspeak(session, NO_CONTAINER);
                 return GO_CLEAROBJ;
             }
-            if (game.prop[BOTTLE] == EMPTY_BOTTLE) {
-                return (fill(verb, BOTTLE));
+            if (session->game.prop[BOTTLE] == EMPTY_BOTTLE) {
+                return (fill(session, verb, BOTTLE));
             } else
-                rspeak(BOTTLE_FULL);
+                rspeak(session, BOTTLE_FULL);
             return GO_CLEAROBJ;
         }
         obj = BOTTLE;
     }
 
-    if (game.holdng >= INVLIMIT) {
-        rspeak(CARRY_LIMIT);
+    if (session->game.holdng >= INVLIMIT) {
+        rspeak(session, CARRY_LIMIT);
         return GO_CLEAROBJ;
 
     }
 
-    if (obj == BIRD && game.prop[BIRD] != BIRD_CAGED && STASHED(BIRD) != BIRD_CAGED) {
-        if (game.prop[BIRD] == BIRD_FOREST_UNCAGED) {
+    if (obj == BIRD && session->game.prop[BIRD] != BIRD_CAGED && STASHED(BIRD) != BIRD_CAGED) {
+        if (session->game.prop[BIRD] == BIRD_FOREST_UNCAGED) {
             DESTROY(BIRD);
-            rspeak(BIRD_CRAP);
+            rspeak(session, BIRD_CRAP);
             return GO_CLEAROBJ;
         }
         if (!TOTING(CAGE)) {
-            rspeak(CANNOT_CARRY);
+            rspeak(session, CANNOT_CARRY);
             return GO_CLEAROBJ;
         }
         if (TOTING(ROD)) {
-            rspeak(BIRD_EVADES);
+            rspeak(session, BIRD_EVADES);
             return GO_CLEAROBJ;
         }
-        game.prop[BIRD] = BIRD_CAGED;
+        SETPROP(BIRD, BIRD_CAGED);
     }
     if ((obj == BIRD ||
          obj == CAGE) &&
-        (game.prop[BIRD] == BIRD_CAGED || STASHED(BIRD) == BIRD_CAGED)) {
+        (session->game.prop[BIRD] == BIRD_CAGED || STASHED(BIRD) == BIRD_CAGED)) {
         /* expression maps BIRD to CAGE and CAGE to BIRD */
-        carry(BIRD + CAGE - obj, game.loc);
+        carry(session, BIRD + CAGE - obj, session->game.loc);
     }
 
-    carry(obj, game.loc);
+    carry(session, obj, session->game.loc);
 
     if (obj == BOTTLE && LIQUID() != NO_OBJECT)
-        game.place[LIQUID()] = CARRIED;
+        SETPLACE(LIQUID(), CARRIED);
 
-    if (GSTONE(obj) && game.prop[obj] != STATE_FOUND) {
-        game.prop[obj] = STATE_FOUND;
-        game.prop[CAVITY] = CAVITY_EMPTY;
+    if (GSTONE(obj) && session->game.prop[obj] != STATE_FOUND) {
+        SETPROP(obj, STATE_FOUND);
+        SETPROP(CAVITY, CAVITY_EMPTY);
     }
-    rspeak(OK_MAN);
+    rspeak(session, OK_MAN);
     return GO_CLEAROBJ;
 }
 
-static int chain(verb_t verb)
+static int chain(struct session_t* session, verb_t verb)
 /* Do something to the bear's chain */
 {
     if (verb != LOCK) {
-        if (game.prop[BEAR] == UNTAMED_BEAR) {
-            rspeak(BEAR_BLOCKS);
+        if (session->game.prop[BEAR] == UNTAMED_BEAR) {
+            rspeak(session, BEAR_BLOCKS);
             return GO_CLEAROBJ;
         }
-        if (game.prop[CHAIN] == CHAIN_HEAP) {
-            rspeak(ALREADY_UNLOCKED);
+        if (session->game.prop[CHAIN] == CHAIN_HEAP) {
+            rspeak(session, ALREADY_UNLOCKED);
             return GO_CLEAROBJ;
         }
-        game.prop[CHAIN] = CHAIN_HEAP;
-        game.fixed[CHAIN] = IS_FREE;
-        if (game.prop[BEAR] != BEAR_DEAD)
-            game.prop[BEAR] = CONTENTED_BEAR;
+        SETPROP(CHAIN, CHAIN_HEAP);
+        SETFIXED(CHAIN, IS_FREE);
+        if (session->game.prop[BEAR] != BEAR_DEAD)
+            SETPROP(BEAR, CONTENTED_BEAR);
 
-        switch (game.prop[BEAR]) {
+        switch (session->game.prop[BEAR]) {
         // LCOV_EXCL_START
         case BEAR_DEAD:
             /* Can't be reached until the bear can die in some way other
              * than a bridge collapse. Leave in in case this changes, but
              * exclude from coverage testing. */
-            game.fixed[BEAR] = IS_FIXED;
+            SETFIXED(BEAR, IS_FIXED);
             break;
         // LCOV_EXCL_STOP
         default:
-            game.fixed[BEAR] = IS_FREE;
+            SETFIXED(BEAR, IS_FREE);
         }
-        rspeak(CHAIN_UNLOCKED);
+        rspeak(session, CHAIN_UNLOCKED);
         return GO_CLEAROBJ;
     }
 
-    if (game.prop[CHAIN] != CHAIN_HEAP) {
-        rspeak(ALREADY_LOCKED);
+    if (session->game.prop[CHAIN] != CHAIN_HEAP) {
+        rspeak(session, ALREADY_LOCKED);
         return GO_CLEAROBJ;
     }
-    if (game.loc != objects[CHAIN].plac) {
-        rspeak(NO_LOCKSITE);
+    if (session->game.loc != object_plac[CHAIN]) {
+        rspeak(session, NO_LOCKSITE);
         return GO_CLEAROBJ;
     }
 
-    game.prop[CHAIN] = CHAIN_FIXED;
+    SETPROP(CHAIN, CHAIN_FIXED);
 
     if (TOTING(CHAIN))
-        drop(CHAIN, game.loc);
-    game.fixed[CHAIN] = IS_FIXED;
+        drop(session, CHAIN, session->game.loc);
+    SETFIXED(CHAIN, IS_FIXED);
 
-    rspeak(CHAIN_LOCKED);
+    rspeak(session, CHAIN_LOCKED);
     return GO_CLEAROBJ;
 }
 
-static int discard(verb_t verb, obj_t obj)
+static int discard(struct session_t* session, verb_t verb, obj_t obj)
 /*  Discard object.  "Throw" also comes here for most objects.  Special cases for
  *  bird (might attack snake or dragon) and cage (might contain bird) and vase.
  *  Drop coins at vending machine for extra batteries. */
@@ -469,131 +470,131 @@ static int discard(verb_t verb, obj_t obj)
     }
 
     if (!TOTING(obj)) {
-        speak(actions[verb].message);
+        speak(session, actions[verb].message);
         return GO_CLEAROBJ;
     }
 
-    if (GSTONE(obj) && AT(CAVITY) && game.prop[CAVITY] != CAVITY_FULL) {
-        rspeak(GEM_FITS);
-        game.prop[obj] = STATE_IN_CAVITY;
-        game.prop[CAVITY] = CAVITY_FULL;
-        if (HERE(RUG) && ((obj == EMERALD && game.prop[RUG] != RUG_HOVER) ||
-                          (obj == RUBY && game.prop[RUG] == RUG_HOVER))) {
+    if (GSTONE(obj) && AT(CAVITY) && session->game.prop[CAVITY] != CAVITY_FULL) {
+        rspeak(session, GEM_FITS);
+        SETPROP(obj, STATE_IN_CAVITY);
+        SETPROP(CAVITY, CAVITY_FULL);
+        if (HERE(RUG) && ((obj == EMERALD && session->game.prop[RUG] != RUG_HOVER) ||
+                          (obj == RUBY && session->game.prop[RUG] == RUG_HOVER))) {
             if (obj == RUBY)
-                rspeak(RUG_SETTLES);
+                rspeak(session, RUG_SETTLES);
             else if (TOTING(RUG))
-                rspeak(RUG_WIGGLES);
+                rspeak(session, RUG_WIGGLES);
             else
-                rspeak(RUG_RISES);
+                rspeak(session, RUG_RISES);
             if (!TOTING(RUG) || obj == RUBY) {
-                int k = (game.prop[RUG] == RUG_HOVER) ? RUG_FLOOR : RUG_HOVER;
-                game.prop[RUG] = k;
+                int k = (session->game.prop[RUG] == RUG_HOVER) ? RUG_FLOOR : RUG_HOVER;
+                SETPROP(RUG, k);
                 if (k == RUG_HOVER)
-                    k = objects[SAPPH].plac;
-                move(RUG + NOBJECTS, k);
+                    k = object_plac[SAPPH];
+                move(session, RUG + NOBJECTS, k);
             }
         }
-        drop(obj, game.loc);
+        drop(session, obj, session->game.loc);
         return GO_CLEAROBJ;
     }
 
     if (obj == COINS && HERE(VEND)) {
         DESTROY(COINS);
-        drop(BATTERY, game.loc);
-        pspeak(BATTERY, look, FRESH_BATTERIES, true);
+        drop(session, BATTERY, session->game.loc);
+        pspeak(session, BATTERY, look, FRESH_BATTERIES, true);
         return GO_CLEAROBJ;
     }
 
     if (LIQUID() == obj)
         obj = BOTTLE;
     if (obj == BOTTLE && LIQUID() != NO_OBJECT) {
-        game.place[LIQUID()] = LOC_NOWHERE;
+        SETPLACE(LIQUID(), LOC_NOWHERE);
     }
 
     if (obj == BEAR && AT(TROLL)) {
-        state_change(TROLL, TROLL_GONE);
-        move(TROLL, LOC_NOWHERE);
-        move(TROLL + NOBJECTS, IS_FREE);
-        move(TROLL2, objects[TROLL].plac);
-        move(TROLL2 + NOBJECTS, objects[TROLL].fixd);
-        juggle(CHASM);
-        drop(obj, game.loc);
+        state_change(session, TROLL, TROLL_GONE);
+        move(session, TROLL, LOC_NOWHERE);
+        move(session, TROLL + NOBJECTS, IS_FREE);
+        move(session, TROLL2, object_plac[TROLL]);
+        move(session, TROLL2 + NOBJECTS, object_fixd[TROLL]);
+        juggle(session, CHASM);
+        drop(session, obj, session->game.loc);
         return GO_CLEAROBJ;
     }
 
     if (obj == VASE) {
-        if (game.loc != objects[PILLOW].plac) {
-            state_change(VASE, AT(PILLOW)
+        if (session->game.loc != object_plac[PILLOW]) {
+            state_change(session, VASE, AT(PILLOW)
                          ? VASE_WHOLE
                          : VASE_DROPPED);
-            if (game.prop[VASE] != VASE_WHOLE)
-                game.fixed[VASE] = IS_FIXED;
-            drop(obj, game.loc);
+            if (session->game.prop[VASE] != VASE_WHOLE)
+                SETFIXED(VASE, IS_FIXED);
+            drop(session, obj, session->game.loc);
             return GO_CLEAROBJ;
         }
     }
 
-    if (obj == CAGE && game.prop[BIRD] == BIRD_CAGED) {
-        drop(BIRD, game.loc);
+    if (obj == CAGE && session->game.prop[BIRD] == BIRD_CAGED) {
+        drop(session, BIRD, session->game.loc);
     }
 
     if (obj == BIRD) {
-        if (AT(DRAGON) && game.prop[DRAGON] == DRAGON_BARS) {
-            rspeak(BIRD_BURNT);
+        if (AT(DRAGON) && session->game.prop[DRAGON] == DRAGON_BARS) {
+            rspeak(session, BIRD_BURNT);
             DESTROY(BIRD);
             return GO_CLEAROBJ;
         }
         if (HERE(SNAKE)) {
-            rspeak(BIRD_ATTACKS);
-            if (game.closed)
+            rspeak(session, BIRD_ATTACKS);
+            if (session->game.closed)
                 return GO_DWARFWAKE;
             DESTROY(SNAKE);
             /* Set game.prop for use by travel options */
-            game.prop[SNAKE] = SNAKE_CHASED;
+            SETPROP(SNAKE, SNAKE_CHASED);
         } else
-            rspeak(OK_MAN);
+            rspeak(session, OK_MAN);
 
-        game.prop[BIRD] = FOREST(game.loc) ? BIRD_FOREST_UNCAGED : BIRD_UNCAGED;
-        drop(obj, game.loc);
+        SETPROP(BIRD, FOREST(session->game.loc) ? BIRD_FOREST_UNCAGED : BIRD_UNCAGED);
+        drop(session, obj, session->game.loc);
         return GO_CLEAROBJ;
     }
 
-    rspeak(OK_MAN);
-    drop(obj, game.loc);
+    rspeak(session, OK_MAN);
+    drop(session, obj, session->game.loc);
     return GO_CLEAROBJ;
 }
 
-static int drink(verb_t verb, obj_t obj)
+static int drink(struct session_t* session, verb_t verb, obj_t obj)
 /*  Drink.  If no object, assume water and look for it here.  If water is in
  *  the bottle, drink that, else must be at a water loc, so drink stream. */
 {
-    if (obj == INTRANSITIVE && LIQLOC(game.loc) != WATER &&
+    if (obj == INTRANSITIVE && LOCALE(liquid) != WATER &&
         (LIQUID() != WATER || !HERE(BOTTLE))) {
         return GO_UNKNOWN;
     }
 
     if (obj == BLOOD) {
         DESTROY(BLOOD);
-        state_change(DRAGON, DRAGON_BLOODLESS);
-        game.blooded = true;
+        state_change(session, DRAGON, DRAGON_BLOODLESS);
+        session->game.blooded = true;
         return GO_CLEAROBJ;
     }
 
     if (obj != INTRANSITIVE && obj != WATER) {
-        rspeak(RIDICULOUS_ATTEMPT);
+        rspeak(session, RIDICULOUS_ATTEMPT);
         return GO_CLEAROBJ;
     }
     if (LIQUID() == WATER && HERE(BOTTLE)) {
-        game.place[WATER] = LOC_NOWHERE;
-        state_change(BOTTLE, EMPTY_BOTTLE);
+        SETPLACE(WATER, LOC_NOWHERE);
+        state_change(session, BOTTLE, EMPTY_BOTTLE);
         return GO_CLEAROBJ;
     }
 
-    speak(actions[verb].message);
+    speak(session, actions[verb].message);
     return GO_CLEAROBJ;
 }
 
-static int eat(verb_t verb, obj_t obj)
+static int eat(struct session_t* session, verb_t verb, obj_t obj)
 /*  Eat.  Intransitive: assume food if present, else ask what.  Transitive: food
  *  ok, some things lose appetite, rest are ridiculous. */
 {
@@ -604,7 +605,7 @@ static int eat(verb_t verb, obj_t obj)
     /* FALLTHRU */
     case FOOD:
         DESTROY(FOOD);
-        rspeak(THANKS_DELICIOUS);
+        rspeak(session, THANKS_DELICIOUS);
         break;
     case BIRD:
     case SNAKE:
@@ -615,21 +616,21 @@ static int eat(verb_t verb, obj_t obj)
     case TROLL:
     case BEAR:
     case OGRE:
-        rspeak(LOST_APPETITE);
+        rspeak(session, LOST_APPETITE);
         break;
     default:
-        speak(actions[verb].message);
+        speak(session, actions[verb].message);
     }
     return GO_CLEAROBJ;
 }
 
-static int extinguish(verb_t verb, obj_t obj)
+static int extinguish(struct session_t* session, verb_t verb, obj_t obj)
 /* Extinguish.  Lamp, urn, dragon/volcano (nice try). */
 {
     if (obj == INTRANSITIVE) {
-        if (HERE(LAMP) && game.prop[LAMP] == LAMP_BRIGHT)
+        if (HERE(LAMP) && session->game.prop[LAMP] == LAMP_BRIGHT)
             obj = LAMP;
-        if (HERE(URN) && game.prop[URN] == URN_LIT)
+        if (HERE(URN) && session->game.prop[URN] == URN_LIT)
             obj = URN;
         if (obj == INTRANSITIVE)
             return GO_UNKNOWN;
@@ -637,257 +638,256 @@ static int extinguish(verb_t verb, obj_t obj)
 
     switch (obj) {
     case URN:
-        if (game.prop[URN] != URN_EMPTY) {
-            state_change(URN, URN_DARK);
+        if (session->game.prop[URN] != URN_EMPTY) {
+            state_change(session, URN, URN_DARK);
         } else {
-            pspeak(URN, change, URN_DARK, true);
+            pspeak(session, URN, change, URN_DARK, true);
         }
         break;
     case LAMP:
-        state_change(LAMP, LAMP_DARK);
-        rspeak(DARK(game.loc) ?
+        state_change(session, LAMP, LAMP_DARK);
+        rspeak(session, DARK(session->game.loc) ?
                PITCH_DARK :
                NO_MESSAGE);
         break;
     case DRAGON:
     case VOLCANO:
-        rspeak(BEYOND_POWER);
+        rspeak(session, BEYOND_POWER);
         break;
     default:
-        speak(actions[verb].message);
+        speak(session, actions[verb].message);
     }
     return GO_CLEAROBJ;
 }
 
-static int feed(verb_t verb, obj_t obj)
+static int feed(struct session_t* session, verb_t verb, obj_t obj)
 /*  Feed.  If bird, no seed.  Snake, dragon, troll: quip.  If dwarf, make him
  *  mad.  Bear, special. */
 {
     switch (obj) {
     case BIRD:
-        rspeak(BIRD_PINING);
+        rspeak(session, BIRD_PINING);
         break;
     case DRAGON:
-        if (game.prop[DRAGON] != DRAGON_BARS)
-            rspeak(RIDICULOUS_ATTEMPT);
+        if (session->game.prop[DRAGON] != DRAGON_BARS)
+            rspeak(session, RIDICULOUS_ATTEMPT);
         else
-            rspeak(NOTHING_EDIBLE);
+            rspeak(session, NOTHING_EDIBLE);
         break;
     case SNAKE:
-        if (!game.closed && HERE(BIRD)) {
+        if (!session->game.closed && HERE(BIRD)) {
             DESTROY(BIRD);
-            rspeak(BIRD_DEVOURED);
+            rspeak(session, BIRD_DEVOURED);
         } else
-            rspeak(NOTHING_EDIBLE);
+            rspeak(session, NOTHING_EDIBLE);
         break;
     case TROLL:
-        rspeak(TROLL_VICES);
+        rspeak(session, TROLL_VICES);
         break;
     case DWARF:
         if (HERE(FOOD)) {
-            game.dflag += 2;
-            rspeak(REALLY_MAD);
+            session->game.dflag += 2;
+            rspeak(session, REALLY_MAD);
         } else
-            speak(actions[verb].message);
+            speak(session, actions[verb].message);
         break;
     case BEAR:
-        if (game.prop[BEAR] == BEAR_DEAD) {
-            rspeak(RIDICULOUS_ATTEMPT);
+        if (session->game.prop[BEAR] == BEAR_DEAD) {
+            rspeak(session, RIDICULOUS_ATTEMPT);
             break;
         }
-        if (game.prop[BEAR] == UNTAMED_BEAR) {
+        if (session->game.prop[BEAR] == UNTAMED_BEAR) {
             if (HERE(FOOD)) {
                 DESTROY(FOOD);
-                game.fixed[AXE] = IS_FREE;
-                game.prop[AXE] = AXE_HERE;
-                state_change(BEAR, SITTING_BEAR);
+                SETFIXED(AXE, IS_FREE);
+                SETPROP(AXE, AXE_HERE);
+                state_change(session, BEAR, SITTING_BEAR);
             } else
-                rspeak(NOTHING_EDIBLE);
+                rspeak(session, NOTHING_EDIBLE);
             break;
         }
-        speak(actions[verb].message);
+        speak(session, actions[verb].message);
         break;
     case OGRE:
         if (HERE(FOOD))
-            rspeak(OGRE_FULL);
+            rspeak(session, OGRE_FULL);
         else
-            speak(actions[verb].message);
+            speak(session, actions[verb].message);
         break;
     default:
-        rspeak(AM_GAME);
+        rspeak(session, AM_GAME);
     }
     return GO_CLEAROBJ;
 }
 
-int fill(verb_t verb, obj_t obj)
+int fill(struct session_t* session, verb_t verb, obj_t obj)
 /*  Fill.  Bottle or urn must be empty, and liquid available.  (Vase
  *  is nasty.) */
 {
     if (obj == VASE) {
-        if (LIQLOC(game.loc) == NO_OBJECT) {
-            rspeak(FILL_INVALID);
+        if (LOCALE(liquid) == NO_OBJECT) {
+            rspeak(session, FILL_INVALID);
             return GO_CLEAROBJ;
         }
         if (!TOTING(VASE)) {
-            rspeak(ARENT_CARRYING);
+            rspeak(session, ARENT_CARRYING);
             return GO_CLEAROBJ;
         }
-        rspeak(SHATTER_VASE);
-        game.prop[VASE] = VASE_BROKEN;
-        game.fixed[VASE] = IS_FIXED;
-        drop(VASE, game.loc);
+        rspeak(session, SHATTER_VASE);
+        SETPROP(VASE, VASE_BROKEN);
+        SETFIXED(VASE, IS_FIXED);
+        drop(session, VASE, session->game.loc);
         return GO_CLEAROBJ;
     }
 
     if (obj == URN) {
-        if (game.prop[URN] != URN_EMPTY) {
-            rspeak(FULL_URN);
+        if (session->game.prop[URN] != URN_EMPTY) {
+            rspeak(session, FULL_URN);
             return GO_CLEAROBJ;
         }
         if (!HERE(BOTTLE)) {
-            rspeak(FILL_INVALID);
+            rspeak(session, FILL_INVALID);
             return GO_CLEAROBJ;
         }
         int k = LIQUID();
         switch (k) {
         case WATER:
-            game.prop[BOTTLE] = EMPTY_BOTTLE;
-            rspeak(WATER_URN);
+            SETPROP(BOTTLE, EMPTY_BOTTLE);
+            rspeak(session, WATER_URN);
             break;
         case OIL:
-            game.prop[URN] = URN_DARK;
-            game.prop[BOTTLE] = EMPTY_BOTTLE;
-            rspeak(OIL_URN);
+            SETPROP(URN, URN_DARK);
+            SETPROP(BOTTLE, EMPTY_BOTTLE);
+            rspeak(session, OIL_URN);
             break;
         case NO_OBJECT:
         default:
-            rspeak(FILL_INVALID);
+            rspeak(session, FILL_INVALID);
             return GO_CLEAROBJ;
         }
-        game.place[k] = LOC_NOWHERE;
+        SETPLACE(k, LOC_NOWHERE);
         return GO_CLEAROBJ;
     }
     if (obj != INTRANSITIVE && obj != BOTTLE) {
-        speak(actions[verb].message);
+        speak(session, actions[verb].message);
         return GO_CLEAROBJ;
     }
     if (obj == INTRANSITIVE && !HERE(BOTTLE))
         return GO_UNKNOWN;
 
-    if (HERE(URN) && game.prop[URN] != URN_EMPTY) {
-        rspeak(URN_NOPOUR);
+    if (HERE(URN) && session->game.prop[URN] != URN_EMPTY) {
+        rspeak(session, URN_NOPOUR);
         return GO_CLEAROBJ;
     }
     if (LIQUID() != NO_OBJECT) {
-        rspeak(BOTTLE_FULL);
+        rspeak(session, BOTTLE_FULL);
         return GO_CLEAROBJ;
     }
-    if (LIQLOC(game.loc) == NO_OBJECT) {
-        rspeak(NO_LIQUID);
+    if (LOCALE(liquid) == NO_OBJECT) {
+        rspeak(session, NO_LIQUID);
         return GO_CLEAROBJ;
     }
 
-    state_change(BOTTLE, (LIQLOC(game.loc) == OIL)
+    state_change(session, BOTTLE, (LOCALE(liquid) == OIL)
                  ? OIL_BOTTLE
                  : WATER_BOTTLE);
     if (TOTING(BOTTLE))
-        game.place[LIQUID()] = CARRIED;
+        SETPLACE(LIQUID(), CARRIED);
     return GO_CLEAROBJ;
 }
 
-static int find(verb_t verb, obj_t obj)
+static int find(struct session_t* session, verb_t verb, obj_t obj)
 /* Find.  Might be carrying it, or it might be here.  Else give caveat. */
 {
     if (TOTING(obj)) {
-        rspeak(ALREADY_CARRYING);
+        rspeak(session, ALREADY_CARRYING);
         return GO_CLEAROBJ;
     }
 
-    if (game.closed) {
-        rspeak(NEEDED_NEARBY);
+    if (session->game.closed) {
+        rspeak(session, NEEDED_NEARBY);
         return GO_CLEAROBJ;
     }
 
     if (AT(obj) ||
         (LIQUID() == obj && AT(BOTTLE)) ||
-        obj == LIQLOC(game.loc) ||
-        (obj == DWARF && atdwrf(game.loc) > 0)) {
-        rspeak(YOU_HAVEIT);
+        obj == LOCALE(liquid) ||
+        (obj == DWARF && atdwrf(session, session->game.loc) > 0)) {
+        rspeak(session, YOU_HAVEIT);
         return GO_CLEAROBJ;
     }
 
 
-    speak(actions[verb].message);
+    speak(session, actions[verb].message);
     return GO_CLEAROBJ;
 }
 
-static int fly(verb_t verb, obj_t obj)
+static int fly(struct session_t* session, verb_t verb, obj_t obj)
 /* Fly.  Snide remarks unless hovering rug is here. */
 {
     if (obj == INTRANSITIVE) {
         if (!HERE(RUG)) {
-            rspeak(FLAP_ARMS);
+            rspeak(session, FLAP_ARMS);
             return GO_CLEAROBJ;
         }
-        if (game.prop[RUG] != RUG_HOVER) {
-            rspeak(RUG_NOTHING2);
+        if (session->game.prop[RUG] != RUG_HOVER) {
+            rspeak(session, RUG_NOTHING2);
             return GO_CLEAROBJ;
         }
         obj = RUG;
     }
 
     if (obj != RUG) {
-        speak(actions[verb].message);
+        speak(session, actions[verb].message);
         return GO_CLEAROBJ;
     }
-    if (game.prop[RUG] != RUG_HOVER) {
-        rspeak(RUG_NOTHING1);
+    if (session->game.prop[RUG] != RUG_HOVER) {
+        rspeak(session, RUG_NOTHING1);
         return GO_CLEAROBJ;
     }
-    game.oldlc2 = game.oldloc;
-    game.oldloc = game.loc;
+    session->game.oldlc2 = session->game.oldloc;
+    session->game.oldloc = session->game.loc;
 
-    if (game.prop[SAPPH] == STATE_NOTFOUND) {
-        game.newloc = game.place[SAPPH];
-        rspeak(RUG_GOES);
+    if (session->game.prop[SAPPH] == STATE_NOTFOUND) {
+        session->game.newloc = session->game.place[SAPPH];
+        rspeak(session, RUG_GOES);
     } else {
-        game.newloc = LOC_CLIFF;
-        rspeak(RUG_RETURNS);
+        session->game.newloc = LOC_CLIFF;
+        rspeak(session, RUG_RETURNS);
     }
     return GO_TERMINATE;
 }
 
-static int inven(void)
+static int inven(struct session_t* session)
 /* Inventory. If object, treat same as find.  Else report on current burden. */
 {
     bool empty = true;
-    for (obj_t i = 1; i <= NOBJECTS; i++) {
-        if (i == BEAR ||
-            !TOTING(i))
+    for (obj_t i = next_object(CARRIED_SET, NO_OBJECT); i != NO_OBJECT; i = next_object(CARRIED_SET, i)) {
+        if (i == BEAR)
             continue;
         if (empty) {
-            rspeak(NOW_HOLDING);
+            rspeak(session, NOW_HOLDING);
             empty = false;
         }
-        pspeak(i, touch, -1, false);
+        pspeak(session, i, touch, -1, false);
     }
     if (TOTING(BEAR))
-        rspeak(TAME_BEAR);
+        rspeak(session, TAME_BEAR);
     if (empty)
-        rspeak(NO_CARRY);
+        rspeak(session, NO_CARRY);
     return GO_CLEAROBJ;
 }
 
-static int light(verb_t verb, obj_t obj)
+static int light(struct session_t* session, verb_t verb, obj_t obj)
 /*  Light.  Applicable only to lamp and urn. */
 {
     if (obj == INTRANSITIVE) {
         int selects = 0;
-        if (HERE(LAMP) && game.prop[LAMP] == LAMP_DARK && game.limit >= 0) {
+        if (HERE(LAMP) && session->game.prop[LAMP] == LAMP_DARK && session->game.limit >= 0) {
             obj = LAMP;
             selects++;
         }
-        if (HERE(URN) && game.prop[URN] == URN_DARK) {
+        if (HERE(URN) && session->game.prop[URN] == URN_DARK) {
             obj =  URN;
             selects++;
         }
@@ -897,59 +897,59 @@ static int light(verb_t verb, obj_t obj)
 
     switch (obj) {
     case URN:
-        state_change(URN, game.prop[URN] == URN_EMPTY ?
+        state_change(session, URN, session->game.prop[URN] == URN_EMPTY ?
                      URN_EMPTY :
                      URN_LIT);
         break;
     case LAMP:
-        if (game.limit < 0) {
-            rspeak(LAMP_OUT);
+        if (session->game.limit < 0) {
+            rspeak(session, LAMP_OUT);
             break;
         }
-        state_change(LAMP, LAMP_BRIGHT);
-        if (game.wzdark)
+        state_change(session, LAMP, LAMP_BRIGHT);
+        if (session->game.wzdark)
             return GO_TOP;
         break;
     default:
-        speak(actions[verb].message);
+        speak(session, actions[verb].message);
     }
     return GO_CLEAROBJ;
 }
 
-static int listen(void)
+static int listen(struct session_t* session)
 /*  Listen.  Intransitive only.  Print stuff based on object sound proprties. */
 {
-    vocab_t sound = locations[game.loc].sound;
+    vocab_t sound = location_sound[session->game.loc];
     if (sound != SILENT) {
-        rspeak(sound);
-        if (!locations[game.loc].loud)
-            rspeak(NO_MESSAGE);
+        rspeak(session, sound);
+        if (!location_loud[session->game.loc])
+            rspeak(session, NO_MESSAGE);
         return GO_CLEAROBJ;
     }
     for (obj_t i = 1; i <= NOBJECTS; i++) {
         if (!HERE(i) ||
-            objects[i].sounds[0] == NULL ||
-            game.prop[i] < 0)
+            LIST(objects[i].sounds, 0) == 0 ||
+            session->game.prop[i] < 0)
             continue;
-        int mi =  game.prop[i];
+        int mi =  session->game.prop[i];
         /* (ESR) Some unpleasant magic on object states here. Ideally
          * we'd have liked the bird to be a normal object that we can
          * use state_change() on; can't do it, because there are
          * actually two different series of per-state birdsounds
          * depending on whether player has drunk dragon's blood. */
         if (i == BIRD)
-            mi += 3 * game.blooded;
-        pspeak(i, hear, mi, true, game.zzword);
-        rspeak(NO_MESSAGE);
+            mi += 3 * session->game.blooded;
+        pspeak(session, i, hear, mi, true, session->game.zzword);
+        rspeak(session, NO_MESSAGE);
         if (i == BIRD && mi == BIRD_ENDSTATE)
             DESTROY(BIRD);
         return GO_CLEAROBJ;
     }
-    rspeak(ALL_SILENT);
+    rspeak(session, ALL_SILENT);
     return GO_CLEAROBJ;
 }
 
-static int lock(verb_t verb, obj_t obj)
+static int lock(struct session_t* session, verb_t verb, obj_t obj)
 /* Lock, unlock, no object given.  Assume various things if present. */
 {
     if (obj == INTRANSITIVE) {
@@ -964,7 +964,7 @@ static int lock(verb_t verb, obj_t obj)
         if (HERE(CHAIN))
             obj = CHAIN;
         if (obj == INTRANSITIVE) {
-            rspeak(NOTHING_LOCKED);
+            rspeak(session, NOTHING_LOCKED);
             return GO_CLEAROBJ;
         }
     }
@@ -975,64 +975,64 @@ static int lock(verb_t verb, obj_t obj)
     switch (obj) {
     case CHAIN:
         if (HERE(KEYS)) {
-            return chain(verb);
+            return chain(session, verb);
         } else
-            rspeak(NO_KEYS);
+            rspeak(session, NO_KEYS);
         break;
     case GRATE:
         if (HERE(KEYS)) {
-            if (game.closng) {
-                rspeak(EXIT_CLOSED);
-                if (!game.panic)
-                    game.clock2 = PANICTIME;
-                game.panic = true;
+            if (session->game.closng) {
+                rspeak(session, EXIT_CLOSED);
+                if (!session->game.panic)
+                    session->game.clock2 = PANICTIME;
+                session->game.panic = true;
             } else {
-                state_change(GRATE, (verb == LOCK) ?
+                state_change(session, GRATE, (verb == LOCK) ?
                              GRATE_CLOSED :
                              GRATE_OPEN);
             }
         } else
-            rspeak(NO_KEYS);
+            rspeak(session, NO_KEYS);
         break;
     case CLAM:
         if (verb == LOCK)
-            rspeak(HUH_MAN);
+            rspeak(session, HUH_MAN);
         else if (!TOTING(TRIDENT))
-            rspeak(CLAM_OPENER);
+            rspeak(session, CLAM_OPENER);
         else {
             DESTROY(CLAM);
-            drop(OYSTER, game.loc);
-            drop(PEARL, LOC_CULDESAC);
-            rspeak(PEARL_FALLS);
+            drop(session, OYSTER, session->game.loc);
+            drop(session, PEARL, LOC_CULDESAC);
+            rspeak(session, PEARL_FALLS);
         }
         break;
     case OYSTER:
         if (verb == LOCK)
-            rspeak(HUH_MAN);
+            rspeak(session, HUH_MAN);
         else if (TOTING(OYSTER))
-            rspeak(DROP_OYSTER);
+            rspeak(session, DROP_OYSTER);
         else if (!TOTING(TRIDENT))
-            rspeak(OYSTER_OPENER);
+            rspeak(session, OYSTER_OPENER);
         else
-            rspeak(OYSTER_OPENS);
+            rspeak(session, OYSTER_OPENS);
         break;
     case DOOR:
-        rspeak((game.prop[DOOR] == DOOR_UNRUSTED) ? OK_MAN : RUSTY_DOOR);
+        rspeak(session, (session->game.prop[DOOR] == DOOR_UNRUSTED) ? OK_MAN : RUSTY_DOOR);
         break;
     case CAGE:
-        rspeak( NO_LOCK);
+        rspeak(session,  NO_LOCK);
         break;
     case KEYS:
-        rspeak(CANNOT_UNLOCK);
+        rspeak(session, CANNOT_UNLOCK);
         break;
     default:
-        speak(actions[verb].message);
+        speak(session, actions[verb].message);
     }
 
     return GO_CLEAROBJ;
 }
 
-static int pour(verb_t verb, obj_t obj)
+static int pour(struct session_t* session, verb_t verb, obj_t obj)
 /*  Pour.  If no object, or object is bottle, assume contents of bottle.
  *  special tests for pouring water or oil on plant or rusty door. */
 {
@@ -1042,115 +1042,116 @@ static int pour(verb_t verb, obj_t obj)
     if (obj == NO_OBJECT)
         return GO_UNKNOWN;
     if (!TOTING(obj)) {
-        speak(actions[verb].message);
+        speak(session, actions[verb].message);
         return GO_CLEAROBJ;
     }
 
     if (obj != OIL && obj != WATER) {
-        rspeak(CANT_POUR);
+        rspeak(session, CANT_POUR);
         return GO_CLEAROBJ;
     }
-    if (HERE(URN) && game.prop[URN] == URN_EMPTY)
-        return fill(verb, URN);
-    game.prop[BOTTLE] = EMPTY_BOTTLE;
-    game.place[obj] = LOC_NOWHERE;
+    if (HERE(URN) && session->game.prop[URN] == URN_EMPTY)
+        return fill(session, verb, URN);
+    SETPROP(BOTTLE, EMPTY_BOTTLE);
+    SETPLACE(obj, LOC_NOWHERE);
     if (!(AT(PLANT) ||
           AT(DOOR))) {
-        rspeak(GROUND_WET);
+        rspeak(session, GROUND_WET);
         return GO_CLEAROBJ;
     }
     if (!AT(DOOR)) {
         if (obj == WATER) {
             /* cycle through the three plant states */
-            state_change(PLANT, MOD(game.prop[PLANT] + 1, 3));
-            game.prop[PLANT2] = game.prop[PLANT];
+            state_change(session, PLANT, MOD(session->game.prop[PLANT] + 1, 3));
+            SETPROP(PLANT2, session->game.prop[PLANT]);
             return GO_MOVE;
         } else {
-            rspeak(SHAKING_LEAVES);
+            rspeak(session, SHAKING_LEAVES);
             return GO_CLEAROBJ;
         }
     } else {
-        state_change(DOOR, (obj == OIL) ?
+        state_change(session, DOOR, (obj == OIL) ?
                      DOOR_UNRUSTED :
                      DOOR_RUSTED);
         return GO_CLEAROBJ;
     }
 }
 
-static int quit(void)
+static int quit(struct session_t* session)
 /*  Quit.  Intransitive only.  Verify intent and exit if that's what he wants. */
 {
-    if (yes(arbitrary_messages[REALLY_QUIT], arbitrary_messages[OK_MAN], arbitrary_messages[OK_MAN]))
-        terminate(quitgame);
+    if (yes(session, arbitrary_messages[REALLY_QUIT], arbitrary_messages[OK_MAN], arbitrary_messages[OK_MAN]))
+        terminate(session, quitgame);
     return GO_CLEAROBJ;
 }
 
-static int read(command_t command)
+static int read(struct session_t* session, command_t command)
 /*  Read.  Print stuff based on objtxt.  Oyster (?) is special case. */
 {
     if (command.obj == INTRANSITIVE) {
         command.obj = NO_OBJECT;
         for (int i = 1; i <= NOBJECTS; i++) {
-            if (HERE(i) && objects[i].texts[0] != NULL && game.prop[i] >= 0)
+            if (HERE(i) && LIST(objects[i].texts, 0) != 0 && session->game.prop[i] >= 0)
                 command.obj = command.obj * NOBJECTS + i;
         }
         if (command.obj > NOBJECTS ||
             command.obj == NO_OBJECT ||
-            DARK(game.loc))
+            DARK(session->game.loc))
             return GO_UNKNOWN;
     }
 
-    if (DARK(game.loc)) {
-        sspeak(NO_SEE, command.word[0].raw);
-    } else if (command.obj == OYSTER && !game.clshnt && game.closed) {
-        game.clshnt = yes(arbitrary_messages[CLUE_QUERY], arbitrary_messages[WAYOUT_CLUE], arbitrary_messages[OK_MAN]);
-    } else if (objects[command.obj].texts[0] == NULL ||
-               game.prop[command.obj] == STATE_NOTFOUND) {
-        speak(actions[command.verb].message);
+    if (DARK(session->game.loc)) {
+        sspeak(session, NO_SEE, command.word[0].raw);
+    } else if (command.obj == OYSTER && !session->game.clshnt && session->game.closed) {
+        session->game.clshnt = yes(session, arbitrary_messages[CLUE_QUERY], arbitrary_messages[WAYOUT_CLUE], arbitrary_messages[OK_MAN]);
+        rescore_flags(session);
+    } else if (LIST(objects[command.obj].texts, 0) == 0 ||
+               session->game.prop[command.obj] == STATE_NOTFOUND) {
+        speak(session, actions[command.verb].message);
     } else
-        pspeak(command.obj, study, game.prop[command.obj], true);
+        pspeak(session, command.obj, study, session->game.prop[command.obj], true);
     return GO_CLEAROBJ;
 }
 
-static int reservoir(void)
+static int reservoir(struct session_t* session)
 /*  Z'ZZZ (word gets recomputed at startup; different each game). */
 {
-    if (!AT(RESER) && game.loc != LOC_RESBOTTOM) {
-        rspeak(NOTHING_HAPPENS);
+    if (!AT(RESER) && session->game.loc != LOC_RESBOTTOM) {
+        rspeak(session, NOTHING_HAPPENS);
         return GO_CLEAROBJ;
     } else {
-        state_change(RESER,
-                     game.prop[RESER] == WATERS_PARTED ? WATERS_UNPARTED : WATERS_PARTED);
+        state_change(session, RESER,
+                     session->game.prop[RESER] == WATERS_PARTED ? WATERS_UNPARTED : WATERS_PARTED);
         if (AT(RESER))
             return GO_CLEAROBJ;
         else {
-            game.oldlc2 = game.loc;
-            game.newloc = LOC_NOWHERE;
-            rspeak(NOT_BRIGHT);
+            session->game.oldlc2 = session->game.loc;
+            session->game.newloc = LOC_NOWHERE;
+            rspeak(session, NOT_BRIGHT);
             return GO_TERMINATE;
         }
     }
 }
 
-static int rub(verb_t verb, obj_t obj)
+static int rub(struct session_t* session, verb_t verb, obj_t obj)
 /* Rub.  Yields various snide remarks except for lit urn. */
 {
-    if (obj == URN && game.prop[URN] == URN_LIT) {
+    if (obj == URN && session->game.prop[URN] == URN_LIT) {
         DESTROY(URN);
-        drop(AMBER, game.loc);
-        game.prop[AMBER] = AMBER_IN_ROCK;
-        --game.tally;
-        drop(CAVITY, game.loc);
-        rspeak(URN_GENIES);
+        drop(session, AMBER, session->game.loc);
+        SETPROP(AMBER, AMBER_IN_ROCK);
+        --session->game.tally;
+        drop(session, CAVITY, session->game.loc);
+        rspeak(session, URN_GENIES);
     } else if (obj != LAMP) {
-        rspeak(PECULIAR_NOTHING);
+        rspeak(session, PECULIAR_NOTHING);
     } else {
-        speak(actions[verb].message);
+        speak(session, actions[verb].message);
     }
     return GO_CLEAROBJ;
 }
 
-static int say(command_t command)
+static int say(struct session_t* session, command_t command)
 /* Say.  Echo WD2. Magic words override. */
 {
     if (command.word[1].type == MOTION &&
@@ -1160,7 +1161,7 @@ static int say(command_t command)
         return GO_WORD2;
     }
     if (command.word[1].type == ACTION && command.word[1].id == PART)
-        return reservoir();
+        return reservoir(session);
 
     if (command.word[1].type == ACTION &&
         (command.word[1].id == FEE ||
@@ -1169,158 +1170,158 @@ static int say(command_t command)
          command.word[1].id == FOO ||
          command.word[1].id == FUM ||
          command.word[1].id == PART)) {
-        return bigwords(command.word[1].id);
+        return bigwords(session, command.word[1].id);
     }
-    sspeak(OKEY_DOKEY, command.word[1].raw);
+    sspeak(session, OKEY_DOKEY, command.word[1].raw);
     return GO_CLEAROBJ;
 }
 
-static int throw_support(vocab_t spk)
+static int throw_support(struct session_t* session, vocab_t spk)
 {
-    rspeak(spk);
-    drop(AXE, game.loc);
+    rspeak(session, spk);
+    drop(session, AXE, session->game.loc);
     return GO_MOVE;
 }
 
-static int throw (command_t command)
+static int throw (struct session_t* session, command_t command)
 /*  Throw.  Same as discard unless axe.  Then same as attack except
  *  ignore bird, and if dwarf is present then one might be killed.
  *  (Only way to do so!)  Axe also special for dragon, bear, and
  *  troll.  Treasures special for troll. */
 {
     if (!TOTING(command.obj)) {
-        speak(actions[command.verb].message);
+        speak(session, actions[command.verb].message);
         return GO_CLEAROBJ;
     }
-    if (objects[command.obj].is_treasure && AT(TROLL)) {
+    if (object_treasure[command.obj] && AT(TROLL)) {
         /*  Snarf a treasure for the troll. */
-        drop(command.obj, LOC_NOWHERE);
-        move(TROLL, LOC_NOWHERE);
-        move(TROLL + NOBJECTS, IS_FREE);
-        drop(TROLL2, objects[TROLL].plac);
-        drop(TROLL2 + NOBJECTS, objects[TROLL].fixd);
-        juggle(CHASM);
-        rspeak(TROLL_SATISFIED);
+        drop(session, command.obj, LOC_NOWHERE);
+        move(session, TROLL, LOC_NOWHERE);
+        move(session, TROLL + NOBJECTS, IS_FREE);
+        drop(session, TROLL2, object_plac[TROLL]);
+        drop(session, TROLL2 + NOBJECTS, object_fixd[TROLL]);
+        juggle(session, CHASM);
+        rspeak(session, TROLL_SATISFIED);
         return GO_CLEAROBJ;
     }
     if (command.obj == FOOD && HERE(BEAR)) {
         /* But throwing food is another story. */
         command.obj = BEAR;
-        return (feed(command.verb, command.obj));
+        return (feed(session, command.verb, command.obj));
     }
     if (command.obj != AXE)
-        return (discard(command.verb, command.obj));
+        return (discard(session, command.verb, command.obj));
     else {
-        if (atdwrf(game.loc) <= 0) {
-            if (AT(DRAGON) && game.prop[DRAGON] == DRAGON_BARS)
-                return throw_support(DRAGON_SCALES);
+        if (atdwrf(session, session->game.loc) <= 0) {
+            if (AT(DRAGON) && session->game.prop[DRAGON] == DRAGON_BARS)
+                return throw_support(session, DRAGON_SCALES);
             if (AT(TROLL))
-                return throw_support(TROLL_RETURNS);
+                return throw_support(session, TROLL_RETURNS);
             if (AT(OGRE))
-                return throw_support(OGRE_DODGE);
-            if (HERE(BEAR) && game.prop[BEAR] == UNTAMED_BEAR) {
+                return throw_support(session, OGRE_DODGE);
+            if (HERE(BEAR) && session->game.prop[BEAR] == UNTAMED_BEAR) {
                 /* This'll teach him to throw the axe at the bear! */
-                drop(AXE, game.loc);
-                game.fixed[AXE] = IS_FIXED;
-                juggle(BEAR);
-                state_change(AXE, AXE_LOST);
+                drop(session, AXE, session->game.loc);
+                SETFIXED(AXE, IS_FIXED);
+                juggle(session, BEAR);
+                state_change(session, AXE, AXE_LOST);
                 return GO_CLEAROBJ;
             }
             command.obj = INTRANSITIVE;
-            return (attack(command));
+            return (attack(session, command));
         }
 
-        if (randrange(NDWARVES + 1) < game.dflag) {
-            return throw_support(DWARF_DODGES);
+        if (randrange(session, NDWARVES + 1) < session->game.dflag) {
+            return throw_support(session, DWARF_DODGES);
         } else {
-            int i = atdwrf(game.loc);
-            game.dseen[i] = false;
-            game.dloc[i] = LOC_NOWHERE;
-            return throw_support((++game.dkill == 1) ?
+            int i = atdwrf(session, session->game.loc);
+            session->game.dseen[i] = false;
+            session->game.dloc[i] = LOC_NOWHERE;
+            return throw_support(session, (++session->game.dkill == 1) ?
                                  DWARF_SMOKE :
                                  KILLED_DWARF);
         }
     }
 }
 
-static int wake(verb_t verb, obj_t obj)
+static int wake(struct session_t* session, verb_t verb, obj_t obj)
 /* Wake.  Only use is to disturb the dwarves. */
 {
     if (obj != DWARF ||
-        !game.closed) {
-        speak(actions[verb].message);
+        !session->game.closed) {
+        speak(session, actions[verb].message);
         return GO_CLEAROBJ;
     } else {
-        rspeak(PROD_DWARF);
+        rspeak(session, PROD_DWARF);
         return GO_DWARFWAKE;
     }
 }
 
-static int seed(verb_t verb, const char *arg)
+static int seed(struct session_t* session, verb_t verb, const char *arg)
 /* Set seed */
 {
     int32_t seed = strtol(arg, NULL, 10);
-    speak(actions[verb].message, seed);
-    set_seed(seed);
-    --game.turns;
+    speak(session, actions[verb].message, seed);
+    set_seed(session, seed);
+    --session->game.turns;
     return GO_TOP;
 }
 
-static int waste(verb_t verb, turn_t turns)
+static int waste(struct session_t* session, verb_t verb, turn_t turns)
 /* Burn turns */
 {
-    game.limit -= turns;
-    speak(actions[verb].message, (int)game.limit);
+    session->game.limit -= turns;
+    speak(session, actions[verb].message, (int)session->game.limit);
     return GO_TOP;
 }
 
-static int wave(verb_t verb, obj_t obj)
+static int wave(struct session_t* session, verb_t verb, obj_t obj)
 /* Wave.  No effect unless waving rod at fissure or at bird. */
 {
     if (obj != ROD ||
         !TOTING(obj) ||
         (!HERE(BIRD) &&
-         (game.closng ||
+         (session->game.closng ||
           !AT(FISSURE)))) {
-        speak(((!TOTING(obj)) && (obj != ROD ||
+        speak(session, ((!TOTING(obj)) && (obj != ROD ||
                                   !TOTING(ROD2))) ?
               arbitrary_messages[ARENT_CARRYING] :
               actions[verb].message);
         return GO_CLEAROBJ;
     }
 
-    if (game.prop[BIRD] == BIRD_UNCAGED && game.loc == game.place[STEPS] && game.prop[JADE] == STATE_NOTFOUND) {
-        drop(JADE, game.loc);
-        game.prop[JADE] = STATE_FOUND;
-        --game.tally;
-        rspeak(NECKLACE_FLY);
+    if (session->game.prop[BIRD] == BIRD_UNCAGED && session->game.loc == session->game.place[STEPS] && session->game.prop[JADE] == STATE_NOTFOUND) {
+        drop(session, JADE, session->game.loc);
+        SETPROP(JADE, STATE_FOUND);
+        --session->game.tally;
+        rspeak(session, NECKLACE_FLY);
         return GO_CLEAROBJ;
     } else {
-        if (game.closed) {
-            rspeak((game.prop[BIRD] == BIRD_CAGED) ?
+        if (session->game.closed) {
+            rspeak(session, (session->game.prop[BIRD] == BIRD_CAGED) ?
                    CAGE_FLY :
                    FREE_FLY);
             return GO_DWARFWAKE;
         }
-        if (game.closng ||
+        if (session->game.closng ||
             !AT(FISSURE)) {
-            rspeak((game.prop[BIRD] == BIRD_CAGED) ?
+            rspeak(session, (session->game.prop[BIRD] == BIRD_CAGED) ?
                    CAGE_FLY :
                    FREE_FLY);
             return GO_CLEAROBJ;
         }
         if (HERE(BIRD))
-            rspeak((game.prop[BIRD] == BIRD_CAGED) ?
+            rspeak(session, (session->game.prop[BIRD] == BIRD_CAGED) ?
                    CAGE_FLY :
                    FREE_FLY);
 
-        state_change(FISSURE,
-                     game.prop[FISSURE] == BRIDGED ? UNBRIDGED : BRIDGED);
+        state_change(session, FISSURE,
+                     session->game.prop[FISSURE] == BRIDGED ? UNBRIDGED : BRIDGED);
         return GO_CLEAROBJ;
     }
 }
 
-int action(command_t command)
+int action(struct session_t* session, command_t command)
 /*  Analyse a verb.  Remember what it was, go back for object if second word
  *  unless verb is "say", which snarfs arbitrary second word.
  */
@@ -1329,7 +1330,7 @@ int action(command_t command)
      * further were called "specials". Now they're handled here as normal
      * actions. If noaction is true, then we spit out the message and return */
     if (actions[command.verb].noaction) {
-        speak(actions[command.verb].message);
+        speak(session, actions[command.verb].message);
         return GO_CLEAROBJ;
     }
 
@@ -1343,20 +1344,20 @@ int action(command_t command)
          *  location. */
         if (HERE(command.obj))
             /* FALL THROUGH */;
-        else if (command.obj == DWARF && atdwrf(game.loc) > 0)
+        else if (command.obj == DWARF && atdwrf(session, session->game.loc) > 0)
             /* FALL THROUGH */;
         else if ((LIQUID() == command.obj && HERE(BOTTLE)) ||
-                 command.obj == LIQLOC(game.loc))
+                 command.obj == LOCALE(liquid))
             /* FALL THROUGH */;
-        else if (command.obj == OIL && HERE(URN) && game.prop[URN] != URN_EMPTY) {
+        else if (command.obj == OIL && HERE(URN) && session->game.prop[URN] != URN_EMPTY) {
             command.obj = URN;
             /* FALL THROUGH */;
-        } else if (command.obj == PLANT && AT(PLANT2) && game.prop[PLANT2] != PLANT_THIRSTY) {
+        } else if (command.obj == PLANT && AT(PLANT2) && session->game.prop[PLANT2] != PLANT_THIRSTY) {
             command.obj = PLANT2;
             /* FALL THROUGH */;
-        } else if (command.obj == KNIFE && game.knfloc == game.loc) {
-            game.knfloc = -1;
-            rspeak(KNIVES_VANISH);
+        } else if (command.obj == KNIFE && session->game.knfloc == session->game.loc) {
+            session->game.knfloc = -1;
+            rspeak(session, KNIVES_VANISH);
             return GO_CLEAROBJ;
         } else if (command.obj == ROD && HERE(ROD2)) {
             command.obj = ROD2;
@@ -1365,7 +1366,7 @@ int action(command_t command)
                     command.verb == INVENTORY) && (command.word[1].id == WORD_EMPTY || command.word[1].id == WORD_NOT_FOUND))
             /* FALL THROUGH */;
         else {
-            sspeak(NO_SEE, command.word[0].raw);
+            sspeak(session, NO_SEE, command.word[0].raw);
             return GO_CLEAROBJ;
         }
 
@@ -1387,88 +1388,88 @@ int action(command_t command)
             /*  Analyse an intransitive verb (ie, no object given yet). */
             switch (command.verb) {
             case CARRY:
-                return vcarry(command.verb, INTRANSITIVE);
+                return vcarry(session, command.verb, INTRANSITIVE);
             case  DROP:
                 return GO_UNKNOWN;
             case  SAY:
                 return GO_UNKNOWN;
             case  UNLOCK:
-                return lock(command.verb, INTRANSITIVE);
+                return lock(session, command.verb, INTRANSITIVE);
             case  NOTHING: {
-                rspeak(OK_MAN);
+                rspeak(session, OK_MAN);
                 return (GO_CLEAROBJ);
             }
             case  LOCK:
-                return lock(command.verb, INTRANSITIVE);
+                return lock(session, command.verb, INTRANSITIVE);
             case  LIGHT:
-                return light(command.verb, INTRANSITIVE);
+                return light(session, command.verb, INTRANSITIVE);
             case  EXTINGUISH:
-                return extinguish(command.verb, INTRANSITIVE);
+                return extinguish(session, command.verb, INTRANSITIVE);
             case  WAVE:
                 return GO_UNKNOWN;
             case  TAME:
                 return GO_UNKNOWN;
             case GO: {
-                speak(actions[command.verb].message);
+                speak(session, actions[command.verb].message);
                 return GO_CLEAROBJ;
             }
             case ATTACK:
                 command.obj = INTRANSITIVE;
-                return attack(command);
+                return attack(session, command);
             case POUR:
-                return pour(command.verb, INTRANSITIVE);
+                return pour(session, command.verb, INTRANSITIVE);
             case EAT:
-                return eat(command.verb, INTRANSITIVE);
+                return eat(session, command.verb, INTRANSITIVE);
             case DRINK:
-                return drink(command.verb, INTRANSITIVE);
+                return drink(session, command.verb, INTRANSITIVE);
             case RUB:
                 return GO_UNKNOWN;
             case THROW:
                 return GO_UNKNOWN;
             case QUIT:
-                return quit();
+                return quit(session);
             case FIND:
                 return GO_UNKNOWN;
             case INVENTORY:
-                return inven();
+                return inven(session);
             case FEED:
                 return GO_UNKNOWN;
             case FILL:
-                return fill(command.verb, INTRANSITIVE);
+                return fill(session, command.verb, INTRANSITIVE);
             case BLAST:
-                blast();
+                blast(session);
                 return GO_CLEAROBJ;
             case SCORE:
-                score(scoregame);
+                score(session, scoregame);
                 return GO_CLEAROBJ;
             case FEE:
             case FIE:
             case FOE:
             case FOO:
             case FUM:
-                return bigwords(command.word[0].id);
+                return bigwords(session, command.word[0].id);
             case BRIEF:
-                return brief();
+                return brief(session);
             case READ:
                 command.obj = INTRANSITIVE;
-                return read(command);
+                return read(session, command);
             case BREAK:
                 return GO_UNKNOWN;
             case WAKE:
                 return GO_UNKNOWN;
             case SAVE:
-                return suspend();
+                return suspend(session);
             case RESUME:
-                return resume();
+                return resume(session);
             case FLY:
-                return fly(command.verb, INTRANSITIVE);
+                return fly(session, command.verb, INTRANSITIVE);
             case LISTEN:
-                return listen();
+                return listen(session);
             case PART:
-                return reservoir();
+                return reservoir(session);
             case SEED:
             case WASTE:
-                rspeak(NUMERIC_REQUIRED);
+                rspeak(session, NUMERIC_REQUIRED);
                 return GO_TOP;
             default: // LCOV_EXCL_LINE
                 BUG(INTRANSITIVE_ACTION_VERB_EXCEEDS_GOTO_LIST); // LCOV_EXCL_LINE
@@ -1479,62 +1480,62 @@ int action(command_t command)
         /*  Analyse a transitive verb. */
         switch (command.verb) {
         case  CARRY:
-            return vcarry(command.verb, command.obj);
+            return vcarry(session, command.verb, command.obj);
         case  DROP:
-            return discard(command.verb, command.obj);
+            return discard(session, command.verb, command.obj);
         case  SAY:
-            return say(command);
+            return say(session, command);
         case  UNLOCK:
-            return lock(command.verb, command.obj);
+            return lock(session, command.verb, command.obj);
         case  NOTHING: {
-            rspeak(OK_MAN);
+            rspeak(session, OK_MAN);
             return (GO_CLEAROBJ);
         }
         case  LOCK:
-            return lock(command.verb, command.obj);
+            return lock(session, command.verb, command.obj);
         case LIGHT:
-            return light(command.verb, command.obj);
+            return light(session, command.verb, command.obj);
         case EXTINGUISH:
-            return extinguish(command.verb, command.obj);
+            return extinguish(session, command.verb, command.obj);
         case WAVE:
-            return wave(command.verb, command.obj);
+            return wave(session, command.verb, command.obj);
         case TAME: {
-            speak(actions[command.verb].message);
+            speak(session, actions[command.verb].message);
             return GO_CLEAROBJ;
         }
         case GO: {
-            speak(actions[command.verb].message);
+            speak(session, actions[command.verb].message);
             return GO_CLEAROBJ;
         }
         case ATTACK:
-            return attack(command);
+            return attack(session, command);
         case POUR:
-            return pour(command.verb, command.obj);
+            return pour(session, command.verb, command.obj);
         case EAT:
-            return eat(command.verb, command.obj);
+            return eat(session, command.verb, command.obj);
         case DRINK:
-            return drink(command.verb, command.obj);
+            return drink(session, command.verb, command.obj);
         case RUB:
-            return rub(command.verb, command.obj);
+            return rub(session, command.verb, command.obj);
         case THROW:
-            return throw (command);
+            return throw (session, command);
         case QUIT: {
-            speak(actions[command.verb].message);
+            speak(session, actions[command.verb].message);
             return GO_CLEAROBJ;
         }
         case FIND:
-            return find(command.verb, command.obj);
+            return find(session, command.verb, command.obj);
         case INVENTORY:
-            return find(command.verb, command.obj);
+            return find(session, command.verb, command.obj);
         case FEED:
-            return feed(command.verb, command.obj);
+            return feed(session, command.verb, command.obj);
         case FILL:
-            return fill(command.verb, command.obj);
+            return fill(session, command.verb, command.obj);
         case BLAST:
-            blast();
+            blast(session);
             return GO_CLEAROBJ;
         case SCORE: {
-            speak(actions[command.verb].message);
+            speak(session, actions[command.verb].message);
             return GO_CLEAROBJ;
         }
         case FEE:
@@ -1542,48 +1543,48 @@ int action(command_t command)
         case FOE:
         case FOO:
         case FUM: {
-            speak(actions[command.verb].message);
+            speak(session, actions[command.verb].message);
             return GO_CLEAROBJ;
         }
         case BRIEF: {
-            speak(actions[command.verb].message);
+            speak(session, actions[command.verb].message);
             return GO_CLEAROBJ;
         }
         case READ:
-            return read(command);
+            return read(session, command);
         case BREAK:
-            return vbreak(command.verb, command.obj);
+            return vbreak(session, command.verb, command.obj);
         case WAKE:
-            return wake(command.verb, command.obj);
+            return wake(session, command.verb, command.obj);
         case SAVE: {
-            speak(actions[command.verb].message);
+            speak(session, actions[command.verb].message);
             return GO_CLEAROBJ;
         }
         case RESUME: {
-            speak(actions[command.verb].message);
+            speak(session, actions[command.verb].message);
             return GO_CLEAROBJ;
         }
         case FLY:
-            return fly(command.verb, command.obj);
+            return fly(session, command.verb, command.obj);
         case LISTEN: {
-            speak(actions[command.verb].message);
+            speak(session, actions[command.verb].message);
             return GO_CLEAROBJ;
         }
         // LCOV_EXCL_START
         // This case should never happen - here only as placeholder
         case PART:
-            return reservoir();
+            return reservoir(session);
         // LCOV_EXCL_STOP
         case SEED:
-            return seed(command.verb, command.word[1].raw);
+            return seed(session, command.verb, command.word[1].raw);
         case WASTE:
-            return waste(command.verb, (turn_t)atol(command.word[1].raw));
+            return waste(session, command.verb, (turn_t)atol(command.word[1].raw));
         default: // LCOV_EXCL_LINE
             BUG(TRANSITIVE_ACTION_VERB_EXCEEDS_GOTO_LIST); // LCOV_EXCL_LINE
         }
     case unknown:
         /* Unknown verb, couldn't deduce object - might need hint */
-        sspeak(WHAT_DO, command.word[0].raw);
+        sspeak(session, WHAT_DO, command.word[0].raw);
         return GO_CLEAROBJ;
     default: // LCOV_EXCL_LINE
         BUG(SPEECHPART_NOT_TRANSITIVE_OR_INTRANSITIVE_OR_UNKNOWN); // LCOV_EXCL_LINE
@@ -3,6 +3,9 @@
 #include <stdbool.h>
 #include <stdarg.h>
 #include <inttypes.h>
+#include <limits.h>
+#include <sys/uio.h>
+#include <setjmp.h>
 
 #include "dungeon.h"
 
@@ -43,7 +46,7 @@
 /* Map a state property value to a negative range, where the object cannot be
  * picked up but the value can be recovered later.  Avoid colliding with -1,
  * which has its own meaning. */
-#define STASHED(obj)	(-1 - game.prop[obj])
+#define STASHED(obj)	(-1 - session->game.prop[obj])
 
 /*
  *  MOD(N,M)    = Arithmetic modulus
@@ -58,23 +61,38 @@
  *  LIQLOC(LOC) = object number of liquid (if any) at LOC
  *  PCT(N)      = true N% of the time (N integer from 0 to 100)
  *  TOTING(OBJ) = true if the OBJ is being carried */
-#define DESTROY(N)   move(N, LOC_NOWHERE)
+#define DESTROY(N)   move(session, N, LOC_NOWHERE)
 #define MOD(N,M)     ((N) % (M))
-#define TOTING(OBJ)  (game.place[OBJ] == CARRIED)
-#define AT(OBJ)      (game.place[OBJ] == game.loc || game.fixed[OBJ] == game.loc)
+#define TOTING(OBJ)  (session->game.place[OBJ] == CARRIED)
+#define AT(OBJ)      (session->game.place[OBJ] == session->game.loc || session->game.fixed[OBJ] == session->game.loc)
 #define HERE(OBJ)    (AT(OBJ) || TOTING(OBJ))
 #define CNDBIT(L,N)  (tstbit(conditions[L],N))
-#define LIQUID()     (game.prop[BOTTLE] == WATER_BOTTLE? WATER : game.prop[BOTTLE] == OIL_BOTTLE ? OIL : NO_OBJECT )
+#define LIQUID()     (session->game.prop[BOTTLE] == WATER_BOTTLE? WATER : session->game.prop[BOTTLE] == OIL_BOTTLE ? OIL : NO_OBJECT )
 #define LIQLOC(LOC)  (CNDBIT((LOC),COND_FLUID)? CNDBIT((LOC),COND_OILY) ? OIL : WATER : NO_OBJECT)
 #define FORCED(LOC)  CNDBIT(LOC, COND_FORCED)
-#define DARK(DUMMY)  (!CNDBIT(game.loc,COND_LIT) && (game.prop[LAMP] == LAMP_DARK || !HERE(LAMP)))
-#define PCT(N)       (randrange(100) < (N))
+#define PCT(N)       (randrange(session, 100) < (N))
 #define GSTONE(OBJ)  ((OBJ) == EMERALD || (OBJ) == RUBY || (OBJ) == AMBER || (OBJ) == SAPPH)
 #define FOREST(LOC)  CNDBIT(LOC, COND_FOREST)
 #define OUTSID(LOC)  (CNDBIT(LOC, COND_ABOVE) || FOREST(LOC))
 #define INSIDE(LOC)  (!OUTSID(LOC) || LOC == LOC_BUILDING)
 #define INDEEP(LOC)  ((LOC) >= LOC_MISTHALL && !OUTSID(LOC))
-#define BUG(x)       bug(x, #x)
+#define BUG(x)       bug(session, x, #x)
+
+/* Object bitsets, OBJWORDS words long; see next_object() */
+#define BIT_SET(S,N)    ((S)[(N) / 64] |= UINT64_C(1) << ((N) % 64))
+#define BIT_CLEAR(S,N)  ((S)[(N) / 64] &= ~(UINT64_C(1) << ((N) % 64)))
+#define BIT_TEST(S,N)   (((S)[(N) / 64] >> ((N) % 64)) & 1)
+#define CARRIED_SET     (session->derived.carried)
+#define PRESENT_SET(L)  (session->derived.present[L])
+
+/* The large game arrays must only be written through these, which keep
+ * the running state hash current; see hashed_set(). */
+#define SETABBREV(LOC,V)  hashed_set(session, HASH_ABBREV, session->game.abbrev, LOC, V)
+#define SETATLOC(LOC,V)   hashed_set(session, HASH_ATLOC, session->game.atloc, LOC, V)
+#define SETFIXED(OBJ,V)   hashed_set(session, HASH_FIXED, session->game.fixed, OBJ, V)
+#define SETLINK(OBJ,V)    hashed_set(session, HASH_LINK, session->game.link, OBJ, V)
+#define SETPLACE(OBJ,V)   hashed_set(session, HASH_PLACE, session->game.place, OBJ, V)
+#define SETPROP(OBJ,V)    hashed_set(session, HASH_PROP, session->game.prop, OBJ, V)
 
 enum bugtype {
     SPECIAL_TRAVEL_500_GT_L_GT_300_EXCEEDS_GOTO_LIST,
@@ -86,16 +104,22 @@ enum bugtype {
     HINT_NUMBER_EXCEEDS_GOTO_LIST,
     SPEECHPART_NOT_TRANSITIVE_OR_INTRANSITIVE_OR_UNKNOWN,
     ACTION_RETURNED_PHASE_CODE_BEYOND_END_OF_SWITCH,
+    RUNNING_SCORE_DIVERGED_FROM_RESCAN,
+    RUNNING_HASH_DIVERGED_FROM_RESCAN,
 };
 
 enum speaktype {touch, look, hear, study, change};
 
+enum hashfield {
+    HASH_ABBREV, HASH_ATLOC, HASH_FIXED, HASH_LINK, HASH_PLACE, HASH_PROP,
+    HASH_SCALARS, HASH_DSEEN, HASH_DLOC, HASH_ODLOC, HASH_HINTED,
+    HASH_HINTLC, HASH_ZZWORD,
+};
+
 enum termination {endgame, quitgame, scoregame};
 
 enum speechpart {unknown, intransitive, transitive};
 
-typedef enum {NO_WORD_TYPE, MOTION, OBJECT, ACTION, NUMERIC} word_type_t;
-
 typedef enum scorebonus {none, splatter, defeat, victory} score_t;
 
 /* Phase codes for action returns.
@@ -118,6 +142,9 @@ typedef long obj_t;    // index into the object array */
 typedef long loc_t;    // index into the locations array */
 typedef long turn_t;   // turn counter or threshold */
 
+/* The undo journal in saveresume.c treats this as an array of longs and
+ * names stretches of it by field; its word tables and the assertions
+ * after them must be kept in step with any change of layout here. */
 struct game_t {
     int32_t lcg_x;
     long abbnum;                 // How often to print long descriptions
@@ -183,14 +210,23 @@ struct game_t {
  * Game application settings - settings, but not state of the game, per se.
  * This data is not saved in a saved game.
  */
+struct session_t;
+
 struct settings_t {
     FILE *logfp;
     bool oldstyle;
     bool prompt;
+    bool linebuffer;	/* flush output per message, not per prompt */
+    bool echo;		/* repeat each input line in the output */
+    int outfd;		/* where the output goes */
+    char* (*input)(struct session_t*, const char*);	/* prompt for a line; malloc()ed, NULL at EOF */
+    void* host;		/* whatever an embedder's input routine needs */
 };
 
+/* A command word is a view of one word of the current input line; it
+ * stays valid until the next call to get_command_input(). */
 typedef struct {
-    char raw[LINESIZE];
+    const char* raw;
     vocab_t id;
     word_type_t type;
 } command_word_t;
@@ -202,39 +238,208 @@ typedef struct {
     obj_t   obj;
 } command_t;
 
-extern struct game_t game;
-extern struct settings_t settings;
+/* As many iovecs as one writev() takes, so a turn is never split */
+#if defined(IOV_MAX)
+#define OUTPUT_IOVECS	IOV_MAX
+#elif defined(UIO_MAXIOV)
+#define OUTPUT_IOVECS	UIO_MAXIOV
+#else
+#define OUTPUT_IOVECS	16	// _XOPEN_IOV_MAX, the least POSIX allows
+#endif
+#define OUTPUT_SCRATCH	4096
+
+/* Output waiting for the next flush; see the sink in misc.c. */
+struct output_t {
+    struct iovec iov[OUTPUT_IOVECS];
+    int niov;
+    char scratch[OUTPUT_SCRATCH];
+    size_t used;
+};
+
+/*
+ * What the player's location is like, worked out once and served until
+ * game.loc changes or the lamp is moved or switched; see locale().
+ */
+struct locale_t {
+    bool valid;
+    loc_t loc;                   // the game.loc the rest is about
+    bool dark;                   // DARK()
+    bool outside;                // OUTSID(game.loc)
+    bool inside;                 // INSIDE(game.loc)
+    bool deep;                   // INDEEP(game.loc)
+    bool forced;                 // FORCED(game.loc)
+    obj_t liquid;                // LIQLOC(game.loc)
+};
+
+/*
+ * What the session works out from the game state and keeps in step
+ * with it, so it needn't be recomputed from scratch.  None of it is
+ * saved; it is rebuilt after a restore.
+ */
+struct derived_t {
+    long points;                 // running score, kept by rescore()
+    long flag_points;            // part of it not owed to any object
+    short earned[NOBJECTS + 1];  // part of it owed to each object
+    uint64_t hash;               // running hash of the large game arrays
+    obj_t prev[NOBJECTS * 2 + 1]; // what links to each object, or NO_OBJECT
+    uint64_t carried[OBJWORDS];  // objects being toted
+    uint64_t present[NLOCATIONS + 1][OBJWORDS]; // objects AT() each location
+    struct locale_t locale;      // facts about game.loc
+    uint32_t hints_counting;     // hints whose hintlc may be nonzero
+    int threshold_next;          // first turn_thresholds[] entry not passed
+};
+
+/*
+ * Undo journal.  Each entry is one word of game_t that changed, by
+ * index; turns[] says where each turn's entries end, and what command
+ * was in hand then.  Writes to the large arrays are logged as they
+ * happen by hashed_set(); everything else is caught by comparing
+ * against shadow[] at each turn boundary.
+ */
+struct journal_entry_t {
+    uint32_t word;
+    long before;
+    long after;
+};
+
+struct journal_turn_t {
+    size_t end;                  // entries[] index just past the turn's
+    command_t command;           // as it stood when the turn was over
+    char* command_line;          // what command's words point into
+};
+
+struct journal_t {
+    bool enabled;
+    bool replaying;              // undoing or redoing, so don't log
+    struct journal_entry_t* entries;
+    size_t nentries, maxentries;
+    struct journal_turn_t* turns;
+    size_t nturns, maxturns;
+    size_t undone;               // turns undone that could be redone
+    struct journal_turn_t start; // the command in hand before turns[0]
+    long* shadow;                // unlogged words as at the last mark
+};
+
+/*
+ * A game in progress, frozen.  Taking one and going back to it are
+ * plain copies: no I/O, no validation and no save penalty.  The
+ * command in hand goes with it, since a verb still waiting for its
+ * object changes what the next command means; snapshot_free()
+ * releases the copy of its input line.
+ */
+struct snapshot_t {
+    struct game_t state;
+    struct derived_t derived;
+    command_t command;
+    char* command_line;          // what command's words point into
+};
 
-extern bool get_command_input(command_t *);
-extern void speak(const char*, ...);
-extern void sspeak(int msg, ...);
-extern void pspeak(vocab_t, enum speaktype, int, bool, ...);
-extern void rspeak(vocab_t, ...);
+/*
+ * Everything one game in progress owns.  No other engine state varies
+ * from game to game, so any number of sessions can live in one
+ * address space.
+ * Engine functions are handed the session they work on as their first
+ * argument, always named session, which the macros above rely on.
+ */
+struct session_t {
+    struct game_t game;
+    struct settings_t settings;
+    command_t command;           // last command, consulted by the next
+    char* command_line;          // input line the command words point into
+    int mxscor;                  // maximum possible score, set by score_init()
+    struct derived_t derived;    // kept in step with game
+    struct journal_t journal;    // undo history, if enabled
+    struct output_t output;
+    bool playing;                // inside play() or its kin, so unwind is live
+    jmp_buf unwind;              // where session_end() returns to them
+    int status;                  // exit status handed back by play()
+    bool over;                   // the game has ended
+    bool waiting;                // stopped at the prompt by play_step()
+    int budget;                  // commands left to obey, if not negative
+    int32_t seed;                // for the game's generator, set by session_new()
+};
+
+extern void locale_refill(struct session_t*);
+
+static inline const struct locale_t* locale(struct session_t* session)
+/* The facts about the player's location, brought up to date if it or
+ * the lamp has changed since they were last asked for. */
+{
+    const struct locale_t* here = &session->derived.locale;
+    if (!here->valid || here->loc != session->game.loc)
+        locale_refill(session);
+    return here;
+}
+
+#define DARK(DUMMY)  (locale(session)->dark)
+#define LOCALE(FACT) (locale(session)->FACT)
+
+extern struct session_t* session_new(void);
+extern struct session_t* session_clone(const struct session_t*);
+extern void session_free(struct session_t*);
+extern bool command_copy(command_t*, char**, const command_t*, const char*);
+extern void session_end(struct session_t*, int) __attribute__((noreturn));
+extern int play(struct session_t*, FILE*);
+extern bool play_begin(struct session_t*, FILE*);
+extern bool play_step(struct session_t*);
+extern int play_on(struct session_t*);
+
+extern bool get_command_input(struct session_t*, command_t *);
+extern void output_printf(struct session_t*, const char*, ...) __attribute__((format(printf, 2, 3)));
+extern void output_flush(struct session_t*);
+extern void speak(struct session_t*, string_t, ...);
+extern void cspeak(struct session_t*, string_t, msgops_t, ...);
+extern void sspeak(struct session_t*, int msg, ...);
+extern void pspeak(struct session_t*, vocab_t, enum speaktype, int, bool, ...);
+extern void rspeak(struct session_t*, vocab_t, ...);
 extern void echo_input(FILE*, const char*, const char*);
-extern bool silent_yes(void);
-extern bool yes(const char*, const char*, const char*);
-extern void juggle(obj_t);
-extern void move(obj_t, loc_t);
-extern loc_t put(obj_t, long, long);
-extern void carry(obj_t, loc_t);
-extern void drop(obj_t, loc_t);
-extern int atdwrf(loc_t);
+extern char* console_input(struct session_t*, const char*);
+extern bool silent_yes(struct session_t*);
+extern bool yes(struct session_t*, string_t, string_t, string_t);
+extern void juggle(struct session_t*, obj_t);
+extern void move(struct session_t*, obj_t, loc_t);
+extern loc_t put(struct session_t*, obj_t, long, long);
+extern void carry(struct session_t*, obj_t, loc_t);
+extern void drop(struct session_t*, obj_t, loc_t);
+extern int atdwrf(struct session_t*, loc_t);
 extern long setbit(int);
 extern bool tstbit(long, int);
-extern void set_seed(int32_t);
-extern int32_t randrange(int32_t);
-extern long score(enum termination);
-extern void terminate(enum termination) __attribute__((noreturn));
-extern int savefile(FILE *, int32_t);
-extern int suspend(void);
-extern int resume(void);
-extern int restore(FILE *);
-extern long initialise(void);
-extern int action(command_t command);
-extern void state_change(obj_t, int);
-
-
-void bug(enum bugtype, const char *) __attribute__((__noreturn__));
+extern void set_seed(struct session_t*, int32_t);
+extern int32_t randrange(struct session_t*, int32_t);
+extern void hashed_set(struct session_t*, enum hashfield, long*, long, long);
+extern void hash_init(struct session_t*);
+extern void links_at(struct session_t*, loc_t);
+extern void links_init(struct session_t*);
+extern void index_init(struct session_t*);
+extern obj_t next_object(const uint64_t*, obj_t);
+extern void hints_init(struct session_t*);
+extern void derived_init(struct session_t*);
+extern uint64_t game_hash(struct session_t*, bool);
+extern void rescore(struct session_t*, obj_t);
+extern void rescore_flags(struct session_t*);
+extern void score_init(struct session_t*);
+extern long score(struct session_t*, enum termination);
+extern void terminate(struct session_t*, enum termination) __attribute__((noreturn));
+extern int savefile(struct session_t*, FILE *, int32_t);
+extern int suspend(struct session_t*);
+extern int resume(struct session_t*);
+extern int restore(struct session_t*, FILE *);
+extern void snapshot_take(struct session_t*, struct snapshot_t*);
+extern void snapshot_restore(struct session_t*, const struct snapshot_t*);
+extern void snapshot_free(struct snapshot_t*);
+extern void journal_start(struct session_t*);
+extern void journal_stop(struct session_t*);
+extern void journal_free(struct journal_t*);
+extern void journal_record(struct session_t*, const long*, long, long);
+extern void journal_mark(struct session_t*);
+extern bool journal_undo(struct session_t*);
+extern bool journal_redo(struct session_t*);
+extern long initialise(struct session_t*);
+extern int action(struct session_t*, command_t command);
+extern void state_change(struct session_t*, obj_t, int);
+
+
+void bug(struct session_t*, enum bugtype, const char *) __attribute__((__noreturn__));
 
 /* represent an empty command word */
 static const command_word_t empty_command_word = {
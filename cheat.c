@@ -21,13 +21,19 @@ int main(int argc, char *argv[])
     int version = 0;
     FILE *fp = NULL;
 
+    struct session_t* session = session_new();
+    if (session == NULL) {
+        fprintf(stderr, "cheat: out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+
     // Initialize game variables
-    initialise();
+    initialise(session);
 
     /* we're generating a saved game, so saved once by default,
      * unless overridden with command-line options below.
      */
-    game.saved = 1;
+    session->game.saved = 1;
 
     /*  Options. */
     const char* opts = "d:l:s:t:v:o:";
@@ -42,20 +48,20 @@ int main(int argc, char *argv[])
     while ((ch = getopt(argc, argv, opts)) != EOF) {
         switch (ch) {
         case 'd':
-            game.numdie = (turn_t)atoi(optarg);
-            printf("cheat: game.numdie = %ld\n", game.numdie);
+            session->game.numdie = (turn_t)atoi(optarg);
+            printf("cheat: game.numdie = %ld\n", session->game.numdie);
             break;
         case 'l':
-            game.limit = (turn_t)atoi(optarg);
-            printf("cheat: game.limit = %ld\n", game.limit);
+            session->game.limit = (turn_t)atoi(optarg);
+            printf("cheat: game.limit = %ld\n", session->game.limit);
             break;
         case 's':
-            game.saved = (long)atoi(optarg);
-            printf("cheat: game.saved = %ld\n", game.saved);
+            session->game.saved = (long)atoi(optarg);
+            printf("cheat: game.saved = %ld\n", session->game.saved);
             break;
         case 't':
-            game.turns = (turn_t)atoi(optarg);
-            printf("cheat: game.turns = %ld\n", game.turns);
+            session->game.turns = (turn_t)atoi(optarg);
+            printf("cheat: game.turns = %ld\n", session->game.turns);
             break;
         case 'v':
             version = atoi(optarg);
@@ -88,7 +94,7 @@ int main(int argc, char *argv[])
         exit(EXIT_FAILURE);
     }
 
-    savefile(fp, version);
+    savefile(session, fp, version);
 
     fclose(fp);
 
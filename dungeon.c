@@ -0,0 +1,17751 @@
+/* Generated from adventure.yaml - do not hand-hack! */
+
+#include "dungeon.h"
+
+const char dungeon_strings[] =
+    "\0"
+    "Somewhere nearby is Colossal Cave, where others have found fortunes in\ntreasure and gold, though it is rumored that some who enter are never\nseen again.  Magic is said to work in the cave.  I will be your eyes\nand hands.  Direct me with commands of 1 or 2 words.  I should warn\nyou that I look at only the first five letters of each word, so you\'ll\nhave to enter \"northeast\" as \"ne\" to distinguish it from \"north\".\nYou can type \"help\" for some general hints.  For information on how\nto end your adventure, scoring, etc., type \"info\".\n\t\t\t      - - -\nThis program was originally developed by Willie Crowther.  Most of the\nfeatures of the current program were added by Don Woods.\0"
+    "A little dwarf with a big knife blocks your way.\0"
+    "A little dwarf just walked around a corner, saw you, threw a little\naxe at you which missed, cursed, and ran away.\0"
+    "There are %d threatening little dwarves in the room with you.\0"
+    "There is a threatening little dwarf in the room with you!\0"
+    "One sharp nasty knife is thrown at you!\0"
+    "A hollow voice says \"PLUGH\".\0"
+    "It gets you!\0"
+    "It misses!\0"
+    "I am unsure how you are facing.  Use compass points or nearby objects.\0"
+    "I don\'t know in from out here.  Use compass points or name something\nin the general direction you want to go.\0"
+    "I don\'t know how to apply that word here.\0"
+    "I\'m game.  Would you care to explain how?\0"
+    "Sorry, but I am not allowed to give more detail.  I will repeat the\nlong description of your location.\0"
+    "It is now pitch dark.  If you proceed you will likely fall into a pit.\0"
+    "If you prefer, simply type w rather than west.\0"
+    "Do you really want to quit now?\0"
+    "You fell into a pit and broke every bone in your body!\0"
+    "You are already carrying it!\0"
+    "You can\'t be serious!\0"
+    "The bird seemed unafraid at first, but as you approach it becomes\ndisturbed and you cannot catch it.\0"
+    "You can catch the bird, but you cannot carry it.\0"
+    "There is nothing here with a lock!\0"
+    "You aren\'t carrying it!\0"
+    "The little bird attacks the green snake, and in an astounding flurry\ndrives the snake away.\0"
+    "You have no keys!\0"
+    "It has no lock.\0"
+    "I don\'t know how to lock or unlock such a thing.\0"
+    "It was already locked.\0"
+    "It was already unlocked.\0"
+    "There is no way to get past the bear to unlock the chain, which is\nprobably just as well.\0"
+    "Nothing happens.\0"
+    "Where?\0"
+    "There is nothing here to attack.\0"
+    "The little bird is now dead.  Its body disappears.\0"
+    "Attacking the snake both doesn\'t work and is very dangerous.\0"
+    "You killed a little dwarf.\0"
+    "You attack a little dwarf, but he dodges out of the way.\0"
+    "With what?  Your bare hands?\0"
+    "There is no way to go that direction.\0"
+    "Please stick to 1- and 2-word commands.\0"
+    "OK\0"
+    "You can\'t unlock the keys.\0"
+    "You have crawled around in some little holes and wound up back in the\nmain passage.\0"
+    "I don\'t know where the cave is, but hereabouts no stream can run on\nthe surface for long.  I would try the stream.\0"
+    "I need more detailed instructions to do that.\0"
+    "I can only tell you what you see as you move about and manipulate\nthings.  I cannot tell you where remote things are.\0"
+    "The ogre snarls and shoves you back.\0"
+    "Huh?\0"
+    "Welcome to Adventure!!  Would you like instructions?\0"
+    "Blasting requires dynamite.\0"
+    "Your feet are now wet.\0"
+    "I think I just lost my appetite.\0"
+    "Thank you, it was delicious!\0"
+    "Peculiar.  Nothing unexpected happens.\0"
+    "Your bottle is empty and the ground is wet.\0"
+    "You can\'t pour that.\0"
+    "Which way?\0"
+    "Sorry, but I no longer seem to remember how it was you got here.\0"
+    "You can\'t carry anything more.  You\'ll have to drop something first.\0"
+    "You can\'t go through a locked steel grate!\0"
+    "I believe what you want is right here with you.\0"
+    "You don\'t fit through a two-inch slit!\0"
+    "I respectfully suggest you go across the bridge instead of jumping.\0"
+    "There is no way across the fissure.\0"
+    "You\'re not carrying anything.\0"
+    "You are currently holding the following:\0"
+    "It\'s not hungry (it\'s merely pinin\' for the fjords).  Besides, you\nhave no bird seed.\0"
+    "The snake has now devoured your bird.\0"
+    "There\'s nothing here it wants to eat (except perhaps you).\0"
+    "You fool, dwarves eat only coal!  Now you\'ve made him *REALLY* mad!!\0"
+    "You have nothing in which to carry it.\0"
+    "Your bottle is already full.\0"
+    "There is nothing here with which to fill the bottle.\0"
+    "Don\'t be ridiculous!\0"
+    "The door is extremely rusty and refuses to open.\0"
+    "The plant indignantly shakes the oil off its leaves and asks, \"Water?\"\0"
+    "The plant has exceptionally deep roots and cannot be pulled free.\0"
+    "The dwarves\' knives vanish as they strike the walls of the cave.\0"
+    "Something you\'re carrying won\'t fit through the tunnel with you.\nYou\'d best take inventory and drop something.\0"
+    "You can\'t fit this five-foot clam through that little passage!\0"
+    "You can\'t fit this five-foot oyster through that little passage!\0"
+    "I advise you to put down the oyster before opening it.  >WRENCH!<\0"
+    "You don\'t have anything strong enough to open the clam.\0"
+    "You don\'t have anything strong enough to open the oyster.\0"
+    "A glistening pearl falls out of the clam and rolls away.  Goodness,\nthis must really be an oyster.  (I never was very good at identifying\nbivalves.)  Whatever it is, it has now snapped shut again.\0"
+    "The oyster creaks open, revealing nothing but oyster inside.  It\npromptly snaps shut again.\0"
+    "You have crawled around in some little holes and found your way\nblocked by a recent cave-in.  You are now back in the main passage.\0"
+    "There are faint rustling noises from the darkness behind you.\0"
+    "Out from the shadows behind you pounces a bearded pirate!  \"Har, har,\"\nhe chortles, \"I\'ll just take all this booty and hide it away with me\nchest deep in the maze!\"  He snatches your treasure and vanishes into\nthe gloom.\0"
+    "A sepulchral voice reverberating through the cave, says, \"Cave closing\nsoon.  All adventurers exit immediately through main office.\"\0"
+    "A mysterious recorded voice groans into life and announces:\n   \"This exit is closed.  Please leave via main office.\"\0"
+    "It looks as though you\'re dead.  Well, seeing as how it\'s so close to\nclosing time anyway, I think we\'ll just call it a day.\0"
+    "The sepulchral voice intones, \"The cave is now closed.\"  As the echoes\nfade, there is a blinding flash of light (and a small puff of orange\nsmoke). . . .    As your eyes refocus, you look around and find...\0"
+    "There is a loud explosion, and a twenty-foot hole appears in the far\nwall, burying the dwarves in the rubble.  You march through the hole\nand find yourself in the main office, where a cheering band of\nfriendly elves carry the conquering adventurer off into the sunset.\0"
+    "There is a loud explosion, and a twenty-foot hole appears in the far\nwall, burying the snakes in the rubble.  A river of molten lava pours\nin through the hole, destroying everything in its path, including you!\0"
+    "There is a loud explosion, and you are suddenly splashed across the\nwalls of the room.\0"
+    "The resulting ruckus has awakened the dwarves.  There are now several\nthreatening little dwarves in the room with you!  Most of them throw\nknives at you!  All of them get you!\0"
+    "Oh, leave the poor unhappy bird alone.\0"
+    "I daresay whatever you want is around here somewhere.\0"
+    "You can\'t get there from here.\0"
+    "You are being followed by a very large, tame bear.\0"
+    "Now let\'s see you do it without suspending in mid-Adventure.\0"
+    "There is nothing here with which to fill it.\0"
+    "The sudden change in temperature has delicately shattered the vase.\0"
+    "It is beyond your power to do that.\0"
+    "I don\'t know how.\0"
+    "It is too far up for you to reach.\0"
+    "You killed a little dwarf.  The body vanishes in a cloud of greasy\nblack smoke.\0"
+    "The shell is very strong and is impervious to attack.\0"
+    "What\'s the matter, can\'t you read?  Now you\'d best start over.\0"
+    "Well, that was remarkably pointless.\0"
+    "The axe bounces harmlessly off the dragon\'s thick scales.\0"
+    "The dragon looks rather nasty.  You\'d best not try to get by.\0"
+    "The little bird attacks the green dragon, and in an astounding flurry\ngets burnt to a cinder.  The ashes blow away.\0"
+    "Okay, from now on I\'ll only describe a place in full the first time\nyou come to it.  To get the full description, say \"look\".\0"
+    "Trolls are close relatives with the rocks and have skin as tough as\nthat of a rhinoceros.  The troll fends off your blows effortlessly.\0"
+    "The troll deftly catches the axe, examines it carefully, and tosses it\nback, declaring, \"Good workmanship, but it\'s not valuable enough.\"\0"
+    "The troll catches your treasure and scurries away out of sight.\0"
+    "The troll refuses to let you cross.\0"
+    "There is no longer any way across the chasm.\0"
+    "With what?  Your bare hands?  Against *HIS* bear hands??\0"
+    "The bear is confused; he only wants to be your friend.\0"
+    "For crying out loud, the poor thing is already dead!\0"
+    "The bear is still chained to the wall.\0"
+    "The chain is still locked.\0"
+    "The chain is now unlocked.\0"
+    "The chain is now locked.\0"
+    "There is nothing here to which the chain can be locked.\0"
+    "Do you want the hint?\0"
+    "Gluttony is not one of the troll\'s vices.  Avarice, however, is.\0"
+    "Your lamp is getting dim.  You\'d best start wrapping this up, unless\nyou can find some fresh batteries.  I seem to recall there\'s a vending\nmachine in the maze.  Bring some coins with you.\0"
+    "Your lamp has run out of power.\0"
+    "Please answer the question.\0"
+    "There are faint rustling noises from the darkness behind you.  As you\nturn toward them, the beam of your lamp falls across a bearded pirate.\nHe is carrying a large chest.  \"Shiver me timbers!\" he cries, \"I\'ve\nbeen spotted!  I\'d best hie meself off to the maze to hide me chest!\"\nWith that, he vanishes into the gloom.\0"
+    "Your lamp is getting dim.  You\'d best go back for those batteries.\0"
+    "Your lamp is getting dim.  I\'m taking the liberty of replacing the\nbatteries.\0"
+    "Your lamp is getting dim, and you\'re out of spare batteries.  You\'d\nbest start wrapping this up.\0"
+    "You sift your fingers through the dust, but succeed only in\nobliterating the cryptic message.\0"
+    "Hmmm, this looks like a clue, which means it\'ll cost you 10 points to\nread it.  Should I go ahead and read it anyway?\0"
+    "It says, \"There is a way out of this place.  Do you need any more\ninformation to escape?  Sorry, but this initial hint is all you get.\"\0"
+    "I\'m afraid I don\'t understand.\0"
+    "Your hand passes through it as though it weren\'t there.\0"
+    "You prod the nearest dwarf, who wakes up grumpily, takes one look at\nyou, curses, and grabs for his axe.\0"
+    "Is this acceptable?\0"
+    "The ogre doesn\'t appear to be hungry.\0"
+    "The ogre, who despite his bulk is quite agile, easily dodges your\nattack.  He seems almost amused by your puny effort.\0"
+    "The ogre, distracted by your rush, is struck by the knife.  With a\nblood-curdling yell he turns and bounds after the dwarves, who flee\nin panic.  You are left alone in the room.\0"
+    "The ogre, distracted by your rush, is struck by the knife.  With a\nblood-curdling yell he turns and bounds after the dwarf, who flees\nin panic.  You are left alone in the room.\0"
+    "The bird flies about agitatedly for a moment.\0"
+    "The bird flies agitatedly about the cage.\0"
+    "The bird flies about agitatedly for a moment, then disappears through\nthe crack.  It reappears shortly, carrying in its beak a jade\nnecklace, which it drops at your feet.\0"
+    "You empty the bottle into the urn, which promptly ejects the water\nwith uncanny accuracy, squirting you directly between the eyes.\0"
+    "Your bottle is now empty and the urn is full of oil.\0"
+    "The urn is already full of oil.\0"
+    "There\'s no way to get the oil out of the urn.\0"
+    "The urn is far too firmly embedded for your puny strength to budge it.\0"
+    "As you rub the urn, there is a flash of light and a genie appears.\nHis aspect is stern as he advises: \"One who wouldst traffic in\nprecious stones must first learn to recognize the signals thereof.\"\nHe wrests the urn from the stone, leaving a small cavity.  Turning to\nface you again, he fixes you with a steely eye and intones: \"Caution!\"\nGenie and urn vanish in a cloud of amber smoke.  The smoke condenses\nto form a rare amber gemstone, resting in the cavity in the rock.\0"
+    "I suppose you collect doughnut holes, too?\0"
+    "The gem fits easily into the cavity.\0"
+    "The persian rug stiffens and rises a foot or so off the ground.\0"
+    "The persian rug draped over your shoulder seems to wriggle for a\nmoment, but then subsides.\0"
+    "The persian rug settles gently to the ground.\0"
+    "The rug hovers stubbornly where it is.\0"
+    "The rug does not appear inclined to cooperate.\0"
+    "If you mean to use the persian rug, it does not appear inclined to\ncooperate.\0"
+    "Though you flap your arms furiously, it is to no avail.\0"
+    "You board the persian rug, which promptly whisks you across the chasm.\nYou have time for a fleeting glimpse of a two thousand foot drop to a\nmighty river; then you find yourself on the other side.\0"
+    "The rug ferries you back across the chasm.\0"
+    "All is silent.\0"
+    "The stream is gurgling placidly.\0"
+    "The wind whistles coldly past your ears.\0"
+    "The stream splashes loudly into the pool.\0"
+    "You are unable to make anything of the splashing noise.\0"
+    "You can hear the murmuring of the beanstalks and the snoring of the\ndwarves.\0"
+    "A loud hissing emanates from the snake pit.\0"
+    "The air is filled with a dull rumbling sound.\0"
+    "The roar is quite loud here.\0"
+    "The roaring is so loud that it drowns out all other sound.\0"
+    "The bird eyes you suspiciously and flutters away.  A moment later you\nfeel something wet land on your head, but upon looking up you can see\nno sign of the culprit.\0"
+    "There are only a few drops--not enough to carry.\0"
+    "(Uh, y\'know, that wasn\'t very bright.)\0"
+    "It\'s a pity you took so long about it.\0"
+    "Upstream or downstream?\0"
+    "The waters are crashing loudly against the shore.\0"
+    "%d of them throw knives at you!\0"
+    "%d of them get you!\0"
+    "One of them gets you!\0"
+    "None of them hits you!\0"
+    "Sorry, I don\'t know the word \"%s\".\0"
+    "What do you want to do with the %s?\0"
+    "I see no %s here.\0"
+    "%s what?\0"
+    "Okay, \"%s\".\0"
+    "You have garnered %d out of a possible %d points, using %d turn%S.\0"
+    "I can suspend your Adventure for you so that you can resume later, but\nit will cost you 5 points.\0"
+    "I am prepared to give you a hint, but it will cost you %d point%S.\0"
+    "You scored %d out of a possible %d, using %d turn%S.\0"
+    "To achieve the next higher rating, you need %d more point%S.\0"
+    "To achieve the next higher rating would be a neat trick!\nCongratulations!!\0"
+    "You just went off my scale!!\0"
+    "To resume your Adventure, start a new game and then say \"RESUME\".\0"
+    "To resume an earlier Adventure, you must abandon the current one.\0"
+    "I\'m sorry, but that Adventure was begun using Version %d.%d of the\nsave file format, and this program uses Version %d.%d.  You must find an instance\nusing that other version in order to resume that Adventure.\0"
+    "Sorry, but the path twisted and turned so much that I can\'t figure\nout which way to go to get back.\0"
+    "You don\'t have to say \"go\" every time; just specify a direction or, if\nit\'s nearby, name the place to which you wish to move.\0"
+    "This command requires a numeric argument.\0"
+    "You are obviously a rank amateur.  Better luck next time.\0"
+    "Your score qualifies you as a novice class adventurer.\0"
+    "You have achieved the rating: \"Experienced Adventurer\".\0"
+    "You may now consider yourself a \"Seasoned Adventurer\".\0"
+    "You have reached \"Junior Master\" status.\0"
+    "Your score puts you in Master Adventurer Class C.\0"
+    "Your score puts you in Master Adventurer Class B.\0"
+    "Your score puts you in Master Adventurer Class A.\0"
+    "All of Adventuredom gives tribute to you, Adventurer Grandmaster!\0"
+    "\'Adventuredom stands in awe -- you have now joined the ranks of the\n       W O R L D   C H A M P I O N   A D V E N T U R E R S !\nIt may interest you to know that the Dungeon-Master himself has, to\nmy knowledge, never achieved this threshhold in fewer than 330 turns.\'\0"
+    "Tsk!  A wizard wouldn\'t have to take 350 turns.  This is going to cost\nyou a couple of points.\0"
+    "500 turns?  That\'s another few points you\'ve lost.\0"
+    "Are you still at it?  Five points off for exceeding 1000 turns!\0"
+    "Good grief, don\'t you *EVER* give up?  Do you realize you\'ve spent\nover 2500 turns at this?  That\'s another ten points off, a total of\ntwenty points lost for taking so long.\0"
+    "You\'re in front of building.\0"
+    "You are standing at the end of a road before a small brick building.\nAround you is a forest.  A small stream flows out of the building and\ndown a gully.\0"
+    "You\'re at hill in road.\0"
+    "You have walked up a hill, still in the forest.  The road slopes back\ndown the other side of the hill.  There is a building in the distance.\0"
+    "You\'re inside building.\0"
+    "You are inside a building, a well house for a large spring.\0"
+    "You\'re in valley.\0"
+    "You are in a valley in the forest beside a stream tumbling along a\nrocky bed.\0"
+    "You\'re at end of road.\0"
+    "The road, which approaches from the east, ends here amid the trees.\0"
+    "You\'re at cliff.\0"
+    "The forest thins out here to reveal a steep cliff.  There is no way\ndown, but a small ledge can be seen to the west across the chasm.\0"
+    "You\'re at slit in streambed.\0"
+    "At your feet all the water of the stream splashes into a 2-inch slit\nin the rock.  Downstream the streambed is bare rock.\0"
+    "You\'re outside grate.\0"
+    "You are in a 20-foot depression floored with bare dirt.  Set into the\ndirt is a strong steel grate mounted in concrete.  A dry streambed\nleads into the depression.\0"
+    "You\'re below the grate.\0"
+    "You are in a small chamber beneath a 3x3 steel grate to the surface.\nA low crawl over cobbles leads inward to the west.\0"
+    "You\'re in cobble crawl.\0"
+    "You are crawling over cobbles in a low passage.  There is a dim light\nat the east end of the passage.\0"
+    "You\'re in debris room.\0"
+    "You are in a debris room filled with stuff washed in from the surface.\nA low wide passage with cobbles becomes plugged with mud and debris\nhere, but an awkward canyon leads upward and west.  In the mud someone\nhas scrawled, \"MAGIC WORD XYZZY\".\0"
+    "You are in an awkward sloping east/west canyon.\0"
+    "You\'re in bird chamber.\0"
+    "You are in a splendid chamber thirty feet high.  The walls are frozen\nrivers of orange stone.  An awkward canyon and a good passage exit\nfrom east and west sides of the chamber.\0"
+    "You\'re at top of small pit.\0"
+    "At your feet is a small pit breathing traces of white mist.  An east\npassage ends here except for a small crack leading on.\0"
+    "You\'re in Hall of Mists.\0"
+    "You are at one end of a vast hall stretching forward out of sight to\nthe west.  There are openings to either side.  Nearby, a wide stone\nstaircase leads downward.  The hall is filled with wisps of white mist\nswaying to and fro almost as if alive.  A cold wind blows up the\nstaircase.  There is a passage at the top of a dome behind you.\0"
+    "The crack is far too small for you to follow.  At its widest it is\nbarely wide enough to admit your foot.\'\0"
+    "You\'re on east bank of fissure.\0"
+    "You are on the east bank of a fissure slicing clear across the hall.\nThe mist is quite thick here, and the fissure is too wide to jump.\0"
+    "You\'re in nugget-of-gold room.\0"
+    "This is a low room with a crude note on the wall.  The note says,\n\"You won\'t get it up the steps\".\0"
+    "You\'re in Hall of Mt King.\0"
+    "You are in the Hall of the Mountain King, with passages off in all\ndirections.\0"
+    "You are at the bottom of the pit with a broken neck.\0"
+    "You didn\'t make it.\0"
+    "The dome is unclimbable.\0"
+    "You\'re at west end of Twopit Room.\0"
+    "You are at the west end of the Twopit Room.  There is a large hole in\nthe wall above the pit at this end of the room.\0"
+    "You\'re in east pit.\0"
+    "You are at the bottom of the eastern pit in the Twopit Room.  There is\na small pool of oil in one corner of the pit.\0"
+    "You\'re in west pit.\0"
+    "You are at the bottom of the western pit in the Twopit Room.  There is\na large hole in the wall about 25 feet above you.\0"
+    "You clamber up the plant and scurry through the hole at the top.\0"
+    "You\'re on west bank of fissure.\0"
+    "You are on the west side of the fissure in the Hall of Mists.\0"
+    "You\'re in n/s passage above e/w passage.\0"
+    "You are in a low n/s passage at a hole in the floor.  The hole goes\ndown to an e/w passage.\0"
+    "You are in the south side chamber.\0"
+    "You\'re in the west side chamber.\0"
+    "You are in the west side chamber of the Hall of the Mountain King.\nA passage continues west and up here.\0"
+    "\0"
+    "You can\'t get by the snake.\0"
+    "You\'re at \"Y2\".\0"
+    "You are in a large room, with a passage to the south, a passage to the\nwest, and a wall of broken rock to the east.  There is a large \"Y2\" on\na rock in the room\'s center.\0"
+    "You are in a jumble of rock, with cracks everywhere.\0"
+    "You\'re at window on pit.\0"
+    "You\'re at a low window overlooking a huge pit, which extends up out of\nsight.  A floor is indistinctly visible over 50 feet below.  Traces of\nwhite mist cover the floor of the pit, becoming thicker to the right.\nMarks in the dust around the window would seem to indicate that\nsomeone has been here recently.  Directly across the pit from you and\n25 feet away there is a similar window looking into a lighted room.  A\nshadowy figure can be seen there peering back at you.\0"
+    "You\'re in dirty passage.\0"
+    "You are in a dirty broken passage.  To the east is a crawl.  To the\nwest is a large passage.  Above you is a hole to another passage.\0"
+    "You\'re at brink of small pit.\0"
+    "You are on the brink of a small clean climbable pit.  A crawl leads\nwest.\0"
+    "You\'re at bottom of pit with stream.\0"
+    "You are in the bottom of a small pit with a little stream, which\nenters and exits through tiny slits.\0"
+    "You\'re in dusty rock room.\0"
+    "You are in a large room full of dusty rocks.  There is a big hole in\nthe floor.  There are cracks everywhere, and a passage leading east.\0"
+    "You have crawled through a very low wide passage parallel to and north\nof the Hall of Mists.\0"
+    "You\'re at west end of Hall of Mists.\0"
+    "You are at the west end of the Hall of Mists.  A low wide crawl\ncontinues west and another goes north.  To the south is a little\npassage 6 feet off the floor.\0"
+    "You are in a maze of twisty little passages, all alike.\0"
+    "Dead end\0"
+    "You\'re at brink of pit.\0"
+    "You are on the brink of a thirty foot pit with a massive orange column\ndown one wall.  You could climb down here but you could not get back\nup.  The maze continues at this level.\0"
+    "You\'re at east end of long hall.\0"
+    "You are at the east end of a very long hall apparently without side\nchambers.  To the east a low wide crawl slants up.  To the north a\nround two foot hole slants down.\0"
+    "You\'re at west end of long hall.\0"
+    "You are at the west end of a very long featureless hall.  The hall\njoins up with a narrow north/south passage.\0"
+    "You are at a crossover of a high n/s passage and a low e/w one.\0"
+    "You\'re at complex junction.\0"
+    "You are at a complex junction.  A low hands and knees passage from the\nnorth joins a higher crawl from the east to make a walking passage\ngoing west.  There is also a large room above.  The air is damp here.\0"
+    "You\'re in Bedquilt.\0"
+    "You are in Bedquilt, a long east/west passage with holes everywhere.\nTo explore at random select north, south, up, or down.\0"
+    "You\'re in Swiss Cheese Room.\0"
+    "You are in a room whose walls resemble swiss cheese.  Obvious passages\ngo west, east, ne, and nw.  Part of the room is occupied by a large\nbedrock block.\0"
+    "You\'re at east end of Twopit Room.\0"
+    "You are at the east end of the Twopit Room.  The floor here is\nlittered with thin rock slabs, which make it easy to descend the pits.\nThere is a path here bypassing the pits to connect passages from east\nand west.  There are holes all over, but the only big one is on the\nwall directly over the west pit where you can\'t get to it.\0"
+    "You\'re in Slab Room.\0"
+    "You are in a large low circular chamber whose floor is an immense slab\nfallen from the ceiling (Slab Room).  East and west there once were\nlarge passages, but they are now filled with boulders.  Low small\npassages go north and south, and the south one quickly bends west\naround the boulders.\0"
+    "You are in a secret n/s canyon above a large room.\0"
+    "You are in a secret n/s canyon above a sizable passage.\0"
+    "You\'re at junction of three secret canyons.\0"
+    "You are in a secret canyon at a junction of three canyons, bearing\nnorth, south, and se.  The north one is as tall as the other two\ncombined.\0"
+    "You\'re in large low room.\0"
+    "You are in a large low room.  Crawls lead north, se, and sw.\0"
+    "Dead end crawl.\0"
+    "You\'re in secret e/w canyon above tight canyon.\0"
+    "You are in a secret canyon which here runs e/w.  It crosses over a\nvery tight canyon 15 feet below.  If you go down you may not be able\nto get back up.\0"
+    "You are at a wide place in a very tight n/s canyon.\0"
+    "The canyon here becomes too tight to go further south.\0"
+    "You are in a tall e/w canyon.  A low tight crawl goes 3 feet north and\nseems to open up.\0"
+    "The canyon runs into a mass of boulders -- dead end.\0"
+    "The stream flows out through a pair of 1 foot diameter sewer pipes.\nIt would be advisable to use the exit.\0"
+    "You\'re in narrow corridor.\0"
+    "You are in a long, narrow corridor stretching out of sight to the\nwest.  At the eastern end is a hole through which you can see a\nprofusion of leaves.\0"
+    "There is nothing here to climb.  Use \"up\" or \"out\" to leave the pit.\0"
+    "You have climbed up the plant and out of the pit.\0"
+    "You\'re at steep incline above large room.\0"
+    "You are at the top of a steep incline above a large room.  You could\nclimb down here, but you would not be able to climb up.  There is a\npassage leading back to the north.\0"
+    "You\'re in Giant Room.\0"
+    "You are in the Giant Room.  The ceiling here is too high up for your\nlamp to show it.  Cavernous passages lead east, north, and south.  On\nthe west wall is scrawled the inscription, \"FEE FIE FOE FOO\" [sic].\0"
+    "The passage here is blocked by a recent cave-in.\0"
+    "You are at one end of an immense north/south passage.\0"
+    "You\'re in cavern with waterfall.\0"
+    "You are in a magnificent cavern with a rushing stream, which cascades\nover a sparkling waterfall into a roaring whirlpool which disappears\nthrough a hole in the floor.  Passages exit to the south and west.\0"
+    "You\'re in Soft Room.\0"
+    "You are in the Soft Room.  The walls are covered with heavy curtains,\nthe floor with a thick pile carpet.  Moss covers the ceiling.\0"
+    "You\'re in Oriental Room.\0"
+    "This is the Oriental Room.  Ancient oriental cave drawings cover the\nwalls.  A gently sloping passage leads upward to the north, another\npassage leads se, and a hands and knees crawl leads west.\0"
+    "You\'re in misty cavern.\0"
+    "You are following a wide path around the outer edge of a large cavern.\nFar below, through a heavy white mist, strange splashing noises can be\nheard.  The mist rises up through a fissure in the ceiling.  The path\nexits to the south and west.\0"
+    "You\'re in alcove.\0"
+    "You are in an alcove.  A small nw path seems to widen after a short\ndistance.  An extremely tight tunnel leads east.  It looks like a very\ntight squeeze.  An eerie light can be seen at the other end.\0"
+    "You\'re in Plover Room.\0"
+    "You\'re in a small chamber lit by an eerie green light.  An extremely\nnarrow tunnel exits to the west.  A dark corridor leads ne.\0"
+    "You\'re in dark-room.\0"
+    "You\'re in the dark-room.  A corridor leading south is the only exit.\0"
+    "You\'re in arched hall.\0"
+    "You are in an arched hall.  A coral passage once continued up and east\nfrom here, but is now blocked by debris.  The air smells of sea water.\0"
+    "You\'re in Shell Room.\0"
+    "You\'re in a large room carved out of sedimentary rock.  The floor and\nwalls are littered with bits of shells imbedded in the stone.  A\nshallow passage proceeds downward, and a somewhat steeper one leads\nup.  A low hands and knees passage enters from the south.\0"
+    "You are in a long sloping corridor with ragged sharp walls.\0"
+    "You are in a cul-de-sac about eight feet across.\0"
+    "You\'re in anteroom.\0"
+    "You are in an anteroom leading to a large passage to the east.  Small\npassages go west and up.  The remnants of recent digging are evident.\nA sign in midair here says \"Cave under construction beyond this point.\nProceed at own risk.  [Witt Construction Company]\"\0"
+    "You are in a maze of twisty little passages, all different.\0"
+    "You\'re at Witt\'s End.\0"
+    "You are at Witt\'s End.  Passages lead off in *ALL* directions.\0"
+    "You\'re in Mirror Canyon.\0"
+    "You are in a north/south canyon about 25 feet across.  The floor is\ncovered by white mist seeping in from the north.  The walls extend\nupward for well over 100 feet.  Suspended from some unseen point far\nabove you, an enormous two-sided mirror is hanging parallel to and\nmidway between the canyon walls.  (The mirror is obviously provided\nfor the use of the dwarves who, as you know, are extremely vain.)  A\nsmall window can be seen in either wall, some fifty feet up.\0"
+    "You\'re at a low window overlooking a huge pit, which extends up out of\nsight.  A floor is indistinctly visible over 50 feet below.  Traces of\nwhite mist cover the floor of the pit, becoming thicker to the left.\nMarks in the dust around the window would seem to indicate that\nsomeone has been here recently.  Directly across the pit from you and\n25 feet away there is a similar window looking into a lighted room.  A\nshadowy figure can be seen there peering back at you.\0"
+    "You\'re at top of stalactite.\0"
+    "A large stalactite extends from the roof and almost reaches the floor\nbelow.  You could climb down it, and jump from it to the floor, but\nhaving done so you would be unable to reach it to climb back up.\0"
+    "You are in a little maze of twisting passages, all different.\0"
+    "You\'re at reservoir.\0"
+    "You are at the edge of a large underground reservoir.  An opaque cloud\nof white mist fills the room and rises rapidly upward.  The lake is\nfed by a stream, which tumbles out of a hole in the wall about 10 feet\noverhead and splashes noisily into the water somewhere within the\nmist.  There is a passage going back toward the south.\0"
+    "You\'re at ne end.\0"
+    "You are at the northeast end of an immense room, even larger than the\nGiant Room.  It appears to be a repository for the \"Adventure\"\nprogram.  Massive torches far overhead bathe the room with smoky\nyellow light.  Scattered about you can be seen a pile of bottles (all\nof them empty), a nursery of young beanstalks murmuring quietly, a bed\nof oysters, a bundle of black rods with rusty stars on their ends, and\na collection of brass lanterns.  Off to one side a great many dwarves\nare sleeping on the floor, snoring loudly.  A notice nearby reads: \"Do\nnot disturb the dwarves!\"  An immense mirror is hanging against one\nwall, and stretches to the other end of the room, where various other\nsundry objects can be glimpsed dimly in the distance.\0"
+    "You\'re at sw end.\0"
+    "You are at the southwest end of the repository.  To one side is a pit\nfull of fierce green snakes.  On the other side is a row of small\nwicker cages, each of which contains a little sulking bird.  In one\ncorner is a bundle of black rods with rusty marks on their ends.  A\nlarge number of velvet pillows are scattered about on the floor.  A\nvast mirror stretches off to the northeast.  At your feet is a large\nsteel grate, next to which is a sign that reads, \"Treasure Vault.\nKeys in main office.\"\0"
+    "You\'re on sw side of chasm.\0"
+    "You are on one side of a large, deep chasm.  A heavy white mist rising\nup from below obscures all view of the far side.  A sw path leads away\nfrom the chasm into a winding corridor.\0"
+    "You\'re in sloping corridor.\0"
+    "You are in a long winding corridor sloping out of sight in both\ndirections.\0"
+    "You are in a secret canyon which exits to the north and east.\0"
+    "You\'re on ne side of chasm.\0"
+    "You are on the far side of the chasm.  A ne path leads away from the\nchasm on this side.\0"
+    "You\'re in corridor.\0"
+    "You\'re in a long east/west corridor.  A faint rumbling noise can be\nheard in the distance.\0"
+    "You\'re at fork in path.\0"
+    "The path forks here.  The left fork leads northeast.  A dull rumbling\nseems to get louder in that direction.  The right fork leads southeast\ndown a gentle slope.  The main corridor enters from the west.\0"
+    "You\'re at junction with warm walls.\0"
+    "The walls are quite warm here.  From the north can be heard a steady\nroar, so loud that the entire cave seems to be trembling.  Another\npassage leads south, and a low crawl goes east.\0"
+    "You\'re at breath-taking view.\0"
+    "You are on the edge of a breath-taking view.  Far below you is an\nactive volcano, from which great gouts of molten lava come surging\nout, cascading back down into the depths.  The glowing rock fills the\nfarthest reaches of the cavern with a blood-red glare, giving every-\nthing an eerie, macabre appearance.  The air is filled with flickering\nsparks of ash and a heavy smell of brimstone.  The walls are hot to\nthe touch, and the thundering of the volcano drowns out all other\nsounds.  Embedded in the jagged roof far overhead are myriad twisted\nformations composed of pure white alabaster, which scatter the murky\nlight into sinister apparitions upon the walls.  To one side is a deep\ngorge, filled with a bizarre chaos of tortured rock which seems to\nhave been crafted by the devil himself.  An immense river of fire\ncrashes out from the depths of the volcano, burns its way through the\ngorge, and plummets into a bottomless pit far off to your left.  To\nthe right, an immense geyser of blistering steam erupts continuously\nfrom a barren island in the center of a sulfurous lake, which bubbles\nominously.  The far right wall is aflame with an incandescence of its\nown, which lends an additional infernal splendor to the already\nhellish scene.  A dark, foreboding passage exits to the south.\0"
+    "You\'re in Chamber of Boulders.\0"
+    "You are in a small chamber filled with large boulders.  The walls are\nvery warm, causing the air in the room to be almost stifling from the\nheat.  The only exit is a crawl heading west, through which is coming\na low rumbling.\0"
+    "You\'re in limestone passage.\0"
+    "You are walking along a gently sloping north/south passage lined with oddly shaped limestone formations.\0"
+    "You\'re in front of Barren Room.\0"
+    "You are standing at the entrance to a large, barren room.  A notice\nabove the entrance reads:  \"Caution!  Bear in room!\"\0"
+    "You\'re in Barren Room.\0"
+    "You are inside a barren room.  The center of the room is completely\nempty except for some dust.  Marks in the dust lead away toward the\nfar end of the room.  The only exit is the way you came in.\0"
+    "You are in a maze of twisting little passages, all different.\0"
+    "You are in a little maze of twisty passages, all different.\0"
+    "You are in a twisting maze of little passages, all different.\0"
+    "You are in a twisting little maze of passages, all different.\0"
+    "You are in a twisty little maze of passages, all different.\0"
+    "You are in a twisty maze of little passages, all different.\0"
+    "You are in a little twisty maze of passages, all different.\0"
+    "You are in a maze of little twisting passages, all different.\0"
+    "You are in a maze of little twisty passages, all different.\0"
+    "You are in a long, rough-hewn, north/south corridor.\0"
+    "You are in a large chamber with passages to the west and north.\0"
+    "You are in the ogre\'s storeroom.  The only exit is to the south.\0"
+    "You are wandering aimlessly through the forest.\0"
+    "You\'re on ledge.\0"
+    "You are on a small ledge on one face of a sheer cliff.  There are no\npaths away from the ledge.  Across the chasm is a small clearing\nsurrounded by forest.\0"
+    "You\'re at bottom of reservoir.\0"
+    "You are walking across the bottom of the reservoir.  Walls of water\nrear up on either side.  The roar of the water cascading past is\nnearly deafening, and the mist is so thick you can barely see.\0"
+    "You\'re north of reservoir.\0"
+    "You are at the northern edge of the reservoir.  A northwest passage\nleads sharply up from here.\0"
+    "You are scrambling along a treacherously steep, rocky passage.\0"
+    "You are on a very steep incline, which widens at it goes upward.\0"
+    "You\'re at base of cliff.\0"
+    "You are at the base of a nearly vertical cliff.  There are some\nslim footholds which would enable you to climb up, but it looks\nextremely dangerous.  Here at the base of the cliff lie the remains\nof several earlier adventurers who apparently failed to make it.\0"
+    "You are climbing along a nearly vertical cliff.\0"
+    "Just as you reach the top, your foot slips on a loose rock and you\ntumble several hundred feet to join the other unlucky adventurers.\0"
+    "Just as you reach the top, your foot slips on a loose rock and you\nmake one last desperate grab.  Your luck holds, as does your grip.\nWith an enormous heave, you lift yourself to the ledge above.\0"
+    "You\'re at top of cliff.\0"
+    "You are on a small ledge at the top of a nearly vertical cliff.\nThere is a low crawl leading off to the northeast.\0"
+    "You have reached a dead end.\0"
+    "There is now one more gruesome aspect to the spectacular vista.\0"
+    ">>Foof!<<\0"
+    "keys\0"
+    "key\0"
+    "Set of keys\0"
+    "There are some keys on the ground here.\0"
+    "lamp\0"
+    "lante\0"
+    "Brass lantern\0"
+    "There is a shiny brass lamp nearby.\0"
+    "There is a lamp shining nearby.\0"
+    "Your lamp is now off.\0"
+    "Your lamp is now on.\0"
+    "grate\0"
+    "*grate\0"
+    "The grate is locked.\0"
+    "The grate is open.\0"
+    "The grate is now locked.\0"
+    "The grate is now unlocked.\0"
+    "cage\0"
+    "Wicker cage\0"
+    "There is a small wicker cage discarded nearby.\0"
+    "rod\0"
+    "Black rod\0"
+    "A three foot black rod with a rusty star on an end lies nearby.\0"
+    "A three foot black rod with a rusty mark on an end lies nearby.\0"
+    "steps\0"
+    "*steps\0"
+    "Rough stone steps lead down the pit.\0"
+    "Rough stone steps lead up the dome.\0"
+    "bird\0"
+    "Little bird in cage\0"
+    "A cheerful little bird is sitting here singing.\0"
+    "There is a little bird in the cage.\0"
+    "The bird\'s singing is quite melodious.\0"
+    "The bird does not seem inclined to sing while in the cage.\0"
+    "It almost seems as though the bird is trying to tell you something.\0"
+    "To your surprise, you can understand the bird\'\'s chirping; it is\nsinging about the joys of its forest home.\0"
+    "The bird is singing to you in gratitude for your having returned it to\nits home.  In return, it informs you of a magic word which it thinks\nyou may find useful somewhere near the Hall of Mists.  The magic word\nchanges frequently, but for now the bird believes it is \"%s\".  You\nthank the bird for this information, and it flies off into the forest.\0"
+    "door\0"
+    "*rusty door\0"
+    "The way north is barred by a massive, rusty, iron door.\0"
+    "The way north leads through a massive, rusty, iron door.\0"
+    "The hinges are quite thoroughly rusted now and won\'t budge.\0"
+    "The oil has freed up the hinges so that the door will now move,\nalthough it requires some effort.\0"
+    "pillo\0"
+    "velve\0"
+    "Velvet pillow\0"
+    "A small velvet pillow lies on the floor.\0"
+    "snake\0"
+    "*snake\0"
+    "A huge green fierce snake bars the way!\0"
+    "The snake is hissing venomously.\0"
+    "fissu\0"
+    "*fissure\0"
+    "A crystal bridge spans the fissure.\0"
+    "The crystal bridge has vanished!\0"
+    "A crystal bridge now spans the fissure.\0"
+    "table\0"
+    "*stone tablet\0"
+    "A massive stone tablet imbedded in the wall reads:\n\"Congratulations on bringing light into the dark-room!\"\0"
+    "\"Congratulations on bringing light into the dark-room!\"\0"
+    "clam\0"
+    "Giant clam  >GRUNT!<\0"
+    "There is an enormous clam here with its shell tightly closed.\0"
+    "The clam is as tight-mouthed as a, er, clam.\0"
+    "oyste\0"
+    "Giant oyster  >GROAN!<\0"
+    "There is an enormous oyster here with its shell tightly closed.\0"
+    "Interesting.  There seems to be something written on the underside of\nthe oyster.\0"
+    "Even though it\'s an oyster, the critter\'s as tight-mouthed as a clam.\0"
+    "It says the same thing it did before.  Hm, maybe it\'s a pun?\0"
+    "magaz\0"
+    "issue\0"
+    "spelu\0"
+    "\"spel\0"
+    "\"Spelunker Today\"\0"
+    "There are a few recent issues of \"Spelunker Today\" magazine here.\0"
+    "I\'m afraid the magazine is written in dwarvish.  But pencilled on one\ncover you see, \"Please leave the magazines at the construction site.\"\0"
+    "dwarf\0"
+    "dwarv\0"
+    "knife\0"
+    "knive\0"
+    "food\0"
+    "ratio\0"
+    "Tasty food\0"
+    "There is food here.\0"
+    "bottl\0"
+    "jar\0"
+    "Small bottle\0"
+    "There is a bottle of water here.\0"
+    "There is an empty bottle here.\0"
+    "There is a bottle of oil here.\0"
+    "Your bottle is now full of water.\0"
+    "The bottle of water is now empty.\0"
+    "Your bottle is now full of oil.\0"
+    "water\0"
+    "h2o\0"
+    "Water in the bottle\0"
+    "oil\0"
+    "Oil in the bottle\0"
+    "mirro\0"
+    "*mirror\0"
+    "You strike the mirror a resounding blow, whereupon it shatters into a\nmyriad tiny fragments.\0"
+    "plant\0"
+    "beans\0"
+    "*plant\0"
+    "There is a tiny little plant in the pit, murmuring \"water, water, ...\"\0"
+    "There is a 12-foot-tall beanstalk stretching up out of the pit,\nbellowing \"WATER!! WATER!!\"\0"
+    "There is a gigantic beanstalk stretching all the way up to the hole.\0"
+    "The plant continues to ask plaintively for water.\0"
+    "The plant continues to demand water.\0"
+    "The plant now maintains a contented silence.\0"
+    "You\'ve over-watered the plant!  It\'s shriveling up!  And now . . .\0"
+    "The plant spurts into furious growth for a few seconds.\0"
+    "The plant grows explosively, almost filling the bottom of the pit.\0"
+    "*phony plant\0"
+    "The top of a 12-foot-tall beanstalk is poking out of the west pit.\0"
+    "There is a huge beanstalk growing out of the west pit up to the hole.\0"
+    "stala\0"
+    "*stalactite\0"
+    "shado\0"
+    "figur\0"
+    "windo\0"
+    "*shadowy figure and/or window\0"
+    "The shadowy figure seems to be trying to attract your attention.\0"
+    "axe\0"
+    "Dwarf\'s axe\0"
+    "There is a little axe here.\0"
+    "There is a little axe lying beside the bear.\0"
+    "The axe misses and lands near the bear where you can\'t get at it.\0"
+    "drawi\0"
+    "*cave drawings\0"
+    "pirat\0"
+    "genie\0"
+    "djinn\0"
+    "*pirate/genie\0"
+    "drago\0"
+    "*dragon\0"
+    "A huge green fierce dragon bars the way!\0"
+    "The blood-specked body of a huge green dead dragon lies to one side.\0"
+    "The body of a huge green dead dragon is lying off to one side.\0"
+    "The dragon\'s ominous hissing does not bode well for you.\0"
+    "The dragon is, not surprisingly, silent.\0"
+    "Congratulations!  You have just vanquished a dragon with your bare\nhands!  (Unbelievable, isn\'t it?)\0"
+    "Your head buzzes strangely for a moment.\0"
+    "chasm\0"
+    "*chasm\0"
+    "A rickety wooden bridge extends across the chasm, vanishing into the\nmist.  A notice posted on the bridge reads, \"Stop! Pay troll!\"\0"
+    "The wreckage of a bridge (and a dead bear) can be seen at the bottom\nof the chasm.\0"
+    "Just as you reach the other side, the bridge buckles beneath the\nweight of the bear, which was still following you around.  You\nscrabble desperately for support, but as the bridge collapses you\nstumble back and fall into the chasm.\0"
+    "troll\0"
+    "*troll\0"
+    "A burly troll stands by the bridge and insists you throw him a\ntreasure before you may cross.\0"
+    "The troll steps out from beneath the bridge and blocks your way.\0"
+    "The troll sounds quite adamant in his demand for a treasure.\0"
+    "The bear lumbers toward the troll, who lets out a startled shriek and\nscurries away.  The bear soon gives up the pursuit and wanders back.\0"
+    "*phony troll\0"
+    "The troll is nowhere to be seen.\0"
+    "bear\0"
+    "There is a ferocious cave bear eying you from the far end of the room!\0"
+    "There is a gentle cave bear sitting placidly in one corner.\0"
+    "There is a contented-looking bear wandering about nearby.\0"
+    "The bear eagerly wolfs down your food, after which he seems to calm\ndown considerably and even becomes rather friendly.\0"
+    "messa\0"
+    "*message in second maze\0"
+    "There is a message scrawled in the dust in a flowery script, reading:\n\"This is not the maze where the pirate leaves his treasure chest.\"\0"
+    "\"This is not the maze where the pirate leaves his treasure chest.\"\0"
+    "volca\0"
+    "geyse\0"
+    "*volcano and/or geyser\0"
+    "machi\0"
+    "vendi\0"
+    "*vending machine\0"
+    "There is a massive and somewhat battered vending machine here.  The\ninstructions on it read: \"Drop coins here to receive fresh batteries.\"\0"
+    "There is a massive vending machine here, swung back to reveal a\nsouthward passage.\0"
+    "\"Drop coins here to receive fresh batteries.\"\0"
+    "The vending machine swings back to block the passage.\0"
+    "As you strike the vending machine, it pivots backward along with a\nsection of wall, revealing a dark passage leading south.\0"
+    "batte\0"
+    "Batteries\0"
+    "There are fresh batteries here.\0"
+    "Some worn-out batteries have been discarded nearby.\0"
+    "carpe\0"
+    "moss\0"
+    "*carpet and/or moss and/or curtains\0"
+    "ogre\0"
+    "*ogre\0"
+    "A formidable ogre bars the northern exit.\0"
+    "The ogre is apparently the strong, silent type.\0"
+    "urn\0"
+    "*urn\0"
+    "A small urn is embedded in the rock.\0"
+    "A small urn full of oil is embedded in the rock.\0"
+    "A small oil flame extrudes from an urn embedded in the rock.\0"
+    "The urn is empty and will not light.\0"
+    "The urn is now dark.\0"
+    "The urn is now lit.\0"
+    "cavit\0"
+    "*cavity\0"
+    "There is a small urn-shaped cavity in the rock.\0"
+    "blood\0"
+    "*blood\0"
+    "reser\0"
+    "*reservoir\0"
+    "The waters have parted to form a narrow path across the reservoir.\0"
+    "The waters crash together again.\0"
+    "appen\0"
+    "lepor\0"
+    "Leporine appendage\0"
+    "Your keen eye spots a severed leporine appendage lying on the ground.\0"
+    "mud\0"
+    "*mud\0"
+    "\"MAGIC WORD XYZZY\"\0"
+    "note\0"
+    "*note\0"
+    "\"You won\'t get it up the steps\"\0"
+    "sign\0"
+    "*sign\0"
+    "Cave under construction beyond this point.\n           Proceed at own risk.\n       [Witt Construction Company]\0"
+    "\"Treasure Vault.  Keys in main office.\"\0"
+    "gold\0"
+    "nugge\0"
+    "Large gold nugget\0"
+    "There is a large sparkling nugget of gold here!\0"
+    "diamo\0"
+    "Several diamonds\0"
+    "There are diamonds here!\0"
+    "silve\0"
+    "bars\0"
+    "Bars of silver\0"
+    "There are bars of silver here!\0"
+    "jewel\0"
+    "Precious jewelry\0"
+    "There is precious jewelry here!\0"
+    "coins\0"
+    "Rare coins\0"
+    "There are many coins here!\0"
+    "chest\0"
+    "box\0"
+    "treas\0"
+    "Treasure chest\0"
+    "The pirate\'s treasure chest is here!\0"
+    "eggs\0"
+    "egg\0"
+    "nest\0"
+    "Golden eggs\0"
+    "There is a large nest here, full of golden eggs!\0"
+    "The nest of golden eggs has vanished!\0"
+    "Done!\0"
+    "tride\0"
+    "Jeweled trident\0"
+    "There is a jewel-encrusted trident here!\0"
+    "vase\0"
+    "ming\0"
+    "shard\0"
+    "potte\0"
+    "Ming vase\0"
+    "There is a delicate, precious, ming vase here!\0"
+    "The floor is littered with worthless shards of pottery.\0"
+    "The vase is now resting, delicately, on a velvet pillow.\0"
+    "The ming vase drops with a delicate crash.\0"
+    "You have taken the vase and hurled it delicately to the ground.\0"
+    "emera\0"
+    "Egg-sized emerald\0"
+    "There is an emerald here the size of a plover\'s egg!\0"
+    "There is an emerald resting in a small cavity in the rock!\0"
+    "plati\0"
+    "pyram\0"
+    "Platinum pyramid\0"
+    "There is a platinum pyramid here, 8 inches on a side!\0"
+    "pearl\0"
+    "Glistening pearl\0"
+    "Off to one side lies a glistening pearl!\0"
+    "rug\0"
+    "persi\0"
+    "Persian rug\0"
+    "There is a persian rug spread out on the floor!\0"
+    "The dragon is sprawled out on a persian rug!!\0"
+    "There is a persian rug here, hovering in mid-air!\0"
+    "spice\0"
+    "Rare spices\0"
+    "There are rare spices here!\0"
+    "chain\0"
+    "Golden chain\0"
+    "There is a golden chain lying in a heap on the floor!\0"
+    "The bear is locked to the wall with a golden chain!\0"
+    "There is a golden chain locked to the wall!\0"
+    "ruby\0"
+    "Giant ruby\0"
+    "There is an enormous ruby here!\0"
+    "There is a ruby resting in a small cavity in the rock!\0"
+    "jade\0"
+    "neckl\0"
+    "Jade necklace\0"
+    "A precious jade necklace has been dropped here!\0"
+    "amber\0"
+    "gemst\0"
+    "Amber gemstone\0"
+    "There is a rare amber gemstone here!\0"
+    "There is an amber gemstone resting in a small cavity in the rock!\0"
+    "sapph\0"
+    "Star sapphire\0"
+    "A brilliant blue star sapphire is here!\0"
+    "There is a star sapphire resting in a small cavity in the rock!\0"
+    "ebony\0"
+    "statu\0"
+    "Ebony statuette\0"
+    "There is a richly-carved ebony statuette here!\0"
+    "Oh dear, you seem to have gotten yourself killed.  I might be able to\nhelp you out, but I\'ve never really done this before.  Do you want me\nto try to reincarnate you?\0"
+    "All right.  But don\'t blame me if something goes wr......\n                    --- POOF!! ---\nYou are engulfed in a cloud of orange smoke.  Coughing and gasping,\nyou emerge from the smoke and find....\0"
+    "You clumsy oaf, you\'ve done it again!  I don\'t know how long I can\nkeep this up.  Do you want me to try reincarnating you again?\0"
+    "Okay, now where did I put my orange smoke?....  >POOF!<\nEverything disappears in a dense cloud of orange smoke.\0"
+    "Now you\'ve really done it!  I\'m out of orange smoke!  You don\'t expect\nme to do a decent reincarnation without any orange smoke, do you?\0"
+    "Okay, if you\'re so smart, do it yourself!  I\'m leaving!\0"
+    "Are you trying to get into the cave?\0"
+    "The grate is very solid and has a hardened steel lock.  You cannot\nenter without a key, and there are no keys nearby.  I would recommend\nlooking elsewhere for the keys.\0"
+    "Are you trying to catch the bird?\0"
+    "Something about you seems to be frightening the bird.  Perhaps you\nmight figure out what it is.\0"
+    "Are you trying to somehow deal with the snake?\0"
+    "You can\'t kill the snake, or drive it away, or avoid it, or anything\nlike that.  There is a way to get by, but you don\'t have the necessary\nresources right now.\0"
+    "Do you need help getting out of the maze?\0"
+    "You can make the passages look less alike by dropping things.\0"
+    "Are you trying to explore beyond the plover room?\0"
+    "There is a way to explore that region without having to worry about\nfalling into a pit.  None of the objects available is immediately\nuseful in discovering the secret.\0"
+    "Do you need help getting out of here?\0"
+    "Don\'t go west.\n\0"
+    "Are you wondering what to do here?\0"
+    "This section is quite advanced.  Find the cave first.\n\0"
+    "Would you like to be shown out of the forest?\0"
+    "Go east ten times.  If that doesn\'t get you out, then go south, then\nwest twice, then south.\0"
+    "Do you need help dealing with the ogre?\0"
+    "There is nothing the presence of which will prevent you from defeating\nhim; thus it can\'t hurt to fetch everything you possibly can.\0"
+    "You\'re missing only one other treasure.  Do you need help finding it?\0"
+    "Once you\'ve found all the other treasures, it is no longer possible to\nlocate the one you\'re now missing.\0"
+    "road\0"
+    "hill\0"
+    "enter\0"
+    "upstr\0"
+    "downs\0"
+    "fores\0"
+    "forwa\0"
+    "conti\0"
+    "onwar\0"
+    "back\0"
+    "retur\0"
+    "retre\0"
+    "valle\0"
+    "stair\0"
+    "out\0"
+    "outsi\0"
+    "exit\0"
+    "leave\0"
+    "build\0"
+    "house\0"
+    "gully\0"
+    "strea\0"
+    "fork\0"
+    "bed\0"
+    "crawl\0"
+    "cobbl\0"
+    "inwar\0"
+    "insid\0"
+    "in\0"
+    "surfa\0"
+    "null\0"
+    "nowhe\0"
+    "dark\0"
+    "passa\0"
+    "tunne\0"
+    "low\0"
+    "canyo\0"
+    "awkwa\0"
+    "giant\0"
+    "view\0"
+    "upwar\0"
+    "up\0"
+    "u\0"
+    "above\0"
+    "ascen\0"
+    "d\0"
+    "downw\0"
+    "down\0"
+    "desce\0"
+    "pit\0"
+    "outdo\0"
+    "crack\0"
+    "dome\0"
+    "left\0"
+    "right\0"
+    "hall\0"
+    "jump\0"
+    "barre\0"
+    "over\0"
+    "acros\0"
+    "east\0"
+    "e\0"
+    "west\0"
+    "w\0"
+    "north\0"
+    "n\0"
+    "south\0"
+    "s\0"
+    "ne\0"
+    "se\0"
+    "sw\0"
+    "nw\0"
+    "debri\0"
+    "hole\0"
+    "wall\0"
+    "broke\0"
+    "y2\0"
+    "climb\0"
+    "l\0"
+    "x\0"
+    "look\0"
+    "exami\0"
+    "touch\0"
+    "descr\0"
+    "floor\0"
+    "room\0"
+    "slit\0"
+    "slab\0"
+    "slabr\0"
+    "xyzzy\0"
+    "depre\0"
+    "entra\0"
+    "plugh\0"
+    "secre\0"
+    "cave\0"
+    "cross\0"
+    "bedqu\0"
+    "plove\0"
+    "orien\0"
+    "caver\0"
+    "shell\0"
+    "main\0"
+    "offic\0"
+    "g\0"
+    "carry\0"
+    "take\0"
+    "keep\0"
+    "catch\0"
+    "steal\0"
+    "captu\0"
+    "get\0"
+    "tote\0"
+    "snarf\0"
+    "drop\0"
+    "relea\0"
+    "free\0"
+    "disca\0"
+    "dump\0"
+    "say\0"
+    "chant\0"
+    "sing\0"
+    "utter\0"
+    "mumbl\0"
+    "NO_MESSAGE\0"
+    "unloc\0"
+    "open\0"
+    "z\0"
+    "nothi\0"
+    "lock\0"
+    "close\0"
+    "light\0"
+    "on\0"
+    "extin\0"
+    "off\0"
+    "wave\0"
+    "shake\0"
+    "swing\0"
+    "calm\0"
+    "placa\0"
+    "tame\0"
+    "walk\0"
+    "run\0"
+    "trave\0"
+    "go\0"
+    "proce\0"
+    "explo\0"
+    "follo\0"
+    "turn\0"
+    "attac\0"
+    "kill\0"
+    "fight\0"
+    "hit\0"
+    "strik\0"
+    "slay\0"
+    "pour\0"
+    "eat\0"
+    "devou\0"
+    "drink\0"
+    "You have taken a drink from the stream.  The water tastes strongly of\nminerals, but is not unpleasant.  It is extremely cold.\0"
+    "rub\0"
+    "Rubbing the electric lamp is not particularly rewarding.  Anyway,\nnothing exciting happens.\0"
+    "throw\0"
+    "toss\0"
+    "quit\0"
+    "find\0"
+    "where\0"
+    "i\0"
+    "inven\0"
+    "feed\0"
+    "There is nothing here to eat.\0"
+    "fill\0"
+    "You can\'t fill that.\0"
+    "blast\0"
+    "deton\0"
+    "ignit\0"
+    "blowu\0"
+    "score\0"
+    "fee\0"
+    "fie\0"
+    "foe\0"
+    "foo\0"
+    "fum\0"
+    "brief\0"
+    "On what?\0"
+    "read\0"
+    "perus\0"
+    "break\0"
+    "shatt\0"
+    "smash\0"
+    "wake\0"
+    "distu\0"
+    "suspe\0"
+    "pause\0"
+    "save\0"
+    "resum\0"
+    "resta\0"
+    "fly\0"
+    "liste\0"
+    "z\'zzz\0"
+    "seed\0"
+    "Seed set to %d\0"
+    "waste\0"
+    "Game limit is now %d\0"
+    "thank\0"
+    "You\'re quite welcome.\0"
+    "sesam\0"
+    "opens\0"
+    "abra\0"
+    "abrac\0"
+    "shaza\0"
+    "hocus\0"
+    "pocus\0"
+    "Good try, but that is an old worn-out magic word.\0"
+    "help\0"
+    "?\0"
+    "I know of places, actions, and things.  Most of my vocabulary\ndescribes places and is used to move you there.  To move, try words\nlike forest, building, downstream, enter, east, west, north, south,\nup, or down.  I know about a few special objects, like a black rod\nhidden in the cave.  These objects can be manipulated using some of\nthe action words that I know.  Usually you will need to give both the\nobject and action words (in either order), but sometimes I can infer\nthe object from the verb alone.  Some objects also imply verbs; in\nparticular, \"inventory\" implies \"take inventory\", which causes me to\ngive you a list of what you\'re carrying.  Some objects have unexpected\neffects; the effects are not always desirable!  Usually people having\ntrouble moving just need to try a few more words.  Usually people\ntrying unsuccessfully to manipulate an object are attempting something\nbeyond their (or my!) capabilities and should try a completely\ndifferent tack.  One point often confusing to beginners is that, when\nthere are several ways to go in a certain direction (e.g., if there\nare several holes in a wall), choosing that direction in effect\nchooses one of the ways at random; often, though, by specifying the\nplace you want to reach you can guarantee choosing the right path.\nAlso, to speed the game you can sometimes move long distances with a\nsingle word.  For example, \"building\" usually gets you to the building\nfrom anywhere above ground except when lost in the forest.  Also, note\nthat cave passages and forest paths turn a lot, so leaving one place\nheading north doesn\'t guarantee entering the next from the south.\nHowever (another important point), except when you\'ve used a \"long\ndistance\" word such as \"building\", there is always a way to go back\nwhere you just came from unless I warn you to the contrary, even\nthough the direction that takes you back might not be the reverse of\nwhat got you here.  Good luck, and have fun!\0"
+    "no\0"
+    "tree\0"
+    "trees\0"
+    "The trees of the forest are large hardwood oak and maple, with an\noccasional grove of pine or spruce.  There is quite a bit of under-\ngrowth, largely birch and ash saplings plus nondescript bushes of\nvarious sorts.  This time of year visibility is quite restricted by\nall the leaves, but travel is quite easy if you detour around the\nspruce and berry bushes.\0"
+    "dig\0"
+    "excav\0"
+    "Digging without a shovel is quite impractical.  Even with a shovel\nprogress is unlikely.\0"
+    "lost\0"
+    "I\'m as confused as you are.\0"
+    "mist\0"
+    "Mist is a white vapor, usually water, seen from time to time in\ncaverns.  It can be found anywhere but is frequently a sign of a deep\npit leading down to water.\'\0"
+    "fuck\0"
+    "Watch it!\0"
+    "stop\0"
+    "I don\'t know the word \"stop\".  Use \"quit\" if you want to give up.\0"
+    "info\0"
+    "infor\0"
+    "For a summary of the most recent changes to the game, say \"news\".\nIf you want to end your adventure early, say \"quit\".  To suspend your\nadventure such that you can continue later, say \"suspend\" (or \"pause\"\nor \"save\").  To see how well you\'re doing, say \"score\".  To get full\ncredit for a treasure, you must have left it safely in the building,\nthough you get partial credit just for locating it.  You lose points\nfor getting killed, or for quitting, though the former costs you more.\nThere are also points based on how much (if any) of the cave you\'ve\nmanaged to explore; in particular, there is a large bonus just for\ngetting in (to distinguish the beginners from the rest of the pack),\nand there are other ways to determine whether you\'ve been through some\nof the more harrowing sections.  If you think you\'ve found all the\ntreasures, just keep exploring for a while.  If nothing interesting\nhappens, you haven\'t found them all yet.  If something interesting\n*DOES* happen (incidentally, there *ARE* ways to hasten things along),\nit means you\'re getting a bonus and have an opportunity to garner many\nmore points in the Master\'s section.  I may occasionally offer hints\nif you seem to be having trouble.  If I do, I\'ll warn you in advance\nhow much it will affect your score to accept the hints.  Finally, to\nsave time, you may specify \"brief\", which tells me never to repeat the\nfull description of a place unless you explicitly ask me to.\0"
+    "swim\0"
+    "wizar\0"
+    "Wizards are not to be disturbed by such as you.\0"
+    "yes\0"
+    "Guess again.\0"
+    "news\0"
+    "Open Adventure is an author-approved open-source release of\nVersion 2.5 with, as yet, no gameplay changes.\nVersion 2.5 was essentially the same as Version II; the cave and the\nhazards therein are unchanged, and top score is still 430 points.\nThere are a few more hints, especially for some of the more obscure\npuzzles.  There are a few minor bugfixes and cosmetic changes.  You\ncan now save a game and resume it at once (formerly you had to wait a\nwhile first), but it now costs you a few points each time you save the\ngame.  Saved games are now stored in much smaller files than before.\0"
+    "versi\0"
+    "There is a puff of orange smoke; within it, fiery runes spell out:\n\n\tOpen Adventure %V - http://www.catb.org/esr/open-adventure/\0";
+
+const msgop_t message_ops[] = {
+    {MSG_END, 0},
+    {MSG_TEXT, 676},
+    {MSG_END, 0},
+    {MSG_TEXT, 48},
+    {MSG_END, 0},
+    {MSG_TEXT, 114},
+    {MSG_END, 0},
+    {MSG_TEXT, 10},
+    {MSG_INT, 2},
+    {MSG_TEXT, 49},
+    {MSG_END, 0},
+    {MSG_TEXT, 57},
+    {MSG_END, 0},
+    {MSG_TEXT, 39},
+    {MSG_END, 0},
+    {MSG_TEXT, 28},
+    {MSG_END, 0},
+    {MSG_TEXT, 12},
+    {MSG_END, 0},
+    {MSG_TEXT, 10},
+    {MSG_END, 0},
+    {MSG_TEXT, 70},
+    {MSG_END, 0},
+    {MSG_TEXT, 109},
+    {MSG_END, 0},
+    {MSG_TEXT, 41},
+    {MSG_END, 0},
+    {MSG_TEXT, 41},
+    {MSG_END, 0},
+    {MSG_TEXT, 102},
+    {MSG_END, 0},
+    {MSG_TEXT, 70},
+    {MSG_END, 0},
+    {MSG_TEXT, 46},
+    {MSG_END, 0},
+    {MSG_TEXT, 31},
+    {MSG_END, 0},
+    {MSG_TEXT, 54},
+    {MSG_END, 0},
+    {MSG_TEXT, 28},
+    {MSG_END, 0},
+    {MSG_TEXT, 21},
+    {MSG_END, 0},
+    {MSG_TEXT, 100},
+    {MSG_END, 0},
+    {MSG_TEXT, 48},
+    {MSG_END, 0},
+    {MSG_TEXT, 34},
+    {MSG_END, 0},
+    {MSG_TEXT, 23},
+    {MSG_END, 0},
+    {MSG_TEXT, 91},
+    {MSG_END, 0},
+    {MSG_TEXT, 17},
+    {MSG_END, 0},
+    {MSG_TEXT, 15},
+    {MSG_END, 0},
+    {MSG_TEXT, 48},
+    {MSG_END, 0},
+    {MSG_TEXT, 22},
+    {MSG_END, 0},
+    {MSG_TEXT, 24},
+    {MSG_END, 0},
+    {MSG_TEXT, 89},
+    {MSG_END, 0},
+    {MSG_TEXT, 16},
+    {MSG_END, 0},
+    {MSG_TEXT, 6},
+    {MSG_END, 0},
+    {MSG_TEXT, 32},
+    {MSG_END, 0},
+    {MSG_TEXT, 50},
+    {MSG_END, 0},
+    {MSG_TEXT, 60},
+    {MSG_END, 0},
+    {MSG_TEXT, 26},
+    {MSG_END, 0},
+    {MSG_TEXT, 56},
+    {MSG_END, 0},
+    {MSG_TEXT, 28},
+    {MSG_END, 0},
+    {MSG_TEXT, 37},
+    {MSG_END, 0},
+    {MSG_TEXT, 39},
+    {MSG_END, 0},
+    {MSG_TEXT, 2},
+    {MSG_END, 0},
+    {MSG_TEXT, 26},
+    {MSG_END, 0},
+    {MSG_TEXT, 83},
+    {MSG_END, 0},
+    {MSG_TEXT, 114},
+    {MSG_END, 0},
+    {MSG_TEXT, 45},
+    {MSG_END, 0},
+    {MSG_TEXT, 117},
+    {MSG_END, 0},
+    {MSG_TEXT, 36},
+    {MSG_END, 0},
+    {MSG_TEXT, 4},
+    {MSG_END, 0},
+    {MSG_TEXT, 52},
+    {MSG_END, 0},
+    {MSG_TEXT, 27},
+    {MSG_END, 0},
+    {MSG_TEXT, 22},
+    {MSG_END, 0},
+    {MSG_TEXT, 32},
+    {MSG_END, 0},
+    {MSG_TEXT, 28},
+    {MSG_END, 0},
+    {MSG_TEXT, 38},
+    {MSG_END, 0},
+    {MSG_TEXT, 43},
+    {MSG_END, 0},
+    {MSG_TEXT, 20},
+    {MSG_END, 0},
+    {MSG_TEXT, 10},
+    {MSG_END, 0},
+    {MSG_TEXT, 64},
+    {MSG_END, 0},
+    {MSG_TEXT, 68},
+    {MSG_END, 0},
+    {MSG_TEXT, 42},
+    {MSG_END, 0},
+    {MSG_TEXT, 47},
+    {MSG_END, 0},
+    {MSG_TEXT, 38},
+    {MSG_END, 0},
+    {MSG_TEXT, 67},
+    {MSG_END, 0},
+    {MSG_TEXT, 35},
+    {MSG_END, 0},
+    {MSG_TEXT, 29},
+    {MSG_END, 0},
+    {MSG_TEXT, 40},
+    {MSG_END, 0},
+    {MSG_TEXT, 85},
+    {MSG_END, 0},
+    {MSG_TEXT, 37},
+    {MSG_END, 0},
+    {MSG_TEXT, 58},
+    {MSG_END, 0},
+    {MSG_TEXT, 68},
+    {MSG_END, 0},
+    {MSG_TEXT, 38},
+    {MSG_END, 0},
+    {MSG_TEXT, 28},
+    {MSG_END, 0},
+    {MSG_TEXT, 52},
+    {MSG_END, 0},
+    {MSG_TEXT, 20},
+    {MSG_END, 0},
+    {MSG_TEXT, 48},
+    {MSG_END, 0},
+    {MSG_TEXT, 70},
+    {MSG_END, 0},
+    {MSG_TEXT, 65},
+    {MSG_END, 0},
+    {MSG_TEXT, 64},
+    {MSG_END, 0},
+    {MSG_TEXT, 110},
+    {MSG_END, 0},
+    {MSG_TEXT, 62},
+    {MSG_END, 0},
+    {MSG_TEXT, 64},
+    {MSG_END, 0},
+    {MSG_TEXT, 65},
+    {MSG_END, 0},
+    {MSG_TEXT, 55},
+    {MSG_END, 0},
+    {MSG_TEXT, 57},
+    {MSG_END, 0},
+    {MSG_TEXT, 196},
+    {MSG_END, 0},
+    {MSG_TEXT, 91},
+    {MSG_END, 0},
+    {MSG_TEXT, 131},
+    {MSG_END, 0},
+    {MSG_TEXT, 61},
+    {MSG_END, 0},
+    {MSG_TEXT, 220},
+    {MSG_END, 0},
+    {MSG_TEXT, 132},
+    {MSG_END, 0},
+    {MSG_TEXT, 116},
+    {MSG_END, 0},
+    {MSG_TEXT, 124},
+    {MSG_END, 0},
+    {MSG_TEXT, 206},
+    {MSG_END, 0},
+    {MSG_TEXT, 268},
+    {MSG_END, 0},
+    {MSG_TEXT, 209},
+    {MSG_END, 0},
+    {MSG_TEXT, 86},
+    {MSG_END, 0},
+    {MSG_TEXT, 175},
+    {MSG_END, 0},
+    {MSG_TEXT, 38},
+    {MSG_END, 0},
+    {MSG_TEXT, 53},
+    {MSG_END, 0},
+    {MSG_TEXT, 30},
+    {MSG_END, 0},
+    {MSG_TEXT, 50},
+    {MSG_END, 0},
+    {MSG_TEXT, 60},
+    {MSG_END, 0},
+    {MSG_TEXT, 44},
+    {MSG_END, 0},
+    {MSG_TEXT, 67},
+    {MSG_END, 0},
+    {MSG_TEXT, 35},
+    {MSG_END, 0},
+    {MSG_TEXT, 17},
+    {MSG_END, 0},
+    {MSG_TEXT, 34},
+    {MSG_END, 0},
+    {MSG_TEXT, 79},
+    {MSG_END, 0},
+    {MSG_TEXT, 53},
+    {MSG_END, 0},
+    {MSG_TEXT, 62},
+    {MSG_END, 0},
+    {MSG_TEXT, 36},
+    {MSG_END, 0},
+    {MSG_TEXT, 57},
+    {MSG_END, 0},
+    {MSG_TEXT, 61},
+    {MSG_END, 0},
+    {MSG_TEXT, 115},
+    {MSG_END, 0},
+    {MSG_TEXT, 125},
+    {MSG_END, 0},
+    {MSG_TEXT, 135},
+    {MSG_END, 0},
+    {MSG_TEXT, 137},
+    {MSG_END, 0},
+    {MSG_TEXT, 63},
+    {MSG_END, 0},
+    {MSG_TEXT, 35},
+    {MSG_END, 0},
+    {MSG_TEXT, 44},
+    {MSG_END, 0},
+    {MSG_TEXT, 56},
+    {MSG_END, 0},
+    {MSG_TEXT, 54},
+    {MSG_END, 0},
+    {MSG_TEXT, 52},
+    {MSG_END, 0},
+    {MSG_TEXT, 38},
+    {MSG_END, 0},
+    {MSG_TEXT, 26},
+    {MSG_END, 0},
+    {MSG_TEXT, 26},
+    {MSG_END, 0},
+    {MSG_TEXT, 24},
+    {MSG_END, 0},
+    {MSG_TEXT, 55},
+    {MSG_END, 0},
+    {MSG_TEXT, 21},
+    {MSG_END, 0},
+    {MSG_TEXT, 64},
+    {MSG_END, 0},
+    {MSG_TEXT, 188},
+    {MSG_END, 0},
+    {MSG_TEXT, 31},
+    {MSG_END, 0},
+    {MSG_TEXT, 27},
+    {MSG_END, 0},
+    {MSG_TEXT, 317},
+    {MSG_END, 0},
+    {MSG_TEXT, 66},
+    {MSG_END, 0},
+    {MSG_TEXT, 77},
+    {MSG_END, 0},
+    {MSG_TEXT, 96},
+    {MSG_END, 0},
+    {MSG_TEXT, 93},
+    {MSG_END, 0},
+    {MSG_TEXT, 117},
+    {MSG_END, 0},
+    {MSG_TEXT, 135},
+    {MSG_END, 0},
+    {MSG_TEXT, 30},
+    {MSG_END, 0},
+    {MSG_TEXT, 55},
+    {MSG_END, 0},
+    {MSG_TEXT, 104},
+    {MSG_END, 0},
+    {MSG_TEXT, 19},
+    {MSG_END, 0},
+    {MSG_TEXT, 37},
+    {MSG_END, 0},
+    {MSG_TEXT, 118},
+    {MSG_END, 0},
+    {MSG_TEXT, 177},
+    {MSG_END, 0},
+    {MSG_TEXT, 176},
+    {MSG_END, 0},
+    {MSG_TEXT, 45},
+    {MSG_END, 0},
+    {MSG_TEXT, 41},
+    {MSG_END, 0},
+    {MSG_TEXT, 170},
+    {MSG_END, 0},
+    {MSG_TEXT, 130},
+    {MSG_END, 0},
+    {MSG_TEXT, 52},
+    {MSG_END, 0},
+    {MSG_TEXT, 31},
+    {MSG_END, 0},
+    {MSG_TEXT, 45},
+    {MSG_END, 0},
+    {MSG_TEXT, 70},
+    {MSG_END, 0},
+    {MSG_TEXT, 473},
+    {MSG_END, 0},
+    {MSG_TEXT, 42},
+    {MSG_END, 0},
+    {MSG_TEXT, 36},
+    {MSG_END, 0},
+    {MSG_TEXT, 63},
+    {MSG_END, 0},
+    {MSG_TEXT, 91},
+    {MSG_END, 0},
+    {MSG_TEXT, 45},
+    {MSG_END, 0},
+    {MSG_TEXT, 38},
+    {MSG_END, 0},
+    {MSG_TEXT, 46},
+    {MSG_END, 0},
+    {MSG_TEXT, 77},
+    {MSG_END, 0},
+    {MSG_TEXT, 55},
+    {MSG_END, 0},
+    {MSG_TEXT, 196},
+    {MSG_END, 0},
+    {MSG_TEXT, 42},
+    {MSG_END, 0},
+    {MSG_TEXT, 14},
+    {MSG_END, 0},
+    {MSG_TEXT, 32},
+    {MSG_END, 0},
+    {MSG_TEXT, 40},
+    {MSG_END, 0},
+    {MSG_TEXT, 41},
+    {MSG_END, 0},
+    {MSG_TEXT, 55},
+    {MSG_END, 0},
+    {MSG_TEXT, 76},
+    {MSG_END, 0},
+    {MSG_TEXT, 43},
+    {MSG_END, 0},
+    {MSG_TEXT, 45},
+    {MSG_END, 0},
+    {MSG_TEXT, 28},
+    {MSG_END, 0},
+    {MSG_TEXT, 58},
+    {MSG_END, 0},
+    {MSG_TEXT, 163},
+    {MSG_END, 0},
+    {MSG_TEXT, 48},
+    {MSG_END, 0},
+    {MSG_TEXT, 38},
+    {MSG_END, 0},
+    {MSG_TEXT, 38},
+    {MSG_END, 0},
+    {MSG_TEXT, 23},
+    {MSG_END, 0},
+    {MSG_TEXT, 49},
+    {MSG_END, 0},
+    {MSG_INT, 2},
+    {MSG_TEXT, 29},
+    {MSG_END, 0},
+    {MSG_INT, 2},
+    {MSG_TEXT, 17},
+    {MSG_END, 0},
+    {MSG_TEXT, 21},
+    {MSG_END, 0},
+    {MSG_TEXT, 22},
+    {MSG_END, 0},
+    {MSG_TEXT, 30},
+    {MSG_STR, 2},
+    {MSG_TEXT, 2},
+    {MSG_END, 0},
+    {MSG_TEXT, 32},
+    {MSG_STR, 2},
+    {MSG_TEXT, 1},
+    {MSG_END, 0},
+    {MSG_TEXT, 9},
+    {MSG_STR, 2},
+    {MSG_TEXT, 6},
+    {MSG_END, 0},
+    {MSG_STR, 2},
+    {MSG_TEXT, 6},
+    {MSG_END, 0},
+    {MSG_TEXT, 7},
+    {MSG_STR, 2},
+    {MSG_TEXT, 2},
+    {MSG_END, 0},
+    {MSG_TEXT, 18},
+    {MSG_INT, 2},
+    {MSG_TEXT, 19},
+    {MSG_INT, 2},
+    {MSG_TEXT, 15},
+    {MSG_INT, 2},
+    {MSG_TEXT, 5},
+    {MSG_PLURAL, 2},
+    {MSG_TEXT, 1},
+    {MSG_END, 0},
+    {MSG_TEXT, 97},
+    {MSG_END, 0},
+    {MSG_TEXT, 55},
+    {MSG_INT, 2},
+    {MSG_TEXT, 6},
+    {MSG_PLURAL, 2},
+    {MSG_TEXT, 1},
+    {MSG_END, 0},
+    {MSG_TEXT, 11},
+    {MSG_INT, 2},
+    {MSG_TEXT, 19},
+    {MSG_INT, 2},
+    {MSG_TEXT, 8},
+    {MSG_INT, 2},
+    {MSG_TEXT, 5},
+    {MSG_PLURAL, 2},
+    {MSG_TEXT, 1},
+    {MSG_END, 0},
+    {MSG_TEXT, 44},
+    {MSG_INT, 2},
+    {MSG_TEXT, 11},
+    {MSG_PLURAL, 2},
+    {MSG_TEXT, 1},
+    {MSG_END, 0},
+    {MSG_TEXT, 74},
+    {MSG_END, 0},
+    {MSG_TEXT, 28},
+    {MSG_END, 0},
+    {MSG_TEXT, 65},
+    {MSG_END, 0},
+    {MSG_TEXT, 65},
+    {MSG_END, 0},
+    {MSG_TEXT, 54},
+    {MSG_INT, 2},
+    {MSG_TEXT, 1},
+    {MSG_INT, 2},
+    {MSG_TEXT, 56},
+    {MSG_INT, 2},
+    {MSG_TEXT, 1},
+    {MSG_INT, 2},
+    {MSG_TEXT, 88},
+    {MSG_END, 0},
+    {MSG_TEXT, 99},
+    {MSG_END, 0},
+    {MSG_TEXT, 125},
+    {MSG_END, 0},
+    {MSG_TEXT, 41},
+    {MSG_END, 0},
+    {MSG_TEXT, 28},
+    {MSG_END, 0},
+    {MSG_TEXT, 152},
+    {MSG_END, 0},
+    {MSG_TEXT, 23},
+    {MSG_END, 0},
+    {MSG_TEXT, 140},
+    {MSG_END, 0},
+    {MSG_TEXT, 23},
+    {MSG_END, 0},
+    {MSG_TEXT, 59},
+    {MSG_END, 0},
+    {MSG_TEXT, 17},
+    {MSG_END, 0},
+    {MSG_TEXT, 77},
+    {MSG_END, 0},
+    {MSG_TEXT, 22},
+    {MSG_END, 0},
+    {MSG_TEXT, 67},
+    {MSG_END, 0},
+    {MSG_TEXT, 16},
+    {MSG_END, 0},
+    {MSG_TEXT, 133},
+    {MSG_END, 0},
+    {MSG_TEXT, 28},
+    {MSG_END, 0},
+    {MSG_TEXT, 121},
+    {MSG_END, 0},
+    {MSG_TEXT, 21},
+    {MSG_END, 0},
+    {MSG_TEXT, 163},
+    {MSG_END, 0},
+    {MSG_TEXT, 23},
+    {MSG_END, 0},
+    {MSG_TEXT, 119},
+    {MSG_END, 0},
+    {MSG_TEXT, 23},
+    {MSG_END, 0},
+    {MSG_TEXT, 101},
+    {MSG_END, 0},
+    {MSG_TEXT, 22},
+    {MSG_END, 0},
+    {MSG_TEXT, 243},
+    {MSG_END, 0},
+    {MSG_TEXT, 47},
+    {MSG_END, 0},
+    {MSG_TEXT, 23},
+    {MSG_END, 0},
+    {MSG_TEXT, 177},
+    {MSG_END, 0},
+    {MSG_TEXT, 27},
+    {MSG_END, 0},
+    {MSG_TEXT, 123},
+    {MSG_END, 0},
+    {MSG_TEXT, 24},
+    {MSG_END, 0},
+    {MSG_TEXT, 336},
+    {MSG_END, 0},
+    {MSG_TEXT, 106},
+    {MSG_END, 0},
+    {MSG_TEXT, 31},
+    {MSG_END, 0},
+    {MSG_TEXT, 135},
+    {MSG_END, 0},
+    {MSG_TEXT, 30},
+    {MSG_END, 0},
+    {MSG_TEXT, 98},
+    {MSG_END, 0},
+    {MSG_TEXT, 26},
+    {MSG_END, 0},
+    {MSG_TEXT, 78},
+    {MSG_END, 0},
+    {MSG_TEXT, 52},
+    {MSG_END, 0},
+    {MSG_TEXT, 19},
+    {MSG_END, 0},
+    {MSG_TEXT, 24},
+    {MSG_END, 0},
+    {MSG_TEXT, 34},
+    {MSG_END, 0},
+    {MSG_TEXT, 117},
+    {MSG_END, 0},
+    {MSG_TEXT, 19},
+    {MSG_END, 0},
+    {MSG_TEXT, 116},
+    {MSG_END, 0},
+    {MSG_TEXT, 19},
+    {MSG_END, 0},
+    {MSG_TEXT, 120},
+    {MSG_END, 0},
+    {MSG_TEXT, 64},
+    {MSG_END, 0},
+    {MSG_TEXT, 31},
+    {MSG_END, 0},
+    {MSG_TEXT, 61},
+    {MSG_END, 0},
+    {MSG_TEXT, 40},
+    {MSG_END, 0},
+    {MSG_TEXT, 46},
+    {MSG_FLOOR, 5},
+    {MSG_TEXT, 40},
+    {MSG_END, 0},
+    {MSG_TEXT, 34},
+    {MSG_END, 0},
+    {MSG_TEXT, 32},
+    {MSG_END, 0},
+    {MSG_TEXT, 104},
+    {MSG_END, 0},
+    {MSG_TEXT, 27},
+    {MSG_END, 0},
+    {MSG_TEXT, 15},
+    {MSG_END, 0},
+    {MSG_TEXT, 170},
+    {MSG_END, 0},
+    {MSG_TEXT, 52},
+    {MSG_END, 0},
+    {MSG_TEXT, 24},
+    {MSG_END, 0},
+    {MSG_TEXT, 81},
+    {MSG_FLOOR, 5},
+    {MSG_TEXT, 77},
+    {MSG_FLOOR, 5},
+    {MSG_TEXT, 302},
+    {MSG_END, 0},
+    {MSG_TEXT, 24},
+    {MSG_END, 0},
+    {MSG_TEXT, 133},
+    {MSG_END, 0},
+    {MSG_TEXT, 29},
+    {MSG_END, 0},
+    {MSG_TEXT, 73},
+    {MSG_END, 0},
+    {MSG_TEXT, 36},
+    {MSG_END, 0},
+    {MSG_TEXT, 101},
+    {MSG_END, 0},
+    {MSG_TEXT, 26},
+    {MSG_END, 0},
+    {MSG_TEXT, 73},
+    {MSG_FLOOR, 5},
+    {MSG_TEXT, 59},
+    {MSG_END, 0},
+    {MSG_TEXT, 92},
+    {MSG_END, 0},
+    {MSG_TEXT, 36},
+    {MSG_END, 0},
+    {MSG_TEXT, 152},
+    {MSG_FLOOR, 5},
+    {MSG_TEXT, 1},
+    {MSG_END, 0},
+    {MSG_TEXT, 55},
+    {MSG_END, 0},
+    {MSG_TEXT, 8},
+    {MSG_END, 0},
+    {MSG_TEXT, 23},
+    {MSG_END, 0},
+    {MSG_TEXT, 178},
+    {MSG_END, 0},
+    {MSG_TEXT, 32},
+    {MSG_END, 0},
+    {MSG_TEXT, 167},
+    {MSG_END, 0},
+    {MSG_TEXT, 32},
+    {MSG_END, 0},
+    {MSG_TEXT, 110},
+    {MSG_END, 0},
+    {MSG_TEXT, 63},
+    {MSG_END, 0},
+    {MSG_TEXT, 27},
+    {MSG_END, 0},
+    {MSG_TEXT, 207},
+    {MSG_END, 0},
+    {MSG_TEXT, 19},
+    {MSG_END, 0},
+    {MSG_TEXT, 123},
+    {MSG_END, 0},
+    {MSG_TEXT, 28},
+    {MSG_END, 0},
+    {MSG_TEXT, 153},
+    {MSG_END, 0},
+    {MSG_TEXT, 34},
+    {MSG_END, 0},
+    {MSG_TEXT, 49},
+    {MSG_FLOOR, 5},
+    {MSG_TEXT, 276},
+    {MSG_END, 0},
+    {MSG_TEXT, 20},
+    {MSG_END, 0},
+    {MSG_TEXT, 46},
+    {MSG_FLOOR, 5},
+    {MSG_TEXT, 240},
+    {MSG_END, 0},
+    {MSG_TEXT, 50},
+    {MSG_END, 0},
+    {MSG_TEXT, 55},
+    {MSG_END, 0},
+    {MSG_TEXT, 43},
+    {MSG_END, 0},
+    {MSG_TEXT, 141},
+    {MSG_END, 0},
+    {MSG_TEXT, 25},
+    {MSG_END, 0},
+    {MSG_TEXT, 60},
+    {MSG_END, 0},
+    {MSG_TEXT, 15},
+    {MSG_END, 0},
+    {MSG_TEXT, 47},
+    {MSG_END, 0},
+    {MSG_TEXT, 151},
+    {MSG_END, 0},
+    {MSG_TEXT, 51},
+    {MSG_END, 0},
+    {MSG_TEXT, 54},
+    {MSG_END, 0},
+    {MSG_TEXT, 88},
+    {MSG_END, 0},
+    {MSG_TEXT, 52},
+    {MSG_END, 0},
+    {MSG_TEXT, 106},
+    {MSG_END, 0},
+    {MSG_TEXT, 26},
+    {MSG_END, 0},
+    {MSG_TEXT, 150},
+    {MSG_END, 0},
+    {MSG_TEXT, 68},
+    {MSG_END, 0},
+    {MSG_TEXT, 49},
+    {MSG_END, 0},
+    {MSG_TEXT, 41},
+    {MSG_END, 0},
+    {MSG_TEXT, 171},
+    {MSG_END, 0},
+    {MSG_TEXT, 21},
+    {MSG_END, 0},
+    {MSG_TEXT, 206},
+    {MSG_END, 0},
+    {MSG_TEXT, 48},
+    {MSG_END, 0},
+    {MSG_TEXT, 53},
+    {MSG_END, 0},
+    {MSG_TEXT, 32},
+    {MSG_END, 0},
+    {MSG_TEXT, 161},
+    {MSG_FLOOR, 5},
+    {MSG_TEXT, 39},
+    {MSG_END, 0},
+    {MSG_TEXT, 20},
+    {MSG_END, 0},
+    {MSG_TEXT, 74},
+    {MSG_FLOOR, 5},
+    {MSG_TEXT, 52},
+    {MSG_END, 0},
+    {MSG_TEXT, 24},
+    {MSG_END, 0},
+    {MSG_TEXT, 194},
+    {MSG_END, 0},
+    {MSG_TEXT, 23},
+    {MSG_END, 0},
+    {MSG_TEXT, 240},
+    {MSG_END, 0},
+    {MSG_TEXT, 17},
+    {MSG_END, 0},
+    {MSG_TEXT, 199},
+    {MSG_END, 0},
+    {MSG_TEXT, 22},
+    {MSG_END, 0},
+    {MSG_TEXT, 128},
+    {MSG_END, 0},
+    {MSG_TEXT, 20},
+    {MSG_END, 0},
+    {MSG_TEXT, 68},
+    {MSG_END, 0},
+    {MSG_TEXT, 22},
+    {MSG_END, 0},
+    {MSG_TEXT, 141},
+    {MSG_END, 0},
+    {MSG_TEXT, 21},
+    {MSG_END, 0},
+    {MSG_TEXT, 60},
+    {MSG_FLOOR, 5},
+    {MSG_TEXT, 195},
+    {MSG_END, 0},
+    {MSG_TEXT, 59},
+    {MSG_END, 0},
+    {MSG_TEXT, 48},
+    {MSG_END, 0},
+    {MSG_TEXT, 19},
+    {MSG_END, 0},
+    {MSG_TEXT, 261},
+    {MSG_END, 0},
+    {MSG_TEXT, 59},
+    {MSG_END, 0},
+    {MSG_TEXT, 21},
+    {MSG_END, 0},
+    {MSG_TEXT, 62},
+    {MSG_END, 0},
+    {MSG_TEXT, 24},
+    {MSG_END, 0},
+    {MSG_TEXT, 59},
+    {MSG_FLOOR, 5},
+    {MSG_TEXT, 404},
+    {MSG_END, 0},
+    {MSG_TEXT, 81},
+    {MSG_FLOOR, 5},
+    {MSG_TEXT, 77},
+    {MSG_FLOOR, 5},
+    {MSG_TEXT, 301},
+    {MSG_END, 0},
+    {MSG_TEXT, 28},
+    {MSG_END, 0},
+    {MSG_TEXT, 202},
+    {MSG_END, 0},
+    {MSG_TEXT, 61},
+    {MSG_END, 0},
+    {MSG_TEXT, 20},
+    {MSG_END, 0},
+    {MSG_TEXT, 330},
+    {MSG_END, 0},
+    {MSG_TEXT, 17},
+    {MSG_END, 0},
+    {MSG_TEXT, 742},
+    {MSG_END, 0},
+    {MSG_TEXT, 17},
+    {MSG_END, 0},
+    {MSG_TEXT, 330},
+    {MSG_FLOOR, 5},
+    {MSG_TEXT, 161},
+    {MSG_END, 0},
+    {MSG_TEXT, 27},
+    {MSG_END, 0},
+    {MSG_TEXT, 181},
+    {MSG_END, 0},
+    {MSG_TEXT, 27},
+    {MSG_END, 0},
+    {MSG_TEXT, 75},
+    {MSG_END, 0},
+    {MSG_TEXT, 61},
+    {MSG_END, 0},
+    {MSG_TEXT, 27},
+    {MSG_END, 0},
+    {MSG_TEXT, 88},
+    {MSG_END, 0},
+    {MSG_TEXT, 19},
+    {MSG_END, 0},
+    {MSG_TEXT, 90},
+    {MSG_END, 0},
+    {MSG_TEXT, 23},
+    {MSG_END, 0},
+    {MSG_TEXT, 202},
+    {MSG_END, 0},
+    {MSG_TEXT, 35},
+    {MSG_END, 0},
+    {MSG_TEXT, 183},
+    {MSG_END, 0},
+    {MSG_TEXT, 29},
+    {MSG_END, 0},
+    {MSG_TEXT, 1292},
+    {MSG_END, 0},
+    {MSG_TEXT, 30},
+    {MSG_END, 0},
+    {MSG_TEXT, 225},
+    {MSG_END, 0},
+    {MSG_TEXT, 28},
+    {MSG_END, 0},
+    {MSG_TEXT, 104},
+    {MSG_END, 0},
+    {MSG_TEXT, 31},
+    {MSG_END, 0},
+    {MSG_TEXT, 120},
+    {MSG_END, 0},
+    {MSG_TEXT, 22},
+    {MSG_END, 0},
+    {MSG_TEXT, 195},
+    {MSG_END, 0},
+    {MSG_TEXT, 61},
+    {MSG_END, 0},
+    {MSG_TEXT, 59},
+    {MSG_END, 0},
+    {MSG_TEXT, 61},
+    {MSG_END, 0},
+    {MSG_TEXT, 61},
+    {MSG_END, 0},
+    {MSG_TEXT, 59},
+    {MSG_END, 0},
+    {MSG_TEXT, 59},
+    {MSG_END, 0},
+    {MSG_TEXT, 59},
+    {MSG_END, 0},
+    {MSG_TEXT, 61},
+    {MSG_END, 0},
+    {MSG_TEXT, 59},
+    {MSG_END, 0},
+    {MSG_TEXT, 52},
+    {MSG_END, 0},
+    {MSG_TEXT, 63},
+    {MSG_END, 0},
+    {MSG_TEXT, 64},
+    {MSG_END, 0},
+    {MSG_TEXT, 47},
+    {MSG_END, 0},
+    {MSG_TEXT, 16},
+    {MSG_END, 0},
+    {MSG_TEXT, 155},
+    {MSG_END, 0},
+    {MSG_TEXT, 30},
+    {MSG_END, 0},
+    {MSG_TEXT, 195},
+    {MSG_END, 0},
+    {MSG_TEXT, 26},
+    {MSG_END, 0},
+    {MSG_TEXT, 95},
+    {MSG_END, 0},
+    {MSG_TEXT, 62},
+    {MSG_END, 0},
+    {MSG_TEXT, 64},
+    {MSG_END, 0},
+    {MSG_TEXT, 24},
+    {MSG_END, 0},
+    {MSG_TEXT, 260},
+    {MSG_END, 0},
+    {MSG_TEXT, 47},
+    {MSG_END, 0},
+    {MSG_TEXT, 133},
+    {MSG_END, 0},
+    {MSG_TEXT, 195},
+    {MSG_END, 0},
+    {MSG_TEXT, 23},
+    {MSG_END, 0},
+    {MSG_TEXT, 114},
+    {MSG_END, 0},
+    {MSG_TEXT, 28},
+    {MSG_END, 0},
+    {MSG_TEXT, 63},
+    {MSG_END, 0},
+    {MSG_TEXT, 9},
+    {MSG_END, 0},
+    {MSG_TEXT, 39},
+    {MSG_END, 0},
+    {MSG_TEXT, 35},
+    {MSG_END, 0},
+    {MSG_TEXT, 31},
+    {MSG_END, 0},
+    {MSG_TEXT, 20},
+    {MSG_END, 0},
+    {MSG_TEXT, 18},
+    {MSG_END, 0},
+    {MSG_TEXT, 46},
+    {MSG_END, 0},
+    {MSG_TEXT, 63},
+    {MSG_END, 0},
+    {MSG_TEXT, 63},
+    {MSG_END, 0},
+    {MSG_TEXT, 36},
+    {MSG_END, 0},
+    {MSG_TEXT, 35},
+    {MSG_END, 0},
+    {MSG_TEXT, 47},
+    {MSG_END, 0},
+    {MSG_TEXT, 35},
+    {MSG_END, 0},
+    {MSG_TEXT, 55},
+    {MSG_END, 0},
+    {MSG_TEXT, 56},
+    {MSG_END, 0},
+    {MSG_TEXT, 34},
+    {MSG_FLOOR, 5},
+    {MSG_TEXT, 1},
+    {MSG_END, 0},
+    {MSG_TEXT, 39},
+    {MSG_END, 0},
+    {MSG_TEXT, 35},
+    {MSG_END, 0},
+    {MSG_TEXT, 106},
+    {MSG_END, 0},
+    {MSG_TEXT, 61},
+    {MSG_END, 0},
+    {MSG_TEXT, 63},
+    {MSG_END, 0},
+    {MSG_TEXT, 81},
+    {MSG_END, 0},
+    {MSG_TEXT, 65},
+    {MSG_END, 0},
+    {MSG_TEXT, 19},
+    {MSG_END, 0},
+    {MSG_TEXT, 32},
+    {MSG_END, 0},
+    {MSG_TEXT, 30},
+    {MSG_END, 0},
+    {MSG_TEXT, 30},
+    {MSG_END, 0},
+    {MSG_TEXT, 70},
+    {MSG_END, 0},
+    {MSG_TEXT, 91},
+    {MSG_END, 0},
+    {MSG_TEXT, 68},
+    {MSG_END, 0},
+    {MSG_TEXT, 66},
+    {MSG_END, 0},
+    {MSG_TEXT, 69},
+    {MSG_END, 0},
+    {MSG_TEXT, 64},
+    {MSG_END, 0},
+    {MSG_TEXT, 27},
+    {MSG_END, 0},
+    {MSG_TEXT, 44},
+    {MSG_END, 0},
+    {MSG_TEXT, 40},
+    {MSG_END, 0},
+    {MSG_TEXT, 68},
+    {MSG_END, 0},
+    {MSG_TEXT, 62},
+    {MSG_END, 0},
+    {MSG_TEXT, 131},
+    {MSG_END, 0},
+    {MSG_TEXT, 82},
+    {MSG_END, 0},
+    {MSG_TEXT, 93},
+    {MSG_END, 0},
+    {MSG_TEXT, 64},
+    {MSG_END, 0},
+    {MSG_TEXT, 32},
+    {MSG_END, 0},
+    {MSG_TEXT, 70},
+    {MSG_END, 0},
+    {MSG_TEXT, 59},
+    {MSG_END, 0},
+    {MSG_TEXT, 57},
+    {MSG_END, 0},
+    {MSG_TEXT, 136},
+    {MSG_END, 0},
+    {MSG_TEXT, 138},
+    {MSG_END, 0},
+    {MSG_TEXT, 82},
+    {MSG_END, 0},
+    {MSG_TEXT, 31},
+    {MSG_END, 0},
+    {MSG_TEXT, 51},
+    {MSG_END, 0},
+    {MSG_TEXT, 41},
+    {MSG_END, 0},
+    {MSG_TEXT, 36},
+    {MSG_END, 0},
+    {MSG_TEXT, 48},
+    {MSG_END, 0},
+    {MSG_TEXT, 60},
+    {MSG_END, 0},
+    {MSG_TEXT, 47},
+    {MSG_END, 0},
+    {MSG_TEXT, 66},
+    {MSG_END, 0},
+    {MSG_TEXT, 69},
+    {MSG_END, 0},
+    {MSG_TEXT, 47},
+    {MSG_END, 0},
+    {MSG_TEXT, 24},
+    {MSG_END, 0},
+    {MSG_TEXT, 30},
+    {MSG_END, 0},
+    {MSG_TEXT, 31},
+    {MSG_END, 0},
+    {MSG_TEXT, 26},
+    {MSG_END, 0},
+    {MSG_TEXT, 36},
+    {MSG_END, 0},
+    {MSG_TEXT, 48},
+    {MSG_END, 0},
+    {MSG_TEXT, 37},
+    {MSG_END, 0},
+    {MSG_TEXT, 5},
+    {MSG_END, 0},
+    {MSG_TEXT, 40},
+    {MSG_END, 0},
+    {MSG_TEXT, 46},
+    {MSG_END, 0},
+    {MSG_TEXT, 4},
+    {MSG_FLOOR, 5},
+    {MSG_TEXT, 46},
+    {MSG_END, 0},
+    {MSG_TEXT, 52},
+    {MSG_END, 0},
+    {MSG_TEXT, 58},
+    {MSG_END, 0},
+    {MSG_TEXT, 53},
+    {MSG_END, 0},
+    {MSG_TEXT, 40},
+    {MSG_END, 0},
+    {MSG_TEXT, 47},
+    {MSG_END, 0},
+    {MSG_TEXT, 45},
+    {MSG_END, 0},
+    {MSG_TEXT, 49},
+    {MSG_END, 0},
+    {MSG_TEXT, 27},
+    {MSG_END, 0},
+    {MSG_TEXT, 53},
+    {MSG_END, 0},
+    {MSG_TEXT, 51},
+    {MSG_END, 0},
+    {MSG_TEXT, 43},
+    {MSG_END, 0},
+    {MSG_TEXT, 31},
+    {MSG_END, 0},
+    {MSG_TEXT, 54},
+    {MSG_END, 0},
+    {MSG_TEXT, 47},
+    {MSG_END, 0},
+    {MSG_TEXT, 36},
+    {MSG_END, 0},
+    {MSG_TEXT, 65},
+    {MSG_END, 0},
+    {MSG_TEXT, 39},
+    {MSG_END, 0},
+    {MSG_TEXT, 63},
+    {MSG_END, 0},
+    {MSG_TEXT, 46},
+    {MSG_END, 0},
+};
+
+const uint32_t dungeon_lists[] = {
+    0, 0, 0, 0, 0, 0, 35508, 35513, 35529, 896,
+    0, 0, 0, 35569, 35574, 35594, 35630, 898, 900, 0,
+    0, 35662, 35684, 35705, 35718, 35739, 902, 904, 0, 0,
+    35758, 35783, 35810, 35827, 906, 0, 0, 0, 35874, 35888,
+    908, 0, 0, 0, 35874, 35952, 910, 0, 0, 0,
+    36016, 36029, 36066, 912, 914, 0, 0, 0, 36102, 36127,
+    36175, 36127, 916, 918, 916, 36211, 36250, 36309, 36377, 36250,
+    36485, 0, 0, 36833, 36850, 36906, 920, 922, 0, 0,
+    36963, 37023, 37121, 37127, 37147, 924, 0, 0, 0, 37188,
+    37201, 19494, 928, 0, 37241, 19494, 0, 0, 37274, 19494,
+    37289, 0, 930, 0, 0, 37325, 37358, 37398, 37418, 932,
+    0, 37525, 0, 37581, 37607, 934, 37669, 0, 0, 37714,
+    37743, 37807, 936, 938, 37889, 37959, 0, 0, 38020, 38026,
+    38032, 38038, 38062, 940, 0, 38128, 0, 38268, 38274, 0,
+    0, 0, 0, 0, 38280, 38286, 0, 0, 0, 0,
+    0, 38292, 38297, 38314, 942, 0, 0, 0, 38334, 38340,
+    38357, 38390, 38421, 944, 946, 948, 0, 0, 38452, 38486,
+    38520, 38552, 38558, 0, 0, 0, 0, 0, 38582, 0,
+    0, 0, 0, 0, 38604, 19494, 19494, 0, 0, 0,
+    0, 19494, 38618, 38711, 38717, 38730, 38801, 38893, 950, 952,
+    954, 38962, 39012, 39049, 0, 39094, 39161, 39217, 38711, 19494,
+    39297, 39364, 0, 956, 958, 0, 0, 0, 39434, 19494,
+    0, 0, 0, 0, 39452, 39458, 39464, 39500, 960, 0,
+    0, 0, 39565, 39581, 39609, 962, 964, 0, 0, 19494,
+    39654, 39720, 0, 0, 0, 0, 0, 39741, 39747, 39753,
+    0, 0, 0, 0, 0, 39773, 39787, 39828, 39897, 966,
+    968, 970, 39960, 40017, 40017, 0, 19494, 40058, 40159, 40200,
+    40213, 40345, 972, 974, 0, 0, 19494, 40428, 40660, 40673,
+    40767, 19494, 976, 978, 0, 40832, 40832, 19494, 0, 19494,
+    19494, 40893, 40660, 41045, 980, 0, 0, 0, 41078, 41083,
+    41154, 41214, 19494, 982, 984, 986, 0, 0, 0, 19494,
+    41272, 19494, 19494, 41392, 41422, 988, 0, 41559, 0, 41626,
+    41632, 0, 0, 0, 0, 0, 41661, 41667, 41690, 41829,
+    990, 992, 0, 41912, 41912, 41958, 42012, 42136, 42152, 42184,
+    994, 996, 0, 0, 0, 42236, 42242, 0, 0, 0,
+    0, 0, 42283, 42294, 998, 42336, 0, 0, 42384, 42393,
+    42430, 42479, 1000, 1002, 1004, 0, 0, 42540, 42577, 42598,
+    42618, 19494, 42632, 0, 1006, 0, 0, 0, 42680, 19494,
+    0, 0, 0, 0, 42693, 19494, 42710, 0, 1008, 0,
+    0, 42777, 42710, 42810, 42816, 42841, 1010, 0, 0, 0,
+    42911, 19494, 0, 0, 42920, 0, 42939, 19494, 0, 0,
+    42950, 0, 42982, 19494, 19494, 0, 0, 0, 42993, 43103,
+    0, 43143, 43148, 43172, 1012, 0, 0, 0, 43220, 43243,
+    1014, 0, 0, 0, 43268, 43274, 43294, 1016, 0, 0,
+    0, 43325, 43348, 1018, 0, 0, 0, 43380, 43397, 1020,
+    0, 0, 0, 43424, 43430, 43434, 43455, 1022, 0, 0,
+    0, 43492, 43497, 43501, 43518, 43567, 43605, 1024, 1026, 1028,
+    0, 0, 0, 43611, 43633, 1030, 0, 0, 0, 43674,
+    43679, 43684, 43690, 43706, 43753, 43753, 1032, 1034, 1034, 0,
+    0, 43809, 43866, 43909, 43973, 43997, 44050, 1038, 1040, 0,
+    0, 0, 44109, 44115, 44138, 1042, 0, 0, 0, 44192,
+    44215, 1044, 0, 0, 0, 44256, 44260, 44278, 44326, 44372,
+    1046, 1048, 1050, 0, 0, 0, 44422, 44440, 1052, 0,
+    0, 0, 44468, 44487, 44541, 44593, 1054, 1056, 1058, 0,
+    0, 0, 44637, 44653, 44685, 1060, 1062, 0, 0, 0,
+    44740, 44745, 44765, 1064, 0, 0, 0, 44813, 44819, 44840,
+    44877, 1066, 1068, 0, 0, 0, 44943, 44963, 45003, 1070,
+    1072, 0, 0, 0, 45067, 45073, 45095, 1074, 0, 0,
+    0, 47441, 47446, 47451, 47457, 47463, 47469, 47475, 47481, 47487,
+    47493, 47498, 47504, 47510, 47516, 47522, 47526, 47532, 47537, 47543,
+    47549, 47555, 47561, 47567, 47572, 47576, 47582, 47588, 47594, 47600,
+    47603, 47609, 47614, 47620, 47625, 47631, 47637, 47641, 47647, 47653,
+    47659, 47664, 47670, 47673, 47675, 47681, 47687, 47689, 47695, 47700,
+    47706, 47710, 47716, 36016, 47722, 47727, 47732, 47738, 47743, 47748,
+    47754, 47759, 47765, 47770, 47772, 47777, 47779, 47785, 47787, 47793,
+    47795, 47798, 47801, 47804, 47807, 47813, 47818, 47823, 47829, 47832,
+    47838, 47840, 47842, 47847, 47853, 47859, 47865, 47871, 47876, 47881,
+    47886, 47892, 47898, 47904, 47910, 47916, 47922, 47927, 47933, 47939,
+    47945, 47951, 47957, 42693, 47963, 47968, 47974, 47976, 47982, 47987,
+    47992, 47998, 48004, 48010, 48014, 48019, 48025, 48030, 48036, 48041,
+    48047, 48052, 48056, 48062, 48067, 48073, 48090, 48096, 48101, 48103,
+    48109, 48114, 48120, 48126, 48129, 48135, 48139, 48144, 48150, 48156,
+    48161, 48167, 48172, 48177, 48181, 48187, 48190, 47481, 48196, 48202,
+    48208, 48213, 48219, 48224, 48230, 48234, 48240, 48245, 48250, 48254,
+    48260, 48392, 48488, 48494, 48499, 48504, 48509, 48515, 48517, 48523,
+    48558, 48584, 48590, 48596, 48602, 48608, 48614, 48618, 48622, 48626,
+    48630, 48634, 48649, 48654, 48660, 48666, 48672, 48678, 48683, 48689,
+    48695, 48701, 48706, 48712, 48718, 48722, 48728, 48734, 48754, 48781,
+    48809, 48815, 48821, 48826, 48832, 48838, 48844, 48900, 48905, 50853,
+    50856, 50861, 51226, 51230, 51325, 51358, 51525, 51540, 51611, 51616,
+    53064, 53069, 53123, 53140, 53733, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 15, 0, 15, 0, 18, 17, 19,
+    34, 0, 18, 17, 19, 34, 0, 0, 0, 15,
+    27, 0, 15, 27, 0, 15, 0, 15, 0, 15,
+    28, 29, 30, 74, 0, 15, 28, 29, 30, 74,
+    0, 0, 0, 0, 0, 15, 0, 15, 0, 67,
+    68, 25, 0, 67, 68, 25, 0, 67, 0, 67,
+    0, 23, 0, 23, 0, 88, 0, 88, 0, 17,
+    41, 0, 17, 41, 0, 19, 33, 36, 0, 19,
+    33, 36, 0, 19, 0, 19, 0, 19, 62, 0,
+    19, 62, 0, 0, 0, 19, 0, 19, 0, 28,
+    34, 35, 0, 28, 34, 35, 0, 33, 15, 0,
+    33, 15, 0, 33, 0, 33, 0, 37, 28, 39,
+    65, 0, 37, 28, 39, 65, 0, 36, 38, 0,
+    36, 38, 0, 37, 0, 37, 0, 36, 64, 65,
+    0, 36, 64, 65, 0, 41, 0, 41, 0, 42,
+    27, 60, 0, 42, 27, 60, 0, 41, 43, 45,
+    80, 0, 41, 43, 45, 80, 0, 42, 44, 45,
+    0, 42, 44, 45, 0, 43, 48, 50, 82, 0,
+    43, 50, 0, 42, 43, 46, 47, 87, 0, 42,
+    43, 87, 0, 45, 0, 45, 0, 45, 0, 45,
+    0, 44, 0, 44, 0, 50, 51, 0, 50, 51,
+    0, 44, 49, 51, 52, 0, 44, 49, 51, 52,
+    0, 49, 50, 52, 53, 0, 49, 50, 52, 53,
+    0, 50, 51, 53, 55, 86, 0, 50, 51, 53,
+    55, 0, 51, 52, 54, 0, 51, 52, 0, 53,
+    0, 53, 0, 52, 56, 57, 0, 52, 57, 0,
+    55, 0, 55, 0, 55, 58, 83, 84, 0, 55,
+    83, 84, 0, 57, 0, 57, 0, 27, 0, 27,
+    0, 41, 61, 62, 0, 41, 61, 62, 0, 60,
+    62, 0, 60, 62, 0, 60, 63, 30, 61, 0,
+    60, 63, 30, 61, 0, 62, 0, 62, 0, 39,
+    65, 103, 106, 0, 39, 65, 103, 106, 0, 64,
+    66, 68, 70, 39, 72, 71, 106, 0, 64, 66,
+    68, 70, 39, 72, 71, 106, 0, 65, 67, 77,
+    96, 97, 0, 65, 67, 77, 96, 97, 0, 66,
+    23, 24, 0, 66, 23, 24, 0, 23, 69, 65,
+    0, 23, 69, 65, 0, 68, 120, 119, 109, 113,
+    0, 68, 120, 119, 109, 113, 0, 71, 65, 111,
+    0, 71, 65, 111, 0, 65, 70, 110, 0, 65,
+    70, 110, 0, 65, 118, 73, 97, 0, 65, 118,
+    73, 97, 0, 72, 0, 72, 0, 19, 120, 121,
+    75, 0, 19, 120, 121, 75, 0, 76, 77, 0,
+    76, 77, 0, 75, 0, 75, 0, 75, 78, 66,
+    0, 75, 78, 66, 0, 77, 0, 77, 0, 0,
+    0, 42, 81, 0, 42, 81, 0, 80, 0, 80,
+    0, 44, 0, 44, 0, 57, 84, 85, 0, 57,
+    84, 0, 57, 83, 114, 0, 57, 83, 114, 0,
+    83, 0, 83, 0, 52, 0, 52, 0, 45, 0,
+    45, 0, 25, 92, 0, 25, 92, 0, 25, 0,
+    25, 0, 23, 0, 23, 0, 95, 72, 0, 95,
+    72, 0, 88, 93, 94, 0, 88, 93, 94, 0,
+    92, 0, 92, 0, 92, 95, 0, 92, 95, 0,
+    94, 92, 91, 0, 94, 92, 91, 0, 66, 0,
+    66, 0, 66, 72, 98, 0, 66, 72, 98, 0,
+    97, 99, 0, 97, 99, 0, 98, 100, 0, 98,
+    100, 0, 99, 101, 0, 99, 101, 0, 100, 0,
+    100, 0, 103, 0, 103, 0, 102, 104, 64, 0,
+    102, 104, 64, 0, 103, 105, 0, 103, 105, 0,
+    104, 103, 0, 104, 103, 0, 64, 65, 108, 0,
+    64, 65, 108, 0, 131, 132, 133, 134, 135, 136,
+    137, 138, 139, 61, 0, 131, 132, 133, 134, 135,
+    136, 137, 138, 139, 61, 0, 106, 0, 106, 0,
+    69, 113, 0, 69, 113, 0, 71, 0, 71, 0,
+    70, 50, 53, 45, 0, 70, 50, 53, 45, 0,
+    131, 132, 133, 134, 135, 136, 137, 138, 139, 140,
+    0, 131, 132, 133, 134, 135, 136, 137, 138, 139,
+    140, 0, 109, 168, 0, 109, 168, 0, 84, 0,
+    84, 0, 116, 0, 116, 0, 115, 0, 115, 0,
+    118, 0, 118, 0, 72, 117, 0, 72, 117, 0,
+    69, 0, 69, 0, 69, 74, 0, 69, 74, 0,
+    74, 0, 74, 0, 123, 124, 126, 129, 0, 0,
+    122, 124, 126, 129, 0, 0, 123, 125, 128, 126,
+    129, 0, 0, 124, 126, 127, 0, 0, 125, 124,
+    0, 0, 125, 124, 126, 0, 0, 124, 129, 126,
+    0, 0, 128, 124, 130, 126, 0, 0, 129, 124,
+    126, 0, 0, 107, 132, 133, 134, 135, 136, 137,
+    138, 139, 112, 0, 107, 132, 133, 134, 135, 136,
+    137, 138, 139, 112, 0, 107, 131, 133, 134, 135,
+    136, 137, 138, 139, 112, 0, 107, 131, 133, 134,
+    135, 136, 137, 138, 139, 112, 0, 107, 131, 132,
+    134, 135, 136, 137, 138, 139, 112, 0, 107, 131,
+    132, 134, 135, 136, 137, 138, 139, 112, 0, 107,
+    131, 132, 133, 135, 136, 137, 138, 139, 112, 0,
+    107, 131, 132, 133, 135, 136, 137, 138, 139, 112,
+    0, 107, 131, 132, 133, 134, 136, 137, 138, 139,
+    112, 0, 107, 131, 132, 133, 134, 136, 137, 138,
+    139, 112, 0, 107, 131, 132, 133, 134, 135, 137,
+    138, 139, 112, 0, 107, 131, 132, 133, 134, 135,
+    137, 138, 139, 112, 0, 107, 131, 132, 133, 134,
+    135, 136, 138, 139, 112, 0, 107, 131, 132, 133,
+    134, 135, 136, 138, 139, 112, 0, 107, 131, 132,
+    133, 134, 135, 136, 137, 139, 112, 0, 107, 131,
+    132, 133, 134, 135, 136, 137, 139, 112, 0, 107,
+    131, 132, 133, 134, 135, 136, 137, 138, 112, 0,
+    107, 131, 132, 133, 134, 135, 136, 137, 138, 112,
+    0, 112, 141, 0, 112, 141, 0, 140, 143, 0,
+    140, 143, 0, 140, 0, 140, 0, 141, 144, 0,
+    141, 144, 0, 143, 0, 143, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 169, 113, 0, 169, 113, 0, 168,
+    170, 0, 168, 170, 0, 171, 169, 0, 171, 169,
+    0, 170, 172, 0, 170, 172, 0, 171, 173, 0,
+    171, 173, 0, 172, 0, 172, 0, 0, 0, 176,
+    0, 176, 0, 173, 177, 0, 173, 177, 0, 176,
+    0, 176, 0, 0, 0, 0, 0, 0, 0, 33,
+    0, 33, 0, 0, 0, 100, 0, 100, 0, 33,
+    0, 33, 0
+};
+
+const string_t arbitrary_messages[] = {
+    0,
+    1,
+    678,
+    727,
+    842,
+    904,
+    962,
+    1002,
+    1031,
+    1044,
+    1055,
+    1126,
+    1236,
+    1278,
+    1320,
+    1423,
+    1494,
+    1541,
+    1573,
+    1628,
+    1657,
+    1679,
+    1780,
+    1829,
+    1864,
+    1888,
+    1980,
+    1998,
+    2014,
+    2063,
+    2086,
+    2111,
+    2201,
+    2218,
+    2225,
+    2258,
+    2309,
+    2370,
+    2397,
+    2454,
+    2483,
+    2521,
+    2561,
+    2564,
+    2591,
+    2675,
+    2790,
+    2836,
+    2954,
+    2991,
+    2996,
+    3049,
+    3077,
+    3100,
+    3133,
+    3162,
+    3201,
+    3245,
+    3266,
+    3277,
+    3342,
+    3411,
+    3454,
+    3502,
+    3541,
+    3609,
+    3645,
+    3675,
+    3716,
+    3802,
+    3840,
+    3899,
+    3968,
+    4007,
+    4036,
+    4089,
+    4110,
+    4159,
+    4230,
+    4296,
+    4361,
+    4472,
+    4535,
+    4600,
+    4666,
+    4722,
+    4780,
+    4977,
+    5069,
+    5201,
+    5263,
+    5484,
+    5617,
+    5734,
+    5859,
+    6066,
+    6335,
+    6545,
+    6632,
+    6808,
+    6847,
+    6901,
+    6932,
+    6983,
+    7044,
+    7089,
+    7157,
+    7193,
+    7211,
+    7246,
+    7326,
+    7380,
+    7443,
+    7480,
+    7538,
+    7600,
+    7716,
+    7842,
+    7978,
+    8116,
+    8180,
+    8216,
+    8261,
+    8318,
+    8373,
+    8426,
+    8465,
+    8492,
+    8519,
+    8544,
+    8600,
+    8622,
+    8687,
+    8876,
+    8908,
+    8936,
+    9254,
+    9321,
+    9399,
+    9496,
+    9590,
+    9708,
+    9844,
+    9875,
+    9931,
+    10036,
+    10056,
+    10094,
+    10213,
+    10391,
+    10568,
+    10614,
+    10656,
+    10827,
+    10958,
+    11011,
+    11043,
+    11089,
+    11160,
+    11634,
+    11677,
+    11714,
+    11778,
+    11870,
+    11916,
+    11955,
+    12002,
+    12080,
+    12136,
+    12333,
+    12376,
+    12391,
+    12424,
+    12465,
+    12507,
+    12563,
+    12640,
+    12684,
+    12730,
+    12759,
+    12818,
+    12982,
+    13031,
+    13070,
+    13109,
+    0,
+    13133,
+    13183,
+    13215,
+    13235,
+    13257,
+    13280,
+    13315,
+    13351,
+    13369,
+    13378,
+    13390,
+    13457,
+    13555,
+    13622,
+    13675,
+    13736,
+    13811,
+    13840,
+    13906,
+    13972,
+    14181,
+    14281,
+    14407,
+};
+
+const msgops_t arbitrary_message_ops[] = {
+    0,
+    1,
+    3,
+    5,
+    7,
+    11,
+    13,
+    15,
+    17,
+    19,
+    21,
+    23,
+    25,
+    27,
+    29,
+    31,
+    33,
+    35,
+    37,
+    39,
+    41,
+    43,
+    45,
+    47,
+    49,
+    51,
+    53,
+    55,
+    57,
+    59,
+    61,
+    63,
+    65,
+    67,
+    69,
+    71,
+    73,
+    75,
+    77,
+    79,
+    81,
+    83,
+    85,
+    87,
+    89,
+    91,
+    93,
+    95,
+    97,
+    99,
+    101,
+    103,
+    105,
+    107,
+    109,
+    111,
+    113,
+    115,
+    117,
+    119,
+    121,
+    123,
+    125,
+    127,
+    129,
+    131,
+    133,
+    135,
+    137,
+    139,
+    141,
+    143,
+    145,
+    147,
+    149,
+    151,
+    153,
+    155,
+    157,
+    159,
+    161,
+    163,
+    165,
+    167,
+    169,
+    171,
+    173,
+    175,
+    177,
+    179,
+    181,
+    183,
+    185,
+    187,
+    189,
+    191,
+    193,
+    195,
+    197,
+    199,
+    201,
+    203,
+    205,
+    207,
+    209,
+    211,
+    213,
+    215,
+    217,
+    219,
+    221,
+    223,
+    225,
+    227,
+    229,
+    231,
+    233,
+    235,
+    237,
+    239,
+    241,
+    243,
+    245,
+    247,
+    249,
+    251,
+    253,
+    255,
+    257,
+    259,
+    261,
+    263,
+    265,
+    267,
+    269,
+    271,
+    273,
+    275,
+    277,
+    279,
+    281,
+    283,
+    285,
+    287,
+    289,
+    291,
+    293,
+    295,
+    297,
+    299,
+    301,
+    303,
+    305,
+    307,
+    309,
+    311,
+    313,
+    315,
+    317,
+    319,
+    321,
+    323,
+    325,
+    327,
+    329,
+    331,
+    333,
+    335,
+    337,
+    339,
+    341,
+    343,
+    345,
+    347,
+    349,
+    351,
+    353,
+    355,
+    357,
+    359,
+    361,
+    363,
+    365,
+    367,
+    369,
+    0,
+    371,
+    373,
+    376,
+    379,
+    381,
+    383,
+    387,
+    391,
+    395,
+    398,
+    402,
+    412,
+    414,
+    420,
+    430,
+    436,
+    438,
+    440,
+    442,
+    444,
+    454,
+    456,
+    458,
+};
+
+const class_t classes[] = {
+    {
+        .threshold = 0,
+        .message = 0,
+    },
+    {
+        .threshold = 45,
+        .message = 14449,
+    },
+    {
+        .threshold = 120,
+        .message = 14507,
+    },
+    {
+        .threshold = 170,
+        .message = 14562,
+    },
+    {
+        .threshold = 250,
+        .message = 14618,
+    },
+    {
+        .threshold = 320,
+        .message = 14673,
+    },
+    {
+        .threshold = 375,
+        .message = 14714,
+    },
+    {
+        .threshold = 410,
+        .message = 14764,
+    },
+    {
+        .threshold = 426,
+        .message = 14814,
+    },
+    {
+        .threshold = 429,
+        .message = 14864,
+    },
+    {
+        .threshold = 9999,
+        .message = 14930,
+    },
+};
+
+const turn_threshold_t turn_thresholds[] = {
+    {
+        .threshold = 350,
+        .point_loss = 2,
+        .message = 15198,
+    },
+    {
+        .threshold = 500,
+        .point_loss = 3,
+        .message = 15293,
+    },
+    {
+        .threshold = 1000,
+        .point_loss = 5,
+        .message = 15344,
+    },
+    {
+        .threshold = 2500,
+        .point_loss = 10,
+        .message = 15408,
+    },
+};
+
+const location_t locations[] = {
+    { // 0: LOC_NOWHERE
+        .description = {
+            .small = 0,
+            .big = 0,
+            .small_ops = 0,
+            .big_ops = 0,
+        },
+    },
+    { // 1: LOC_START
+        .description = {
+            .small = 15582,
+            .big = 15611,
+            .small_ops = 460,
+            .big_ops = 462,
+        },
+    },
+    { // 2: LOC_HILL
+        .description = {
+            .small = 15764,
+            .big = 15788,
+            .small_ops = 464,
+            .big_ops = 466,
+        },
+    },
+    { // 3: LOC_BUILDING
+        .description = {
+            .small = 15929,
+            .big = 15953,
+            .small_ops = 468,
+            .big_ops = 470,
+        },
+    },
+    { // 4: LOC_VALLEY
+        .description = {
+            .small = 16013,
+            .big = 16031,
+            .small_ops = 472,
+            .big_ops = 474,
+        },
+    },
+    { // 5: LOC_ROADEND
+        .description = {
+            .small = 16109,
+            .big = 16132,
+            .small_ops = 476,
+            .big_ops = 478,
+        },
+    },
+    { // 6: LOC_CLIFF
+        .description = {
+            .small = 16200,
+            .big = 16217,
+            .small_ops = 480,
+            .big_ops = 482,
+        },
+    },
+    { // 7: LOC_SLIT
+        .description = {
+            .small = 16351,
+            .big = 16380,
+            .small_ops = 484,
+            .big_ops = 486,
+        },
+    },
+    { // 8: LOC_GRATE
+        .description = {
+            .small = 16502,
+            .big = 16524,
+            .small_ops = 488,
+            .big_ops = 490,
+        },
+    },
+    { // 9: LOC_BELOWGRATE
+        .description = {
+            .small = 16688,
+            .big = 16712,
+            .small_ops = 492,
+            .big_ops = 494,
+        },
+    },
+    { // 10: LOC_COBBLE
+        .description = {
+            .small = 16832,
+            .big = 16856,
+            .small_ops = 496,
+            .big_ops = 498,
+        },
+    },
+    { // 11: LOC_DEBRIS
+        .description = {
+            .small = 16958,
+            .big = 16981,
+            .small_ops = 500,
+            .big_ops = 502,
+        },
+    },
+    { // 12: LOC_AWKWARD
+        .description = {
+            .small = 0,
+            .big = 17225,
+            .small_ops = 0,
+            .big_ops = 504,
+        },
+    },
+    { // 13: LOC_BIRD
+        .description = {
+            .small = 17273,
+            .big = 17297,
+            .small_ops = 506,
+            .big_ops = 508,
+        },
+    },
+    { // 14: LOC_PITTOP
+        .description = {
+            .small = 17475,
+            .big = 17503,
+            .small_ops = 510,
+            .big_ops = 512,
+        },
+    },
+    { // 15: LOC_MISTHALL
+        .description = {
+            .small = 17627,
+            .big = 17652,
+            .small_ops = 514,
+            .big_ops = 516,
+        },
+    },
+    { // 16: LOC_CRACK
+        .description = {
+            .small = 0,
+            .big = 17989,
+            .small_ops = 0,
+            .big_ops = 518,
+        },
+    },
+    { // 17: LOC_EASTBANK
+        .description = {
+            .small = 18096,
+            .big = 18128,
+            .small_ops = 520,
+            .big_ops = 522,
+        },
+    },
+    { // 18: LOC_NUGGET
+        .description = {
+            .small = 18264,
+            .big = 18295,
+            .small_ops = 524,
+            .big_ops = 526,
+        },
+    },
+    { // 19: LOC_KINGHALL
+        .description = {
+            .small = 18394,
+            .big = 18421,
+            .small_ops = 528,
+            .big_ops = 530,
+        },
+    },
+    { // 20: LOC_NECKBROKE
+        .description = {
+            .small = 0,
+            .big = 18500,
+            .small_ops = 0,
+            .big_ops = 532,
+        },
+    },
+    { // 21: LOC_NOMAKE
+        .description = {
+            .small = 0,
+            .big = 18553,
+            .small_ops = 0,
+            .big_ops = 534,
+        },
+    },
+    { // 22: LOC_DOME
+        .description = {
+            .small = 0,
+            .big = 18573,
+            .small_ops = 0,
+            .big_ops = 536,
+        },
+    },
+    { // 23: LOC_WESTEND
+        .description = {
+            .small = 18598,
+            .big = 18633,
+            .small_ops = 538,
+            .big_ops = 540,
+        },
+    },
+    { // 24: LOC_EASTPIT
+        .description = {
+            .small = 18751,
+            .big = 18771,
+            .small_ops = 542,
+            .big_ops = 544,
+        },
+    },
+    { // 25: LOC_WESTPIT
+        .description = {
+            .small = 18888,
+            .big = 18908,
+            .small_ops = 546,
+            .big_ops = 548,
+        },
+    },
+    { // 26: LOC_CLIMBSTALK
+        .description = {
+            .small = 0,
+            .big = 19029,
+            .small_ops = 0,
+            .big_ops = 550,
+        },
+    },
+    { // 27: LOC_WESTBANK
+        .description = {
+            .small = 19094,
+            .big = 19126,
+            .small_ops = 552,
+            .big_ops = 554,
+        },
+    },
+    { // 28: LOC_FLOORHOLE
+        .description = {
+            .small = 19188,
+            .big = 19229,
+            .small_ops = 556,
+            .big_ops = 558,
+        },
+    },
+    { // 29: LOC_SOUTHSIDE
+        .description = {
+            .small = 0,
+            .big = 19321,
+            .small_ops = 0,
+            .big_ops = 562,
+        },
+    },
+    { // 30: LOC_WESTSIDE
+        .description = {
+            .small = 19356,
+            .big = 19389,
+            .small_ops = 564,
+            .big_ops = 566,
+        },
+    },
+    { // 31: LOC_BUILDING1
+        .description = {
+            .small = 0,
+            .big = 19494,
+            .small_ops = 0,
+            .big_ops = 0,
+        },
+    },
+    { // 32: LOC_SNAKEBLOCK
+        .description = {
+            .small = 0,
+            .big = 19495,
+            .small_ops = 0,
+            .big_ops = 568,
+        },
+    },
+    { // 33: LOC_Y2
+        .description = {
+            .small = 19523,
+            .big = 19539,
+            .small_ops = 570,
+            .big_ops = 572,
+        },
+    },
+    { // 34: LOC_JUMBLE
+        .description = {
+            .small = 0,
+            .big = 19710,
+            .small_ops = 0,
+            .big_ops = 574,
+        },
+    },
+    { // 35: LOC_WINDOW1
+        .description = {
+            .small = 19763,
+            .big = 19788,
+            .small_ops = 576,
+            .big_ops = 578,
+        },
+    },
+    { // 36: LOC_BROKEN
+        .description = {
+            .small = 20259,
+            .big = 20284,
+            .small_ops = 584,
+            .big_ops = 586,
+        },
+    },
+    { // 37: LOC_SMALLPITBRINK
+        .description = {
+            .small = 20418,
+            .big = 20448,
+            .small_ops = 588,
+            .big_ops = 590,
+        },
+    },
+    { // 38: LOC_SMALLPIT
+        .description = {
+            .small = 20522,
+            .big = 20559,
+            .small_ops = 592,
+            .big_ops = 594,
+        },
+    },
+    { // 39: LOC_DUSTY
+        .description = {
+            .small = 20661,
+            .big = 20688,
+            .small_ops = 596,
+            .big_ops = 598,
+        },
+    },
+    { // 40: LOC_PARALLEL1
+        .description = {
+            .small = 0,
+            .big = 20826,
+            .small_ops = 0,
+            .big_ops = 602,
+        },
+    },
+    { // 41: LOC_MISTWEST
+        .description = {
+            .small = 20919,
+            .big = 20956,
+            .small_ops = 604,
+            .big_ops = 606,
+        },
+    },
+    { // 42: LOC_ALIKE1
+        .description = {
+            .small = 0,
+            .big = 21115,
+            .small_ops = 0,
+            .big_ops = 610,
+        },
+    },
+    { // 43: LOC_ALIKE2
+        .description = {
+            .small = 0,
+            .big = 21115,
+            .small_ops = 0,
+            .big_ops = 610,
+        },
+    },
+    { // 44: LOC_ALIKE3
+        .description = {
+            .small = 0,
+            .big = 21115,
+            .small_ops = 0,
+            .big_ops = 610,
+        },
+    },
+    { // 45: LOC_ALIKE4
+        .description = {
+            .small = 0,
+            .big = 21115,
+            .small_ops = 0,
+            .big_ops = 610,
+        },
+    },
+    { // 46: LOC_DEADEND1
+        .description = {
+            .small = 0,
+            .big = 21171,
+            .small_ops = 0,
+            .big_ops = 612,
+        },
+    },
+    { // 47: LOC_DEADEND2
+        .description = {
+            .small = 0,
+            .big = 21171,
+            .small_ops = 0,
+            .big_ops = 612,
+        },
+    },
+    { // 48: LOC_DEADEND3
+        .description = {
+            .small = 0,
+            .big = 21171,
+            .small_ops = 0,
+            .big_ops = 612,
+        },
+    },
+    { // 49: LOC_ALIKE5
+        .description = {
+            .small = 0,
+            .big = 21115,
+            .small_ops = 0,
+            .big_ops = 610,
+        },
+    },
+    { // 50: LOC_ALIKE6
+        .description = {
+            .small = 0,
+            .big = 21115,
+            .small_ops = 0,
+            .big_ops = 610,
+        },
+    },
+    { // 51: LOC_ALIKE7
+        .description = {
+            .small = 0,
+            .big = 21115,
+            .small_ops = 0,
+            .big_ops = 610,
+        },
+    },
+    { // 52: LOC_ALIKE8
+        .description = {
+            .small = 0,
+            .big = 21115,
+            .small_ops = 0,
+            .big_ops = 610,
+        },
+    },
+    { // 53: LOC_ALIKE9
+        .description = {
+            .small = 0,
+            .big = 21115,
+            .small_ops = 0,
+            .big_ops = 610,
+        },
+    },
+    { // 54: LOC_DEADEND4
+        .description = {
+            .small = 0,
+            .big = 21171,
+            .small_ops = 0,
+            .big_ops = 612,
+        },
+    },
+    { // 55: LOC_ALIKE10
+        .description = {
+            .small = 0,
+            .big = 21115,
+            .small_ops = 0,
+            .big_ops = 610,
+        },
+    },
+    { // 56: LOC_DEADEND5
+        .description = {
+            .small = 0,
+            .big = 21171,
+            .small_ops = 0,
+            .big_ops = 612,
+        },
+    },
+    { // 57: LOC_PITBRINK
+        .description = {
+            .small = 21180,
+            .big = 21204,
+            .small_ops = 614,
+            .big_ops = 616,
+        },
+    },
+    { // 58: LOC_DEADEND6
+        .description = {
+            .small = 0,
+            .big = 21171,
+            .small_ops = 0,
+            .big_ops = 612,
+        },
+    },
+    { // 59: LOC_PARALLEL2
+        .description = {
+            .small = 0,
+            .big = 20826,
+            .small_ops = 0,
+            .big_ops = 602,
+        },
+    },
+    { // 60: LOC_LONGEAST
+        .description = {
+            .small = 21383,
+            .big = 21416,
+            .small_ops = 618,
+            .big_ops = 620,
+        },
+    },
+    { // 61: LOC_LONGWEST
+        .description = {
+            .small = 21584,
+            .big = 21617,
+            .small_ops = 622,
+            .big_ops = 624,
+        },
+    },
+    { // 62: LOC_CROSSOVER
+        .description = {
+            .small = 0,
+            .big = 21728,
+            .small_ops = 0,
+            .big_ops = 626,
+        },
+    },
+    { // 63: LOC_DEADEND7
+        .description = {
+            .small = 0,
+            .big = 21171,
+            .small_ops = 0,
+            .big_ops = 612,
+        },
+    },
+    { // 64: LOC_COMPLEX
+        .description = {
+            .small = 21792,
+            .big = 21820,
+            .small_ops = 628,
+            .big_ops = 630,
+        },
+    },
+    { // 65: LOC_BEDQUILT
+        .description = {
+            .small = 22028,
+            .big = 22048,
+            .small_ops = 632,
+            .big_ops = 634,
+        },
+    },
+    { // 66: LOC_SWISSCHEESE
+        .description = {
+            .small = 22172,
+            .big = 22201,
+            .small_ops = 636,
+            .big_ops = 638,
+        },
+    },
+    { // 67: LOC_EASTEND
+        .description = {
+            .small = 22355,
+            .big = 22390,
+            .small_ops = 640,
+            .big_ops = 642,
+        },
+    },
+    { // 68: LOC_SLAB
+        .description = {
+            .small = 22721,
+            .big = 22742,
+            .small_ops = 646,
+            .big_ops = 648,
+        },
+    },
+    { // 69: LOC_SECRET1
+        .description = {
+            .small = 0,
+            .big = 23034,
+            .small_ops = 0,
+            .big_ops = 652,
+        },
+    },
+    { // 70: LOC_SECRET2
+        .description = {
+            .small = 0,
+            .big = 23085,
+            .small_ops = 0,
+            .big_ops = 654,
+        },
+    },
+    { // 71: LOC_THREEJUNCTION
+        .description = {
+            .small = 23141,
+            .big = 23185,
+            .small_ops = 656,
+            .big_ops = 658,
+        },
+    },
+    { // 72: LOC_LOWROOM
+        .description = {
+            .small = 23327,
+            .big = 23353,
+            .small_ops = 660,
+            .big_ops = 662,
+        },
+    },
+    { // 73: LOC_DEADCRAWL
+        .description = {
+            .small = 0,
+            .big = 23414,
+            .small_ops = 0,
+            .big_ops = 664,
+        },
+    },
+    { // 74: LOC_SECRET3
+        .description = {
+            .small = 23430,
+            .big = 23478,
+            .small_ops = 666,
+            .big_ops = 668,
+        },
+    },
+    { // 75: LOC_WIDEPLACE
+        .description = {
+            .small = 0,
+            .big = 23630,
+            .small_ops = 0,
+            .big_ops = 670,
+        },
+    },
+    { // 76: LOC_TIGHTPLACE
+        .description = {
+            .small = 0,
+            .big = 23682,
+            .small_ops = 0,
+            .big_ops = 672,
+        },
+    },
+    { // 77: LOC_TALL
+        .description = {
+            .small = 0,
+            .big = 23737,
+            .small_ops = 0,
+            .big_ops = 674,
+        },
+    },
+    { // 78: LOC_BOULDERS1
+        .description = {
+            .small = 0,
+            .big = 23826,
+            .small_ops = 0,
+            .big_ops = 676,
+        },
+    },
+    { // 79: LOC_SEWER
+        .description = {
+            .small = 0,
+            .big = 23879,
+            .small_ops = 0,
+            .big_ops = 678,
+        },
+    },
+    { // 80: LOC_ALIKE11
+        .description = {
+            .small = 0,
+            .big = 21115,
+            .small_ops = 0,
+            .big_ops = 610,
+        },
+    },
+    { // 81: LOC_DEADEND8
+        .description = {
+            .small = 0,
+            .big = 21171,
+            .small_ops = 0,
+            .big_ops = 612,
+        },
+    },
+    { // 82: LOC_DEADEND9
+        .description = {
+            .small = 0,
+            .big = 21171,
+            .small_ops = 0,
+            .big_ops = 612,
+        },
+    },
+    { // 83: LOC_ALIKE12
+        .description = {
+            .small = 0,
+            .big = 21115,
+            .small_ops = 0,
+            .big_ops = 610,
+        },
+    },
+    { // 84: LOC_ALIKE13
+        .description = {
+            .small = 0,
+            .big = 21115,
+            .small_ops = 0,
+            .big_ops = 610,
+        },
+    },
+    { // 85: LOC_DEADEND10
+        .description = {
+            .small = 0,
+            .big = 21171,
+            .small_ops = 0,
+            .big_ops = 612,
+        },
+    },
+    { // 86: LOC_DEADEND11
+        .description = {
+            .small = 0,
+            .big = 21171,
+            .small_ops = 0,
+            .big_ops = 612,
+        },
+    },
+    { // 87: LOC_ALIKE14
+        .description = {
+            .small = 0,
+            .big = 21115,
+            .small_ops = 0,
+            .big_ops = 610,
+        },
+    },
+    { // 88: LOC_NARROW
+        .description = {
+            .small = 23986,
+            .big = 24013,
+            .small_ops = 680,
+            .big_ops = 682,
+        },
+    },
+    { // 89: LOC_NOCLIMB
+        .description = {
+            .small = 0,
+            .big = 24164,
+            .small_ops = 0,
+            .big_ops = 684,
+        },
+    },
+    { // 90: LOC_PLANTTOP
+        .description = {
+            .small = 0,
+            .big = 24233,
+            .small_ops = 0,
+            .big_ops = 686,
+        },
+    },
+    { // 91: LOC_INCLINE
+        .description = {
+            .small = 24283,
+            .big = 24325,
+            .small_ops = 688,
+            .big_ops = 690,
+        },
+    },
+    { // 92: LOC_GIANTROOM
+        .description = {
+            .small = 24497,
+            .big = 24519,
+            .small_ops = 692,
+            .big_ops = 694,
+        },
+    },
+    { // 93: LOC_CAVEIN
+        .description = {
+            .small = 0,
+            .big = 24726,
+            .small_ops = 0,
+            .big_ops = 696,
+        },
+    },
+    { // 94: LOC_IMMENSE
+        .description = {
+            .small = 0,
+            .big = 24775,
+            .small_ops = 0,
+            .big_ops = 698,
+        },
+    },
+    { // 95: LOC_WATERFALL
+        .description = {
+            .small = 24829,
+            .big = 24862,
+            .small_ops = 700,
+            .big_ops = 702,
+        },
+    },
+    { // 96: LOC_SOFTROOM
+        .description = {
+            .small = 25068,
+            .big = 25089,
+            .small_ops = 706,
+            .big_ops = 708,
+        },
+    },
+    { // 97: LOC_ORIENTAL
+        .description = {
+            .small = 25221,
+            .big = 25246,
+            .small_ops = 712,
+            .big_ops = 714,
+        },
+    },
+    { // 98: LOC_MISTY
+        .description = {
+            .small = 25441,
+            .big = 25465,
+            .small_ops = 716,
+            .big_ops = 718,
+        },
+    },
+    { // 99: LOC_ALCOVE
+        .description = {
+            .small = 25706,
+            .big = 25724,
+            .small_ops = 720,
+            .big_ops = 722,
+        },
+    },
+    { // 100: LOC_PLOVER
+        .description = {
+            .small = 25924,
+            .big = 25947,
+            .small_ops = 724,
+            .big_ops = 726,
+        },
+    },
+    { // 101: LOC_DARKROOM
+        .description = {
+            .small = 26076,
+            .big = 26097,
+            .small_ops = 728,
+            .big_ops = 730,
+        },
+    },
+    { // 102: LOC_ARCHED
+        .description = {
+            .small = 26166,
+            .big = 26189,
+            .small_ops = 732,
+            .big_ops = 734,
+        },
+    },
+    { // 103: LOC_SHELLROOM
+        .description = {
+            .small = 26331,
+            .big = 26353,
+            .small_ops = 736,
+            .big_ops = 738,
+        },
+    },
+    { // 104: LOC_SLOPING1
+        .description = {
+            .small = 0,
+            .big = 26614,
+            .small_ops = 0,
+            .big_ops = 742,
+        },
+    },
+    { // 105: LOC_CULDESAC
+        .description = {
+            .small = 0,
+            .big = 26674,
+            .small_ops = 0,
+            .big_ops = 744,
+        },
+    },
+    { // 106: LOC_ANTEROOM
+        .description = {
+            .small = 26723,
+            .big = 26743,
+            .small_ops = 746,
+            .big_ops = 748,
+        },
+    },
+    { // 107: LOC_DIFFERENT1
+        .description = {
+            .small = 0,
+            .big = 27005,
+            .small_ops = 0,
+            .big_ops = 750,
+        },
+    },
+    { // 108: LOC_WITTSEND
+        .description = {
+            .small = 27065,
+            .big = 27087,
+            .small_ops = 752,
+            .big_ops = 754,
+        },
+    },
+    { // 109: LOC_MIRRORCANYON
+        .description = {
+            .small = 27150,
+            .big = 27175,
+            .small_ops = 756,
+            .big_ops = 758,
+        },
+    },
+    { // 110: LOC_WINDOW2
+        .description = {
+            .small = 19763,
+            .big = 27644,
+            .small_ops = 576,
+            .big_ops = 762,
+        },
+    },
+    { // 111: LOC_TOPSTALACTITE
+        .description = {
+            .small = 28114,
+            .big = 28143,
+            .small_ops = 768,
+            .big_ops = 770,
+        },
+    },
+    { // 112: LOC_DIFFERENT2
+        .description = {
+            .small = 0,
+            .big = 28346,
+            .small_ops = 0,
+            .big_ops = 772,
+        },
+    },
+    { // 113: LOC_RESERVOIR
+        .description = {
+            .small = 28408,
+            .big = 28429,
+            .small_ops = 774,
+            .big_ops = 776,
+        },
+    },
+    { // 114: LOC_DEADEND12
+        .description = {
+            .small = 0,
+            .big = 21171,
+            .small_ops = 0,
+            .big_ops = 612,
+        },
+    },
+    { // 115: LOC_NE
+        .description = {
+            .small = 28760,
+            .big = 28778,
+            .small_ops = 778,
+            .big_ops = 780,
+        },
+    },
+    { // 116: LOC_SW
+        .description = {
+            .small = 29521,
+            .big = 29539,
+            .small_ops = 782,
+            .big_ops = 784,
+        },
+    },
+    { // 117: LOC_SWCHASM
+        .description = {
+            .small = 30036,
+            .big = 30064,
+            .small_ops = 788,
+            .big_ops = 790,
+        },
+    },
+    { // 118: LOC_WINDING
+        .description = {
+            .small = 30246,
+            .big = 30274,
+            .small_ops = 792,
+            .big_ops = 794,
+        },
+    },
+    { // 119: LOC_SECRET4
+        .description = {
+            .small = 0,
+            .big = 30350,
+            .small_ops = 0,
+            .big_ops = 796,
+        },
+    },
+    { // 120: LOC_SECRET5
+        .description = {
+            .small = 0,
+            .big = 30350,
+            .small_ops = 0,
+            .big_ops = 796,
+        },
+    },
+    { // 121: LOC_SECRET6
+        .description = {
+            .small = 0,
+            .big = 30350,
+            .small_ops = 0,
+            .big_ops = 796,
+        },
+    },
+    { // 122: LOC_NECHASM
+        .description = {
+            .small = 30412,
+            .big = 30440,
+            .small_ops = 798,
+            .big_ops = 800,
+        },
+    },
+    { // 123: LOC_CORRIDOR
+        .description = {
+            .small = 30529,
+            .big = 30549,
+            .small_ops = 802,
+            .big_ops = 804,
+        },
+    },
+    { // 124: LOC_FORK
+        .description = {
+            .small = 30640,
+            .big = 30664,
+            .small_ops = 806,
+            .big_ops = 808,
+        },
+    },
+    { // 125: LOC_WARMWALLS
+        .description = {
+            .small = 30867,
+            .big = 30903,
+            .small_ops = 810,
+            .big_ops = 812,
+        },
+    },
+    { // 126: LOC_BREATHTAKING
+        .description = {
+            .small = 31087,
+            .big = 31117,
+            .small_ops = 814,
+            .big_ops = 816,
+        },
+    },
+    { // 127: LOC_BOULDERS2
+        .description = {
+            .small = 32410,
+            .big = 32441,
+            .small_ops = 818,
+            .big_ops = 820,
+        },
+    },
+    { // 128: LOC_LIMESTONE
+        .description = {
+            .small = 32667,
+            .big = 32696,
+            .small_ops = 822,
+            .big_ops = 824,
+        },
+    },
+    { // 129: LOC_BARRENFRONT
+        .description = {
+            .small = 32801,
+            .big = 32833,
+            .small_ops = 826,
+            .big_ops = 828,
+        },
+    },
+    { // 130: LOC_BARRENROOM
+        .description = {
+            .small = 32954,
+            .big = 32977,
+            .small_ops = 830,
+            .big_ops = 832,
+        },
+    },
+    { // 131: LOC_DIFFERENT3
+        .description = {
+            .small = 0,
+            .big = 33173,
+            .small_ops = 0,
+            .big_ops = 834,
+        },
+    },
+    { // 132: LOC_DIFFERENT4
+        .description = {
+            .small = 0,
+            .big = 33235,
+            .small_ops = 0,
+            .big_ops = 836,
+        },
+    },
+    { // 133: LOC_DIFFERENT5
+        .description = {
+            .small = 0,
+            .big = 33295,
+            .small_ops = 0,
+            .big_ops = 838,
+        },
+    },
+    { // 134: LOC_DIFFERENT6
+        .description = {
+            .small = 0,
+            .big = 33357,
+            .small_ops = 0,
+            .big_ops = 840,
+        },
+    },
+    { // 135: LOC_DIFFERENT7
+        .description = {
+            .small = 0,
+            .big = 33419,
+            .small_ops = 0,
+            .big_ops = 842,
+        },
+    },
+    { // 136: LOC_DIFFERENT8
+        .description = {
+            .small = 0,
+            .big = 33479,
+            .small_ops = 0,
+            .big_ops = 844,
+        },
+    },
+    { // 137: LOC_DIFFERENT9
+        .description = {
+            .small = 0,
+            .big = 33539,
+            .small_ops = 0,
+            .big_ops = 846,
+        },
+    },
+    { // 138: LOC_DIFFERENT10
+        .description = {
+            .small = 0,
+            .big = 33599,
+            .small_ops = 0,
+            .big_ops = 848,
+        },
+    },
+    { // 139: LOC_DIFFERENT11
+        .description = {
+            .small = 0,
+            .big = 33661,
+            .small_ops = 0,
+            .big_ops = 850,
+        },
+    },
+    { // 140: LOC_DEADEND13
+        .description = {
+            .small = 0,
+            .big = 21171,
+            .small_ops = 0,
+            .big_ops = 612,
+        },
+    },
+    { // 141: LOC_ROUGHHEWN
+        .description = {
+            .small = 0,
+            .big = 33721,
+            .small_ops = 0,
+            .big_ops = 852,
+        },
+    },
+    { // 142: LOC_BADDIRECTION
+        .description = {
+            .small = 0,
+            .big = 2483,
+            .small_ops = 0,
+            .big_ops = 81,
+        },
+    },
+    { // 143: LOC_LARGE
+        .description = {
+            .small = 0,
+            .big = 33774,
+            .small_ops = 0,
+            .big_ops = 854,
+        },
+    },
+    { // 144: LOC_STOREROOM
+        .description = {
+            .small = 0,
+            .big = 33838,
+            .small_ops = 0,
+            .big_ops = 856,
+        },
+    },
+    { // 145: LOC_FOREST1
+        .description = {
+            .small = 0,
+            .big = 33903,
+            .small_ops = 0,
+            .big_ops = 858,
+        },
+    },
+    { // 146: LOC_FOREST2
+        .description = {
+            .small = 0,
+            .big = 33903,
+            .small_ops = 0,
+            .big_ops = 858,
+        },
+    },
+    { // 147: LOC_FOREST3
+        .description = {
+            .small = 0,
+            .big = 33903,
+            .small_ops = 0,
+            .big_ops = 858,
+        },
+    },
+    { // 148: LOC_FOREST4
+        .description = {
+            .small = 0,
+            .big = 33903,
+            .small_ops = 0,
+            .big_ops = 858,
+        },
+    },
+    { // 149: LOC_FOREST5
+        .description = {
+            .small = 0,
+            .big = 33903,
+            .small_ops = 0,
+            .big_ops = 858,
+        },
+    },
+    { // 150: LOC_FOREST6
+        .description = {
+            .small = 0,
+            .big = 33903,
+            .small_ops = 0,
+            .big_ops = 858,
+        },
+    },
+    { // 151: LOC_FOREST7
+        .description = {
+            .small = 0,
+            .big = 33903,
+            .small_ops = 0,
+            .big_ops = 858,
+        },
+    },
+    { // 152: LOC_FOREST8
+        .description = {
+            .small = 0,
+            .big = 33903,
+            .small_ops = 0,
+            .big_ops = 858,
+        },
+    },
+    { // 153: LOC_FOREST9
+        .description = {
+            .small = 0,
+            .big = 33903,
+            .small_ops = 0,
+            .big_ops = 858,
+        },
+    },
+    { // 154: LOC_FOREST10
+        .description = {
+            .small = 0,
+            .big = 33903,
+            .small_ops = 0,
+            .big_ops = 858,
+        },
+    },
+    { // 155: LOC_FOREST11
+        .description = {
+            .small = 0,
+            .big = 33903,
+            .small_ops = 0,
+            .big_ops = 858,
+        },
+    },
+    { // 156: LOC_FOREST12
+        .description = {
+            .small = 0,
+            .big = 33903,
+            .small_ops = 0,
+            .big_ops = 858,
+        },
+    },
+    { // 157: LOC_FOREST13
+        .description = {
+            .small = 0,
+            .big = 33903,
+            .small_ops = 0,
+            .big_ops = 858,
+        },
+    },
+    { // 158: LOC_FOREST14
+        .description = {
+            .small = 0,
+            .big = 33903,
+            .small_ops = 0,
+            .big_ops = 858,
+        },
+    },
+    { // 159: LOC_FOREST15
+        .description = {
+            .small = 0,
+            .big = 33903,
+            .small_ops = 0,
+            .big_ops = 858,
+        },
+    },
+    { // 160: LOC_FOREST16
+        .description = {
+            .small = 0,
+            .big = 33903,
+            .small_ops = 0,
+            .big_ops = 858,
+        },
+    },
+    { // 161: LOC_FOREST17
+        .description = {
+            .small = 0,
+            .big = 33903,
+            .small_ops = 0,
+            .big_ops = 858,
+        },
+    },
+    { // 162: LOC_FOREST18
+        .description = {
+            .small = 0,
+            .big = 33903,
+            .small_ops = 0,
+            .big_ops = 858,
+        },
+    },
+    { // 163: LOC_FOREST19
+        .description = {
+            .small = 0,
+            .big = 33903,
+            .small_ops = 0,
+            .big_ops = 858,
+        },
+    },
+    { // 164: LOC_FOREST20
+        .description = {
+            .small = 0,
+            .big = 33903,
+            .small_ops = 0,
+            .big_ops = 858,
+        },
+    },
+    { // 165: LOC_FOREST21
+        .description = {
+            .small = 0,
+            .big = 33903,
+            .small_ops = 0,
+            .big_ops = 858,
+        },
+    },
+    { // 166: LOC_FOREST22
+        .description = {
+            .small = 0,
+            .big = 33903,
+            .small_ops = 0,
+            .big_ops = 858,
+        },
+    },
+    { // 167: LOC_LEDGE
+        .description = {
+            .small = 33951,
+            .big = 33968,
+            .small_ops = 860,
+            .big_ops = 862,
+        },
+    },
+    { // 168: LOC_RESBOTTOM
+        .description = {
+            .small = 34124,
+            .big = 34155,
+            .small_ops = 864,
+            .big_ops = 866,
+        },
+    },
+    { // 169: LOC_RESNORTH
+        .description = {
+            .small = 34351,
+            .big = 34378,
+            .small_ops = 868,
+            .big_ops = 870,
+        },
+    },
+    { // 170: LOC_TREACHEROUS
+        .description = {
+            .small = 0,
+            .big = 34474,
+            .small_ops = 0,
+            .big_ops = 872,
+        },
+    },
+    { // 171: LOC_STEEP
+        .description = {
+            .small = 0,
+            .big = 34537,
+            .small_ops = 0,
+            .big_ops = 874,
+        },
+    },
+    { // 172: LOC_CLIFFBASE
+        .description = {
+            .small = 34602,
+            .big = 34627,
+            .small_ops = 876,
+            .big_ops = 878,
+        },
+    },
+    { // 173: LOC_CLIFFACE
+        .description = {
+            .small = 0,
+            .big = 34888,
+            .small_ops = 0,
+            .big_ops = 880,
+        },
+    },
+    { // 174: LOC_FOOTSLIP
+        .description = {
+            .small = 0,
+            .big = 34936,
+            .small_ops = 0,
+            .big_ops = 882,
+        },
+    },
+    { // 175: LOC_CLIFFTOP
+        .description = {
+            .small = 0,
+            .big = 35070,
+            .small_ops = 0,
+            .big_ops = 884,
+        },
+    },
+    { // 176: LOC_CLIFFLEDGE
+        .description = {
+            .small = 35266,
+            .big = 35290,
+            .small_ops = 886,
+            .big_ops = 888,
+        },
+    },
+    { // 177: LOC_REACHDEAD
+        .description = {
+            .small = 0,
+            .big = 35405,
+            .small_ops = 0,
+            .big_ops = 890,
+        },
+    },
+    { // 178: LOC_GRUESOME
+        .description = {
+            .small = 0,
+            .big = 35434,
+            .small_ops = 0,
+            .big_ops = 892,
+        },
+    },
+    { // 179: LOC_FOOF1
+        .description = {
+            .small = 0,
+            .big = 35498,
+            .small_ops = 0,
+            .big_ops = 894,
+        },
+    },
+    { // 180: LOC_FOOF2
+        .description = {
+            .small = 0,
+            .big = 35498,
+            .small_ops = 0,
+            .big_ops = 894,
+        },
+    },
+    { // 181: LOC_FOOF3
+        .description = {
+            .small = 0,
+            .big = 35498,
+            .small_ops = 0,
+            .big_ops = 894,
+        },
+    },
+    { // 182: LOC_FOOF4
+        .description = {
+            .small = 0,
+            .big = 35498,
+            .small_ops = 0,
+            .big_ops = 894,
+        },
+    },
+    { // 183: LOC_FOOF5
+        .description = {
+            .small = 0,
+            .big = 35498,
+            .small_ops = 0,
+            .big_ops = 894,
+        },
+    },
+    { // 184: LOC_FOOF6
+        .description = {
+            .small = 0,
+            .big = 35498,
+            .small_ops = 0,
+            .big_ops = 894,
+        },
+    },
+};
+
+const object_t objects[] = {
+    { // 0: NO_OBJECT
+        .words = {
+            .strs = 0,
+            .n = 0,
+        },
+        .inventory = 0,
+        .descriptions = 1,
+        .description_ops = 2,
+        .sounds = 3,
+        .texts = 4,
+        .changes = 5,
+    },
+    { // 1: KEYS
+        .words = {
+            .strs = 6,
+            .n = 2,
+        },
+        .inventory = 35517,
+        .descriptions = 8,
+        .description_ops = 9,
+        .sounds = 10,
+        .texts = 11,
+        .changes = 12,
+    },
+    { // 2: LAMP
+        .words = {
+            .strs = 13,
+            .n = 2,
+        },
+        .inventory = 35580,
+        .descriptions = 15,
+        .description_ops = 17,
+        .sounds = 19,
+        .texts = 20,
+        .changes = 21,
+    },
+    { // 3: GRATE
+        .words = {
+            .strs = 23,
+            .n = 1,
+        },
+        .inventory = 35711,
+        .descriptions = 24,
+        .description_ops = 26,
+        .sounds = 28,
+        .texts = 29,
+        .changes = 30,
+    },
+    { // 4: CAGE
+        .words = {
+            .strs = 32,
+            .n = 1,
+        },
+        .inventory = 35815,
+        .descriptions = 33,
+        .description_ops = 34,
+        .sounds = 35,
+        .texts = 36,
+        .changes = 37,
+    },
+    { // 5: ROD
+        .words = {
+            .strs = 38,
+            .n = 1,
+        },
+        .inventory = 35878,
+        .descriptions = 39,
+        .description_ops = 40,
+        .sounds = 41,
+        .texts = 42,
+        .changes = 43,
+    },
+    { // 6: ROD2
+        .words = {
+            .strs = 44,
+            .n = 1,
+        },
+        .inventory = 35878,
+        .descriptions = 45,
+        .description_ops = 46,
+        .sounds = 47,
+        .texts = 48,
+        .changes = 49,
+    },
+    { // 7: STEPS
+        .words = {
+            .strs = 50,
+            .n = 1,
+        },
+        .inventory = 36022,
+        .descriptions = 51,
+        .description_ops = 53,
+        .sounds = 55,
+        .texts = 56,
+        .changes = 57,
+    },
+    { // 8: BIRD
+        .words = {
+            .strs = 58,
+            .n = 1,
+        },
+        .inventory = 36107,
+        .descriptions = 59,
+        .description_ops = 62,
+        .sounds = 65,
+        .texts = 71,
+        .changes = 72,
+    },
+    { // 9: DOOR
+        .words = {
+            .strs = 73,
+            .n = 1,
+        },
+        .inventory = 36838,
+        .descriptions = 74,
+        .description_ops = 76,
+        .sounds = 78,
+        .texts = 79,
+        .changes = 80,
+    },
+    { // 10: PILLOW
+        .words = {
+            .strs = 82,
+            .n = 2,
+        },
+        .inventory = 37133,
+        .descriptions = 84,
+        .description_ops = 85,
+        .sounds = 86,
+        .texts = 87,
+        .changes = 88,
+    },
+    { // 11: SNAKE
+        .words = {
+            .strs = 89,
+            .n = 1,
+        },
+        .inventory = 37194,
+        .descriptions = 90,
+        .description_ops = 92,
+        .sounds = 94,
+        .texts = 96,
+        .changes = 97,
+    },
+    { // 12: FISSURE
+        .words = {
+            .strs = 98,
+            .n = 1,
+        },
+        .inventory = 37280,
+        .descriptions = 99,
+        .description_ops = 101,
+        .sounds = 103,
+        .texts = 104,
+        .changes = 105,
+    },
+    { // 13: OBJ_13
+        .words = {
+            .strs = 107,
+            .n = 1,
+        },
+        .inventory = 37404,
+        .descriptions = 108,
+        .description_ops = 109,
+        .sounds = 110,
+        .texts = 111,
+        .changes = 112,
+    },
+    { // 14: CLAM
+        .words = {
+            .strs = 113,
+            .n = 1,
+        },
+        .inventory = 37586,
+        .descriptions = 114,
+        .description_ops = 115,
+        .sounds = 116,
+        .texts = 117,
+        .changes = 118,
+    },
+    { // 15: OYSTER
+        .words = {
+            .strs = 119,
+            .n = 1,
+        },
+        .inventory = 37720,
+        .descriptions = 120,
+        .description_ops = 122,
+        .sounds = 124,
+        .texts = 126,
+        .changes = 127,
+    },
+    { // 16: MAGAZINE
+        .words = {
+            .strs = 128,
+            .n = 4,
+        },
+        .inventory = 38044,
+        .descriptions = 132,
+        .description_ops = 133,
+        .sounds = 134,
+        .texts = 135,
+        .changes = 136,
+    },
+    { // 17: DWARF
+        .words = {
+            .strs = 137,
+            .n = 2,
+        },
+        .inventory = 0,
+        .descriptions = 139,
+        .description_ops = 140,
+        .sounds = 141,
+        .texts = 142,
+        .changes = 143,
+    },
+    { // 18: KNIFE
+        .words = {
+            .strs = 144,
+            .n = 2,
+        },
+        .inventory = 0,
+        .descriptions = 146,
+        .description_ops = 147,
+        .sounds = 148,
+        .texts = 149,
+        .changes = 150,
+    },
+    { // 19: FOOD
+        .words = {
+            .strs = 151,
+            .n = 2,
+        },
+        .inventory = 38303,
+        .descriptions = 153,
+        .description_ops = 154,
+        .sounds = 155,
+        .texts = 156,
+        .changes = 157,
+    },
+    { // 20: BOTTLE
+        .words = {
+            .strs = 158,
+            .n = 2,
+        },
+        .inventory = 38344,
+        .descriptions = 160,
+        .description_ops = 163,
+        .sounds = 166,
+        .texts = 167,
+        .changes = 168,
+    },
+    { // 21: WATER
+        .words = {
+            .strs = 171,
+            .n = 2,
+        },
+        .inventory = 38562,
+        .descriptions = 173,
+        .description_ops = 174,
+        .sounds = 175,
+        .texts = 176,
+        .changes = 177,
+    },
+    { // 22: OIL
+        .words = {
+            .strs = 178,
+            .n = 1,
+        },
+        .inventory = 38586,
+        .descriptions = 179,
+        .description_ops = 180,
+        .sounds = 181,
+        .texts = 182,
+        .changes = 183,
+    },
+    { // 23: MIRROR
+        .words = {
+            .strs = 184,
+            .n = 1,
+        },
+        .inventory = 38610,
+        .descriptions = 185,
+        .description_ops = 187,
+        .sounds = 189,
+        .texts = 190,
+        .changes = 191,
+    },
+    { // 24: PLANT
+        .words = {
+            .strs = 193,
+            .n = 2,
+        },
+        .inventory = 38723,
+        .descriptions = 195,
+        .description_ops = 198,
+        .sounds = 201,
+        .texts = 204,
+        .changes = 205,
+    },
+    { // 25: PLANT2
+        .words = {
+            .strs = 208,
+            .n = 1,
+        },
+        .inventory = 39284,
+        .descriptions = 209,
+        .description_ops = 212,
+        .sounds = 215,
+        .texts = 216,
+        .changes = 217,
+    },
+    { // 26: OBJ_26
+        .words = {
+            .strs = 218,
+            .n = 1,
+        },
+        .inventory = 39440,
+        .descriptions = 219,
+        .description_ops = 220,
+        .sounds = 221,
+        .texts = 222,
+        .changes = 223,
+    },
+    { // 27: OBJ_27
+        .words = {
+            .strs = 224,
+            .n = 3,
+        },
+        .inventory = 39470,
+        .descriptions = 227,
+        .description_ops = 228,
+        .sounds = 229,
+        .texts = 230,
+        .changes = 231,
+    },
+    { // 28: AXE
+        .words = {
+            .strs = 232,
+            .n = 1,
+        },
+        .inventory = 39569,
+        .descriptions = 233,
+        .description_ops = 235,
+        .sounds = 237,
+        .texts = 238,
+        .changes = 239,
+    },
+    { // 29: OBJ_29
+        .words = {
+            .strs = 241,
+            .n = 1,
+        },
+        .inventory = 39726,
+        .descriptions = 242,
+        .description_ops = 243,
+        .sounds = 244,
+        .texts = 245,
+        .changes = 246,
+    },
+    { // 30: OBJ_30
+        .words = {
+            .strs = 247,
+            .n = 3,
+        },
+        .inventory = 39759,
+        .descriptions = 250,
+        .description_ops = 251,
+        .sounds = 252,
+        .texts = 253,
+        .changes = 254,
+    },
+    { // 31: DRAGON
+        .words = {
+            .strs = 255,
+            .n = 1,
+        },
+        .inventory = 39779,
+        .descriptions = 256,
+        .description_ops = 259,
+        .sounds = 262,
+        .texts = 265,
+        .changes = 266,
+    },
+    { // 32: CHASM
+        .words = {
+            .strs = 269,
+            .n = 1,
+        },
+        .inventory = 40206,
+        .descriptions = 270,
+        .description_ops = 272,
+        .sounds = 274,
+        .texts = 275,
+        .changes = 276,
+    },
+    { // 33: TROLL
+        .words = {
+            .strs = 278,
+            .n = 1,
+        },
+        .inventory = 40666,
+        .descriptions = 279,
+        .description_ops = 282,
+        .sounds = 285,
+        .texts = 288,
+        .changes = 289,
+    },
+    { // 34: TROLL2
+        .words = {
+            .strs = 292,
+            .n = 1,
+        },
+        .inventory = 41032,
+        .descriptions = 293,
+        .description_ops = 294,
+        .sounds = 295,
+        .texts = 296,
+        .changes = 297,
+    },
+    { // 35: BEAR
+        .words = {
+            .strs = 298,
+            .n = 1,
+        },
+        .inventory = 0,
+        .descriptions = 299,
+        .description_ops = 303,
+        .sounds = 307,
+        .texts = 308,
+        .changes = 309,
+    },
+    { // 36: MESSAG
+        .words = {
+            .strs = 313,
+            .n = 1,
+        },
+        .inventory = 41398,
+        .descriptions = 314,
+        .description_ops = 315,
+        .sounds = 316,
+        .texts = 317,
+        .changes = 318,
+    },
+    { // 37: VOLCANO
+        .words = {
+            .strs = 319,
+            .n = 2,
+        },
+        .inventory = 41638,
+        .descriptions = 321,
+        .description_ops = 322,
+        .sounds = 323,
+        .texts = 324,
+        .changes = 325,
+    },
+    { // 38: VEND
+        .words = {
+            .strs = 326,
+            .n = 2,
+        },
+        .inventory = 41673,
+        .descriptions = 328,
+        .description_ops = 330,
+        .sounds = 332,
+        .texts = 333,
+        .changes = 335,
+    },
+    { // 39: BATTERY
+        .words = {
+            .strs = 337,
+            .n = 1,
+        },
+        .inventory = 42142,
+        .descriptions = 338,
+        .description_ops = 340,
+        .sounds = 342,
+        .texts = 343,
+        .changes = 344,
+    },
+    { // 40: OBJ_40
+        .words = {
+            .strs = 345,
+            .n = 2,
+        },
+        .inventory = 42247,
+        .descriptions = 347,
+        .description_ops = 348,
+        .sounds = 349,
+        .texts = 350,
+        .changes = 351,
+    },
+    { // 41: OGRE
+        .words = {
+            .strs = 352,
+            .n = 1,
+        },
+        .inventory = 42288,
+        .descriptions = 353,
+        .description_ops = 354,
+        .sounds = 355,
+        .texts = 356,
+        .changes = 357,
+    },
+    { // 42: URN
+        .words = {
+            .strs = 358,
+            .n = 1,
+        },
+        .inventory = 42388,
+        .descriptions = 359,
+        .description_ops = 362,
+        .sounds = 365,
+        .texts = 366,
+        .changes = 367,
+    },
+    { // 43: CAVITY
+        .words = {
+            .strs = 370,
+            .n = 1,
+        },
+        .inventory = 42624,
+        .descriptions = 371,
+        .description_ops = 373,
+        .sounds = 375,
+        .texts = 376,
+        .changes = 377,
+    },
+    { // 44: BLOOD
+        .words = {
+            .strs = 378,
+            .n = 1,
+        },
+        .inventory = 42686,
+        .descriptions = 379,
+        .description_ops = 380,
+        .sounds = 381,
+        .texts = 382,
+        .changes = 383,
+    },
+    { // 45: RESER
+        .words = {
+            .strs = 384,
+            .n = 1,
+        },
+        .inventory = 42699,
+        .descriptions = 385,
+        .description_ops = 387,
+        .sounds = 389,
+        .texts = 390,
+        .changes = 391,
+    },
+    { // 46: OBJ_46
+        .words = {
+            .strs = 393,
+            .n = 2,
+        },
+        .inventory = 42822,
+        .descriptions = 395,
+        .description_ops = 396,
+        .sounds = 397,
+        .texts = 398,
+        .changes = 399,
+    },
+    { // 47: OBJ_47
+        .words = {
+            .strs = 400,
+            .n = 1,
+        },
+        .inventory = 42915,
+        .descriptions = 401,
+        .description_ops = 402,
+        .sounds = 403,
+        .texts = 404,
+        .changes = 405,
+    },
+    { // 48: OBJ_48
+        .words = {
+            .strs = 406,
+            .n = 1,
+        },
+        .inventory = 42944,
+        .descriptions = 407,
+        .description_ops = 408,
+        .sounds = 409,
+        .texts = 410,
+        .changes = 411,
+    },
+    { // 49: SIGN
+        .words = {
+            .strs = 412,
+            .n = 1,
+        },
+        .inventory = 42987,
+        .descriptions = 413,
+        .description_ops = 415,
+        .sounds = 417,
+        .texts = 418,
+        .changes = 420,
+    },
+    { // 50: NUGGET
+        .words = {
+            .strs = 421,
+            .n = 2,
+        },
+        .inventory = 43154,
+        .descriptions = 423,
+        .description_ops = 424,
+        .sounds = 425,
+        .texts = 426,
+        .changes = 427,
+    },
+    { // 51: OBJ_51
+        .words = {
+            .strs = 428,
+            .n = 1,
+        },
+        .inventory = 43226,
+        .descriptions = 429,
+        .description_ops = 430,
+        .sounds = 431,
+        .texts = 432,
+        .changes = 433,
+    },
+    { // 52: OBJ_52
+        .words = {
+            .strs = 434,
+            .n = 2,
+        },
+        .inventory = 43279,
+        .descriptions = 436,
+        .description_ops = 437,
+        .sounds = 438,
+        .texts = 439,
+        .changes = 440,
+    },
+    { // 53: OBJ_53
+        .words = {
+            .strs = 441,
+            .n = 1,
+        },
+        .inventory = 43331,
+        .descriptions = 442,
+        .description_ops = 443,
+        .sounds = 444,
+        .texts = 445,
+        .changes = 446,
+    },
+    { // 54: COINS
+        .words = {
+            .strs = 447,
+            .n = 1,
+        },
+        .inventory = 43386,
+        .descriptions = 448,
+        .description_ops = 449,
+        .sounds = 450,
+        .texts = 451,
+        .changes = 452,
+    },
+    { // 55: CHEST
+        .words = {
+            .strs = 453,
+            .n = 3,
+        },
+        .inventory = 43440,
+        .descriptions = 456,
+        .description_ops = 457,
+        .sounds = 458,
+        .texts = 459,
+        .changes = 460,
+    },
+    { // 56: EGGS
+        .words = {
+            .strs = 461,
+            .n = 3,
+        },
+        .inventory = 43506,
+        .descriptions = 464,
+        .description_ops = 467,
+        .sounds = 470,
+        .texts = 471,
+        .changes = 472,
+    },
+    { // 57: TRIDENT
+        .words = {
+            .strs = 473,
+            .n = 1,
+        },
+        .inventory = 43617,
+        .descriptions = 474,
+        .description_ops = 475,
+        .sounds = 476,
+        .texts = 477,
+        .changes = 478,
+    },
+    { // 58: VASE
+        .words = {
+            .strs = 479,
+            .n = 4,
+        },
+        .inventory = 43696,
+        .descriptions = 483,
+        .description_ops = 486,
+        .sounds = 489,
+        .texts = 490,
+        .changes = 491,
+    },
+    { // 59: EMERALD
+        .words = {
+            .strs = 494,
+            .n = 1,
+        },
+        .inventory = 43979,
+        .descriptions = 495,
+        .description_ops = 497,
+        .sounds = 499,
+        .texts = 500,
+        .changes = 501,
+    },
+    { // 60: PYRAMID
+        .words = {
+            .strs = 502,
+            .n = 2,
+        },
+        .inventory = 44121,
+        .descriptions = 504,
+        .description_ops = 505,
+        .sounds = 506,
+        .texts = 507,
+        .changes = 508,
+    },
+    { // 61: PEARL
+        .words = {
+            .strs = 509,
+            .n = 1,
+        },
+        .inventory = 44198,
+        .descriptions = 510,
+        .description_ops = 511,
+        .sounds = 512,
+        .texts = 513,
+        .changes = 514,
+    },
+    { // 62: RUG
+        .words = {
+            .strs = 515,
+            .n = 2,
+        },
+        .inventory = 44266,
+        .descriptions = 517,
+        .description_ops = 520,
+        .sounds = 523,
+        .texts = 524,
+        .changes = 525,
+    },
+    { // 63: OBJ_63
+        .words = {
+            .strs = 526,
+            .n = 1,
+        },
+        .inventory = 44428,
+        .descriptions = 527,
+        .description_ops = 528,
+        .sounds = 529,
+        .texts = 530,
+        .changes = 531,
+    },
+    { // 64: CHAIN
+        .words = {
+            .strs = 532,
+            .n = 1,
+        },
+        .inventory = 44474,
+        .descriptions = 533,
+        .description_ops = 536,
+        .sounds = 539,
+        .texts = 540,
+        .changes = 541,
+    },
+    { // 65: RUBY
+        .words = {
+            .strs = 542,
+            .n = 1,
+        },
+        .inventory = 44642,
+        .descriptions = 543,
+        .description_ops = 545,
+        .sounds = 547,
+        .texts = 548,
+        .changes = 549,
+    },
+    { // 66: JADE
+        .words = {
+            .strs = 550,
+            .n = 2,
+        },
+        .inventory = 44751,
+        .descriptions = 552,
+        .description_ops = 553,
+        .sounds = 554,
+        .texts = 555,
+        .changes = 556,
+    },
+    { // 67: AMBER
+        .words = {
+            .strs = 557,
+            .n = 2,
+        },
+        .inventory = 44825,
+        .descriptions = 559,
+        .description_ops = 561,
+        .sounds = 563,
+        .texts = 564,
+        .changes = 565,
+    },
+    { // 68: SAPPH
+        .words = {
+            .strs = 566,
+            .n = 1,
+        },
+        .inventory = 44949,
+        .descriptions = 567,
+        .description_ops = 569,
+        .sounds = 571,
+        .texts = 572,
+        .changes = 573,
+    },
+    { // 69: OBJ_69
+        .words = {
+            .strs = 574,
+            .n = 2,
+        },
+        .inventory = 45079,
+        .descriptions = 576,
+        .description_ops = 577,
+        .sounds = 578,
+        .texts = 579,
+        .changes = 580,
+    },
+};
+
+/* Per-object and per-location data that the game tests every turn,
+ * kept apart from the descriptive records so that scanning it does
+ * not drag their string references through the cache.
+ */
+const short object_plac[] = {
+    LOC_NOWHERE,	// NO_OBJECT
+    LOC_BUILDING,	// KEYS
+    LOC_BUILDING,	// LAMP
+    LOC_GRATE,	// GRATE
+    LOC_COBBLE,	// CAGE
+    LOC_DEBRIS,	// ROD
+    LOC_NOWHERE,	// ROD2
+    LOC_PITTOP,	// STEPS
+    LOC_BIRD,	// BIRD
+    LOC_IMMENSE,	// DOOR
+    LOC_SOFTROOM,	// PILLOW
+    LOC_KINGHALL,	// SNAKE
+    LOC_EASTBANK,	// FISSURE
+    LOC_DARKROOM,	// OBJ_13
+    LOC_SHELLROOM,	// CLAM
+    LOC_NOWHERE,	// OYSTER
+    LOC_ANTEROOM,	// MAGAZINE
+    LOC_NOWHERE,	// DWARF
+    LOC_NOWHERE,	// KNIFE
+    LOC_BUILDING,	// FOOD
+    LOC_BUILDING,	// BOTTLE
+    LOC_NOWHERE,	// WATER
+    LOC_NOWHERE,	// OIL
+    LOC_MIRRORCANYON,	// MIRROR
+    LOC_WESTPIT,	// PLANT
+    LOC_WESTEND,	// PLANT2
+    LOC_TOPSTALACTITE,	// OBJ_26
+    LOC_WINDOW1,	// OBJ_27
+    LOC_NOWHERE,	// AXE
+    LOC_ORIENTAL,	// OBJ_29
+    LOC_NOWHERE,	// OBJ_30
+    LOC_SECRET4,	// DRAGON
+    LOC_SWCHASM,	// CHASM
+    LOC_SWCHASM,	// TROLL
+    LOC_NOWHERE,	// TROLL2
+    LOC_BARRENROOM,	// BEAR
+    LOC_NOWHERE,	// MESSAG
+    LOC_BREATHTAKING,	// VOLCANO
+    LOC_DEADEND13,	// VEND
+    LOC_NOWHERE,	// BATTERY
+    LOC_SOFTROOM,	// OBJ_40
+    LOC_LARGE,	// OGRE
+    LOC_CLIFF,	// URN
+    LOC_NOWHERE,	// CAVITY
+    LOC_NOWHERE,	// BLOOD
+    LOC_RESERVOIR,	// RESER
+    LOC_FOREST22,	// OBJ_46
+    LOC_DEBRIS,	// OBJ_47
+    LOC_NUGGET,	// OBJ_48
+    LOC_ANTEROOM,	// SIGN
+    LOC_NUGGET,	// NUGGET
+    LOC_WESTBANK,	// OBJ_51
+    LOC_FLOORHOLE,	// OBJ_52
+    LOC_SOUTHSIDE,	// OBJ_53
+    LOC_WESTSIDE,	// COINS
+    LOC_NOWHERE,	// CHEST
+    LOC_GIANTROOM,	// EGGS
+    LOC_WATERFALL,	// TRIDENT
+    LOC_ORIENTAL,	// VASE
+    LOC_PLOVER,	// EMERALD
+    LOC_DARKROOM,	// PYRAMID
+    LOC_NOWHERE,	// PEARL
+    LOC_SECRET4,	// RUG
+    LOC_BOULDERS2,	// OBJ_63
+    LOC_BARRENROOM,	// CHAIN
+    LOC_STOREROOM,	// RUBY
+    LOC_NOWHERE,	// JADE
+    LOC_NOWHERE,	// AMBER
+    LOC_LEDGE,	// SAPPH
+    LOC_REACHDEAD,	// OBJ_69
+};
+
+const short object_fixd[] = {
+    LOC_NOWHERE,	// NO_OBJECT
+    0,	// KEYS
+    0,	// LAMP
+    LOC_BELOWGRATE,	// GRATE
+    0,	// CAGE
+    0,	// ROD
+    0,	// ROD2
+    LOC_MISTHALL,	// STEPS
+    0,	// BIRD
+    -1,	// DOOR
+    0,	// PILLOW
+    -1,	// SNAKE
+    LOC_WESTBANK,	// FISSURE
+    -1,	// OBJ_13
+    0,	// CLAM
+    0,	// OYSTER
+    0,	// MAGAZINE
+    -1,	// DWARF
+    0,	// KNIFE
+    0,	// FOOD
+    0,	// BOTTLE
+    0,	// WATER
+    0,	// OIL
+    -1,	// MIRROR
+    -1,	// PLANT
+    LOC_EASTEND,	// PLANT2
+    -1,	// OBJ_26
+    LOC_WINDOW2,	// OBJ_27
+    0,	// AXE
+    -1,	// OBJ_29
+    -1,	// OBJ_30
+    LOC_SECRET6,	// DRAGON
+    LOC_NECHASM,	// CHASM
+    LOC_NECHASM,	// TROLL
+    LOC_NOWHERE,	// TROLL2
+    -1,	// BEAR
+    -1,	// MESSAG
+    -1,	// VOLCANO
+    -1,	// VEND
+    0,	// BATTERY
+    -1,	// OBJ_40
+    -1,	// OGRE
+    -1,	// URN
+    -1,	// CAVITY
+    -1,	// BLOOD
+    LOC_RESNORTH,	// RESER
+    0,	// OBJ_46
+    -1,	// OBJ_47
+    -1,	// OBJ_48
+    -1,	// SIGN
+    0,	// NUGGET
+    0,	// OBJ_51
+    0,	// OBJ_52
+    0,	// OBJ_53
+    0,	// COINS
+    0,	// CHEST
+    0,	// EGGS
+    0,	// TRIDENT
+    0,	// VASE
+    0,	// EMERALD
+    0,	// PYRAMID
+    0,	// PEARL
+    LOC_SECRET6,	// RUG
+    0,	// OBJ_63
+    -1,	// CHAIN
+    0,	// RUBY
+    0,	// JADE
+    0,	// AMBER
+    0,	// SAPPH
+    0,	// OBJ_69
+};
+
+const bool object_treasure[] = {
+    false,	// NO_OBJECT
+    false,	// KEYS
+    false,	// LAMP
+    false,	// GRATE
+    false,	// CAGE
+    false,	// ROD
+    false,	// ROD2
+    false,	// STEPS
+    false,	// BIRD
+    false,	// DOOR
+    false,	// PILLOW
+    false,	// SNAKE
+    false,	// FISSURE
+    false,	// OBJ_13
+    false,	// CLAM
+    false,	// OYSTER
+    false,	// MAGAZINE
+    false,	// DWARF
+    false,	// KNIFE
+    false,	// FOOD
+    false,	// BOTTLE
+    false,	// WATER
+    false,	// OIL
+    false,	// MIRROR
+    false,	// PLANT
+    false,	// PLANT2
+    false,	// OBJ_26
+    false,	// OBJ_27
+    false,	// AXE
+    false,	// OBJ_29
+    false,	// OBJ_30
+    false,	// DRAGON
+    false,	// CHASM
+    false,	// TROLL
+    false,	// TROLL2
+    false,	// BEAR
+    false,	// MESSAG
+    false,	// VOLCANO
+    false,	// VEND
+    false,	// BATTERY
+    false,	// OBJ_40
+    false,	// OGRE
+    false,	// URN
+    false,	// CAVITY
+    false,	// BLOOD
+    false,	// RESER
+    false,	// OBJ_46
+    false,	// OBJ_47
+    false,	// OBJ_48
+    false,	// SIGN
+    true,	// NUGGET
+    true,	// OBJ_51
+    true,	// OBJ_52
+    true,	// OBJ_53
+    true,	// COINS
+    true,	// CHEST
+    true,	// EGGS
+    true,	// TRIDENT
+    true,	// VASE
+    true,	// EMERALD
+    true,	// PYRAMID
+    true,	// PEARL
+    true,	// RUG
+    true,	// OBJ_63
+    true,	// CHAIN
+    true,	// RUBY
+    true,	// JADE
+    true,	// AMBER
+    true,	// SAPPH
+    true,	// OBJ_69
+};
+
+const short location_sound[] = {
+    SILENT,	// LOC_NOWHERE
+    STREAM_GURGLES,	// LOC_START
+    SILENT,	// LOC_HILL
+    STREAM_GURGLES,	// LOC_BUILDING
+    STREAM_GURGLES,	// LOC_VALLEY
+    SILENT,	// LOC_ROADEND
+    SILENT,	// LOC_CLIFF
+    STREAM_GURGLES,	// LOC_SLIT
+    SILENT,	// LOC_GRATE
+    SILENT,	// LOC_BELOWGRATE
+    SILENT,	// LOC_COBBLE
+    SILENT,	// LOC_DEBRIS
+    SILENT,	// LOC_AWKWARD
+    SILENT,	// LOC_BIRD
+    SILENT,	// LOC_PITTOP
+    WIND_WHISTLES,	// LOC_MISTHALL
+    SILENT,	// LOC_CRACK
+    SILENT,	// LOC_EASTBANK
+    SILENT,	// LOC_NUGGET
+    SILENT,	// LOC_KINGHALL
+    SILENT,	// LOC_NECKBROKE
+    SILENT,	// LOC_NOMAKE
+    SILENT,	// LOC_DOME
+    SILENT,	// LOC_WESTEND
+    SILENT,	// LOC_EASTPIT
+    SILENT,	// LOC_WESTPIT
+    SILENT,	// LOC_CLIMBSTALK
+    SILENT,	// LOC_WESTBANK
+    SILENT,	// LOC_FLOORHOLE
+    SILENT,	// LOC_SOUTHSIDE
+    SILENT,	// LOC_WESTSIDE
+    SILENT,	// LOC_BUILDING1
+    SILENT,	// LOC_SNAKEBLOCK
+    SILENT,	// LOC_Y2
+    SILENT,	// LOC_JUMBLE
+    SILENT,	// LOC_WINDOW1
+    SILENT,	// LOC_BROKEN
+    SILENT,	// LOC_SMALLPITBRINK
+    STREAM_GURGLES,	// LOC_SMALLPIT
+    SILENT,	// LOC_DUSTY
+    SILENT,	// LOC_PARALLEL1
+    SILENT,	// LOC_MISTWEST
+    SILENT,	// LOC_ALIKE1
+    SILENT,	// LOC_ALIKE2
+    SILENT,	// LOC_ALIKE3
+    SILENT,	// LOC_ALIKE4
+    SILENT,	// LOC_DEADEND1
+    SILENT,	// LOC_DEADEND2
+    SILENT,	// LOC_DEADEND3
+    SILENT,	// LOC_ALIKE5
+    SILENT,	// LOC_ALIKE6
+    SILENT,	// LOC_ALIKE7
+    SILENT,	// LOC_ALIKE8
+    SILENT,	// LOC_ALIKE9
+    SILENT,	// LOC_DEADEND4
+    SILENT,	// LOC_ALIKE10
+    SILENT,	// LOC_DEADEND5
+    SILENT,	// LOC_PITBRINK
+    SILENT,	// LOC_DEADEND6
+    SILENT,	// LOC_PARALLEL2
+    SILENT,	// LOC_LONGEAST
+    SILENT,	// LOC_LONGWEST
+    SILENT,	// LOC_CROSSOVER
+    SILENT,	// LOC_DEADEND7
+    WIND_WHISTLES,	// LOC_COMPLEX
+    SILENT,	// LOC_BEDQUILT
+    SILENT,	// LOC_SWISSCHEESE
+    SILENT,	// LOC_EASTEND
+    SILENT,	// LOC_SLAB
+    SILENT,	// LOC_SECRET1
+    SILENT,	// LOC_SECRET2
+    SILENT,	// LOC_THREEJUNCTION
+    SILENT,	// LOC_LOWROOM
+    SILENT,	// LOC_DEADCRAWL
+    SILENT,	// LOC_SECRET3
+    SILENT,	// LOC_WIDEPLACE
+    SILENT,	// LOC_TIGHTPLACE
+    SILENT,	// LOC_TALL
+    SILENT,	// LOC_BOULDERS1
+    SILENT,	// LOC_SEWER
+    SILENT,	// LOC_ALIKE11
+    SILENT,	// LOC_DEADEND8
+    SILENT,	// LOC_DEADEND9
+    SILENT,	// LOC_ALIKE12
+    SILENT,	// LOC_ALIKE13
+    SILENT,	// LOC_DEADEND10
+    SILENT,	// LOC_DEADEND11
+    SILENT,	// LOC_ALIKE14
+    SILENT,	// LOC_NARROW
+    SILENT,	// LOC_NOCLIMB
+    SILENT,	// LOC_PLANTTOP
+    SILENT,	// LOC_INCLINE
+    SILENT,	// LOC_GIANTROOM
+    SILENT,	// LOC_CAVEIN
+    WIND_WHISTLES,	// LOC_IMMENSE
+    STREAM_SPLASHES,	// LOC_WATERFALL
+    SILENT,	// LOC_SOFTROOM
+    SILENT,	// LOC_ORIENTAL
+    NO_MEANING,	// LOC_MISTY
+    SILENT,	// LOC_ALCOVE
+    SILENT,	// LOC_PLOVER
+    SILENT,	// LOC_DARKROOM
+    SILENT,	// LOC_ARCHED
+    SILENT,	// LOC_SHELLROOM
+    SILENT,	// LOC_SLOPING1
+    SILENT,	// LOC_CULDESAC
+    SILENT,	// LOC_ANTEROOM
+    SILENT,	// LOC_DIFFERENT1
+    SILENT,	// LOC_WITTSEND
+    WIND_WHISTLES,	// LOC_MIRRORCANYON
+    SILENT,	// LOC_WINDOW2
+    SILENT,	// LOC_TOPSTALACTITE
+    SILENT,	// LOC_DIFFERENT2
+    STREAM_SPLASHES,	// LOC_RESERVOIR
+    SILENT,	// LOC_DEADEND12
+    MURMURING_SNORING,	// LOC_NE
+    SNAKES_HISSING,	// LOC_SW
+    SILENT,	// LOC_SWCHASM
+    SILENT,	// LOC_WINDING
+    SILENT,	// LOC_SECRET4
+    SILENT,	// LOC_SECRET5
+    SILENT,	// LOC_SECRET6
+    SILENT,	// LOC_NECHASM
+    DULL_RUMBLING,	// LOC_CORRIDOR
+    DULL_RUMBLING,	// LOC_FORK
+    LOUD_ROAR,	// LOC_WARMWALLS
+    TOTAL_ROAR,	// LOC_BREATHTAKING
+    DULL_RUMBLING,	// LOC_BOULDERS2
+    SILENT,	// LOC_LIMESTONE
+    SILENT,	// LOC_BARRENFRONT
+    SILENT,	// LOC_BARRENROOM
+    SILENT,	// LOC_DIFFERENT3
+    SILENT,	// LOC_DIFFERENT4
+    SILENT,	// LOC_DIFFERENT5
+    SILENT,	// LOC_DIFFERENT6
+    SILENT,	// LOC_DIFFERENT7
+    SILENT,	// LOC_DIFFERENT8
+    SILENT,	// LOC_DIFFERENT9
+    SILENT,	// LOC_DIFFERENT10
+    SILENT,	// LOC_DIFFERENT11
+    SILENT,	// LOC_DEADEND13
+    SILENT,	// LOC_ROUGHHEWN
+    SILENT,	// LOC_BADDIRECTION
+    SILENT,	// LOC_LARGE
+    SILENT,	// LOC_STOREROOM
+    SILENT,	// LOC_FOREST1
+    SILENT,	// LOC_FOREST2
+    SILENT,	// LOC_FOREST3
+    SILENT,	// LOC_FOREST4
+    SILENT,	// LOC_FOREST5
+    SILENT,	// LOC_FOREST6
+    SILENT,	// LOC_FOREST7
+    SILENT,	// LOC_FOREST8
+    SILENT,	// LOC_FOREST9
+    SILENT,	// LOC_FOREST10
+    SILENT,	// LOC_FOREST11
+    SILENT,	// LOC_FOREST12
+    SILENT,	// LOC_FOREST13
+    SILENT,	// LOC_FOREST14
+    SILENT,	// LOC_FOREST15
+    SILENT,	// LOC_FOREST16
+    SILENT,	// LOC_FOREST17
+    SILENT,	// LOC_FOREST18
+    SILENT,	// LOC_FOREST19
+    SILENT,	// LOC_FOREST20
+    SILENT,	// LOC_FOREST21
+    SILENT,	// LOC_FOREST22
+    SILENT,	// LOC_LEDGE
+    TOTAL_ROAR,	// LOC_RESBOTTOM
+    WATERS_CRASHING,	// LOC_RESNORTH
+    SILENT,	// LOC_TREACHEROUS
+    SILENT,	// LOC_STEEP
+    SILENT,	// LOC_CLIFFBASE
+    SILENT,	// LOC_CLIFFACE
+    SILENT,	// LOC_FOOTSLIP
+    SILENT,	// LOC_CLIFFTOP
+    SILENT,	// LOC_CLIFFLEDGE
+    SILENT,	// LOC_REACHDEAD
+    SILENT,	// LOC_GRUESOME
+    SILENT,	// LOC_FOOF1
+    SILENT,	// LOC_FOOF2
+    SILENT,	// LOC_FOOF3
+    SILENT,	// LOC_FOOF4
+    SILENT,	// LOC_FOOF5
+    SILENT,	// LOC_FOOF6
+};
+
+const bool location_loud[] = {
+    false,	// LOC_NOWHERE
+    false,	// LOC_START
+    false,	// LOC_HILL
+    false,	// LOC_BUILDING
+    false,	// LOC_VALLEY
+    false,	// LOC_ROADEND
+    false,	// LOC_CLIFF
+    false,	// LOC_SLIT
+    false,	// LOC_GRATE
+    false,	// LOC_BELOWGRATE
+    false,	// LOC_COBBLE
+    false,	// LOC_DEBRIS
+    false,	// LOC_AWKWARD
+    false,	// LOC_BIRD
+    false,	// LOC_PITTOP
+    false,	// LOC_MISTHALL
+    false,	// LOC_CRACK
+    false,	// LOC_EASTBANK
+    false,	// LOC_NUGGET
+    false,	// LOC_KINGHALL
+    false,	// LOC_NECKBROKE
+    false,	// LOC_NOMAKE
+    false,	// LOC_DOME
+    false,	// LOC_WESTEND
+    false,	// LOC_EASTPIT
+    false,	// LOC_WESTPIT
+    false,	// LOC_CLIMBSTALK
+    false,	// LOC_WESTBANK
+    false,	// LOC_FLOORHOLE
+    false,	// LOC_SOUTHSIDE
+    false,	// LOC_WESTSIDE
+    false,	// LOC_BUILDING1
+    false,	// LOC_SNAKEBLOCK
+    false,	// LOC_Y2
+    false,	// LOC_JUMBLE
+    false,	// LOC_WINDOW1
+    false,	// LOC_BROKEN
+    false,	// LOC_SMALLPITBRINK
+    false,	// LOC_SMALLPIT
+    false,	// LOC_DUSTY
+    false,	// LOC_PARALLEL1
+    false,	// LOC_MISTWEST
+    false,	// LOC_ALIKE1
+    false,	// LOC_ALIKE2
+    false,	// LOC_ALIKE3
+    false,	// LOC_ALIKE4
+    false,	// LOC_DEADEND1
+    false,	// LOC_DEADEND2
+    false,	// LOC_DEADEND3
+    false,	// LOC_ALIKE5
+    false,	// LOC_ALIKE6
+    false,	// LOC_ALIKE7
+    false,	// LOC_ALIKE8
+    false,	// LOC_ALIKE9
+    false,	// LOC_DEADEND4
+    false,	// LOC_ALIKE10
+    false,	// LOC_DEADEND5
+    false,	// LOC_PITBRINK
+    false,	// LOC_DEADEND6
+    false,	// LOC_PARALLEL2
+    false,	// LOC_LONGEAST
+    false,	// LOC_LONGWEST
+    false,	// LOC_CROSSOVER
+    false,	// LOC_DEADEND7
+    false,	// LOC_COMPLEX
+    false,	// LOC_BEDQUILT
+    false,	// LOC_SWISSCHEESE
+    false,	// LOC_EASTEND
+    false,	// LOC_SLAB
+    false,	// LOC_SECRET1
+    false,	// LOC_SECRET2
+    false,	// LOC_THREEJUNCTION
+    false,	// LOC_LOWROOM
+    false,	// LOC_DEADCRAWL
+    false,	// LOC_SECRET3
+    false,	// LOC_WIDEPLACE
+    false,	// LOC_TIGHTPLACE
+    false,	// LOC_TALL
+    false,	// LOC_BOULDERS1
+    false,	// LOC_SEWER
+    false,	// LOC_ALIKE11
+    false,	// LOC_DEADEND8
+    false,	// LOC_DEADEND9
+    false,	// LOC_ALIKE12
+    false,	// LOC_ALIKE13
+    false,	// LOC_DEADEND10
+    false,	// LOC_DEADEND11
+    false,	// LOC_ALIKE14
+    false,	// LOC_NARROW
+    false,	// LOC_NOCLIMB
+    false,	// LOC_PLANTTOP
+    false,	// LOC_INCLINE
+    false,	// LOC_GIANTROOM
+    false,	// LOC_CAVEIN
+    false,	// LOC_IMMENSE
+    false,	// LOC_WATERFALL
+    false,	// LOC_SOFTROOM
+    false,	// LOC_ORIENTAL
+    false,	// LOC_MISTY
+    false,	// LOC_ALCOVE
+    false,	// LOC_PLOVER
+    false,	// LOC_DARKROOM
+    false,	// LOC_ARCHED
+    false,	// LOC_SHELLROOM
+    false,	// LOC_SLOPING1
+    false,	// LOC_CULDESAC
+    false,	// LOC_ANTEROOM
+    false,	// LOC_DIFFERENT1
+    false,	// LOC_WITTSEND
+    false,	// LOC_MIRRORCANYON
+    false,	// LOC_WINDOW2
+    false,	// LOC_TOPSTALACTITE
+    false,	// LOC_DIFFERENT2
+    false,	// LOC_RESERVOIR
+    false,	// LOC_DEADEND12
+    false,	// LOC_NE
+    false,	// LOC_SW
+    false,	// LOC_SWCHASM
+    false,	// LOC_WINDING
+    false,	// LOC_SECRET4
+    false,	// LOC_SECRET5
+    false,	// LOC_SECRET6
+    false,	// LOC_NECHASM
+    false,	// LOC_CORRIDOR
+    false,	// LOC_FORK
+    false,	// LOC_WARMWALLS
+    true,	// LOC_BREATHTAKING
+    false,	// LOC_BOULDERS2
+    false,	// LOC_LIMESTONE
+    false,	// LOC_BARRENFRONT
+    false,	// LOC_BARRENROOM
+    false,	// LOC_DIFFERENT3
+    false,	// LOC_DIFFERENT4
+    false,	// LOC_DIFFERENT5
+    false,	// LOC_DIFFERENT6
+    false,	// LOC_DIFFERENT7
+    false,	// LOC_DIFFERENT8
+    false,	// LOC_DIFFERENT9
+    false,	// LOC_DIFFERENT10
+    false,	// LOC_DIFFERENT11
+    false,	// LOC_DEADEND13
+    false,	// LOC_ROUGHHEWN
+    false,	// LOC_BADDIRECTION
+    false,	// LOC_LARGE
+    false,	// LOC_STOREROOM
+    false,	// LOC_FOREST1
+    false,	// LOC_FOREST2
+    false,	// LOC_FOREST3
+    false,	// LOC_FOREST4
+    false,	// LOC_FOREST5
+    false,	// LOC_FOREST6
+    false,	// LOC_FOREST7
+    false,	// LOC_FOREST8
+    false,	// LOC_FOREST9
+    false,	// LOC_FOREST10
+    false,	// LOC_FOREST11
+    false,	// LOC_FOREST12
+    false,	// LOC_FOREST13
+    false,	// LOC_FOREST14
+    false,	// LOC_FOREST15
+    false,	// LOC_FOREST16
+    false,	// LOC_FOREST17
+    false,	// LOC_FOREST18
+    false,	// LOC_FOREST19
+    false,	// LOC_FOREST20
+    false,	// LOC_FOREST21
+    false,	// LOC_FOREST22
+    false,	// LOC_LEDGE
+    true,	// LOC_RESBOTTOM
+    false,	// LOC_RESNORTH
+    false,	// LOC_TREACHEROUS
+    false,	// LOC_STEEP
+    false,	// LOC_CLIFFBASE
+    false,	// LOC_CLIFFACE
+    false,	// LOC_FOOTSLIP
+    false,	// LOC_CLIFFTOP
+    false,	// LOC_CLIFFLEDGE
+    false,	// LOC_REACHDEAD
+    false,	// LOC_GRUESOME
+    false,	// LOC_FOOF1
+    false,	// LOC_FOOF2
+    false,	// LOC_FOOF3
+    false,	// LOC_FOOF4
+    false,	// LOC_FOOF5
+    false,	// LOC_FOOF6
+};
+
+/* Every treasure, in object order */
+const short treasures[] = {
+    NUGGET,
+    OBJ_51,
+    OBJ_52,
+    OBJ_53,
+    COINS,
+    CHEST,
+    EGGS,
+    TRIDENT,
+    VASE,
+    EMERALD,
+    PYRAMID,
+    PEARL,
+    RUG,
+    OBJ_63,
+    CHAIN,
+    RUBY,
+    JADE,
+    AMBER,
+    SAPPH,
+    OBJ_69,
+};
+
+const uint64_t treasure_set[OBJWORDS] = {UINT64_C(0xfffc000000000000), UINT64_C(0x000000000000003f)};
+
+/* What each object is worth in the building, 0 if not a treasure */
+const short deposit_points[] = {
+    0,	// NO_OBJECT
+    0,	// KEYS
+    0,	// LAMP
+    0,	// GRATE
+    0,	// CAGE
+    0,	// ROD
+    0,	// ROD2
+    0,	// STEPS
+    0,	// BIRD
+    0,	// DOOR
+    0,	// PILLOW
+    0,	// SNAKE
+    0,	// FISSURE
+    0,	// OBJ_13
+    0,	// CLAM
+    0,	// OYSTER
+    0,	// MAGAZINE
+    0,	// DWARF
+    0,	// KNIFE
+    0,	// FOOD
+    0,	// BOTTLE
+    0,	// WATER
+    0,	// OIL
+    0,	// MIRROR
+    0,	// PLANT
+    0,	// PLANT2
+    0,	// OBJ_26
+    0,	// OBJ_27
+    0,	// AXE
+    0,	// OBJ_29
+    0,	// OBJ_30
+    0,	// DRAGON
+    0,	// CHASM
+    0,	// TROLL
+    0,	// TROLL2
+    0,	// BEAR
+    0,	// MESSAG
+    0,	// VOLCANO
+    0,	// VEND
+    0,	// BATTERY
+    0,	// OBJ_40
+    0,	// OGRE
+    0,	// URN
+    0,	// CAVITY
+    0,	// BLOOD
+    0,	// RESER
+    0,	// OBJ_46
+    0,	// OBJ_47
+    0,	// OBJ_48
+    0,	// SIGN
+    12,	// NUGGET
+    12,	// OBJ_51
+    12,	// OBJ_52
+    12,	// OBJ_53
+    12,	// COINS
+    14,	// CHEST
+    16,	// EGGS
+    16,	// TRIDENT
+    16,	// VASE
+    16,	// EMERALD
+    16,	// PYRAMID
+    16,	// PEARL
+    16,	// RUG
+    16,	// OBJ_63
+    16,	// CHAIN
+    16,	// RUBY
+    16,	// JADE
+    16,	// AMBER
+    16,	// SAPPH
+    16,	// OBJ_69
+};
+
+const obituary_t obituaries[] = {
+    {
+        .query = 45142,
+        .yes_response = 45309,
+    },
+    {
+        .query = 45509,
+        .yes_response = 45638,
+    },
+    {
+        .query = 45750,
+        .yes_response = 45887,
+    },
+};
+
+const hint_t hints[] = {
+    {
+        .number = 1,
+        .penalty = 2,
+        .turns = 4,
+        .question = 45943,
+        .hint = 45980,
+    },
+    {
+        .number = 2,
+        .penalty = 2,
+        .turns = 5,
+        .question = 46149,
+        .hint = 46183,
+    },
+    {
+        .number = 3,
+        .penalty = 2,
+        .turns = 8,
+        .question = 46279,
+        .hint = 46326,
+    },
+    {
+        .number = 4,
+        .penalty = 4,
+        .turns = 75,
+        .question = 46487,
+        .hint = 46529,
+    },
+    {
+        .number = 5,
+        .penalty = 5,
+        .turns = 25,
+        .question = 46591,
+        .hint = 46641,
+    },
+    {
+        .number = 6,
+        .penalty = 3,
+        .turns = 20,
+        .question = 46809,
+        .hint = 46847,
+    },
+    {
+        .number = 7,
+        .penalty = 2,
+        .turns = 8,
+        .question = 46863,
+        .hint = 46898,
+    },
+    {
+        .number = 8,
+        .penalty = 2,
+        .turns = 25,
+        .question = 46953,
+        .hint = 46999,
+    },
+    {
+        .number = 9,
+        .penalty = 4,
+        .turns = 10,
+        .question = 47092,
+        .hint = 47132,
+    },
+    {
+        .number = 10,
+        .penalty = 4,
+        .turns = 1,
+        .question = 47265,
+        .hint = 47335,
+    },
+};
+
+const long conditions[] = {
+    0,	// LOC_NOWHERE
+    (1<<COND_FLUID)|(1<<COND_ABOVE)|(1<<COND_LIT),	// LOC_START
+    (1<<COND_ABOVE)|(1<<COND_LIT),	// LOC_HILL
+    (1<<COND_FLUID)|(1<<COND_ABOVE)|(1<<COND_LIT),	// LOC_BUILDING
+    (1<<COND_FLUID)|(1<<COND_ABOVE)|(1<<COND_LIT),	// LOC_VALLEY
+    (1<<COND_ABOVE)|(1<<COND_LIT),	// LOC_ROADEND
+    (1<<COND_ABOVE)|(1<<COND_NOBACK)|(1<<COND_LIT)|(1<<COND_HCLIFF),	// LOC_CLIFF
+    (1<<COND_FLUID)|(1<<COND_ABOVE)|(1<<COND_LIT),	// LOC_SLIT
+    (1<<COND_ABOVE)|(1<<COND_LIT)|(1<<COND_HCAVE)|(1<<COND_HJADE),	// LOC_GRATE
+    (1<<COND_LIT),	// LOC_BELOWGRATE
+    (1<<COND_LIT),	// LOC_COBBLE
+    0,	// LOC_DEBRIS
+    0,	// LOC_AWKWARD
+    (1<<COND_HBIRD),	// LOC_BIRD
+    0,	// LOC_PITTOP
+    (1<<COND_DEEP)|(1<<COND_HJADE),	// LOC_MISTHALL
+    (1<<COND_DEEP)|(1<<COND_FORCED),	// LOC_CRACK
+    (1<<COND_DEEP),	// LOC_EASTBANK
+    (1<<COND_DEEP),	// LOC_NUGGET
+    (1<<COND_DEEP)|(1<<COND_HSNAKE),	// LOC_KINGHALL
+    (1<<COND_DEEP)|(1<<COND_FORCED),	// LOC_NECKBROKE
+    (1<<COND_DEEP)|(1<<COND_FORCED),	// LOC_NOMAKE
+    (1<<COND_DEEP)|(1<<COND_FORCED),	// LOC_DOME
+    (1<<COND_DEEP),	// LOC_WESTEND
+    (1<<COND_FLUID)|(1<<COND_DEEP)|(1<<COND_OILY),	// LOC_EASTPIT
+    (1<<COND_DEEP),	// LOC_WESTPIT
+    (1<<COND_DEEP)|(1<<COND_FORCED),	// LOC_CLIMBSTALK
+    (1<<COND_DEEP),	// LOC_WESTBANK
+    (1<<COND_DEEP),	// LOC_FLOORHOLE
+    (1<<COND_DEEP),	// LOC_SOUTHSIDE
+    (1<<COND_DEEP),	// LOC_WESTSIDE
+    (1<<COND_DEEP)|(1<<COND_FORCED),	// LOC_BUILDING1
+    (1<<COND_DEEP)|(1<<COND_FORCED),	// LOC_SNAKEBLOCK
+    (1<<COND_DEEP),	// LOC_Y2
+    (1<<COND_DEEP),	// LOC_JUMBLE
+    (1<<COND_DEEP),	// LOC_WINDOW1
+    (1<<COND_DEEP),	// LOC_BROKEN
+    (1<<COND_DEEP),	// LOC_SMALLPITBRINK
+    (1<<COND_FLUID)|(1<<COND_DEEP),	// LOC_SMALLPIT
+    (1<<COND_DEEP),	// LOC_DUSTY
+    (1<<COND_DEEP)|(1<<COND_FORCED),	// LOC_PARALLEL1
+    (1<<COND_DEEP),	// LOC_MISTWEST
+    (1<<COND_DEEP)|(1<<COND_NOBACK)|(1<<COND_HMAZE),	// LOC_ALIKE1
+    (1<<COND_DEEP)|(1<<COND_NOBACK)|(1<<COND_HMAZE),	// LOC_ALIKE2
+    (1<<COND_DEEP)|(1<<COND_NOBACK)|(1<<COND_HMAZE),	// LOC_ALIKE3
+    (1<<COND_DEEP)|(1<<COND_NOBACK)|(1<<COND_HMAZE),	// LOC_ALIKE4
+    (1<<COND_DEEP)|(1<<COND_NOARRR)|(1<<COND_HMAZE),	// LOC_DEADEND1
+    (1<<COND_DEEP)|(1<<COND_NOARRR)|(1<<COND_HMAZE),	// LOC_DEADEND2
+    (1<<COND_DEEP)|(1<<COND_NOARRR)|(1<<COND_HMAZE),	// LOC_DEADEND3
+    (1<<COND_DEEP)|(1<<COND_NOBACK)|(1<<COND_HMAZE),	// LOC_ALIKE5
+    (1<<COND_DEEP)|(1<<COND_NOBACK)|(1<<COND_HMAZE),	// LOC_ALIKE6
+    (1<<COND_DEEP)|(1<<COND_NOBACK)|(1<<COND_HMAZE),	// LOC_ALIKE7
+    (1<<COND_DEEP)|(1<<COND_NOBACK)|(1<<COND_HMAZE),	// LOC_ALIKE8
+    (1<<COND_DEEP)|(1<<COND_NOBACK)|(1<<COND_HMAZE),	// LOC_ALIKE9
+    (1<<COND_DEEP)|(1<<COND_NOARRR)|(1<<COND_HMAZE),	// LOC_DEADEND4
+    (1<<COND_DEEP)|(1<<COND_NOBACK)|(1<<COND_HMAZE),	// LOC_ALIKE10
+    (1<<COND_DEEP)|(1<<COND_NOARRR)|(1<<COND_HMAZE),	// LOC_DEADEND5
+    (1<<COND_DEEP)|(1<<COND_NOBACK),	// LOC_PITBRINK
+    (1<<COND_NOARRR)|(1<<COND_DEEP),	// LOC_DEADEND6
+    (1<<COND_DEEP)|(1<<COND_FORCED),	// LOC_PARALLEL2
+    (1<<COND_DEEP),	// LOC_LONGEAST
+    (1<<COND_DEEP),	// LOC_LONGWEST
+    (1<<COND_DEEP),	// LOC_CROSSOVER
+    (1<<COND_DEEP),	// LOC_DEADEND7
+    (1<<COND_DEEP)|(1<<COND_HJADE),	// LOC_COMPLEX
+    (1<<COND_DEEP),	// LOC_BEDQUILT
+    (1<<COND_DEEP),	// LOC_SWISSCHEESE
+    (1<<COND_DEEP),	// LOC_EASTEND
+    (1<<COND_DEEP),	// LOC_SLAB
+    (1<<COND_DEEP),	// LOC_SECRET1
+    (1<<COND_DEEP),	// LOC_SECRET2
+    (1<<COND_DEEP),	// LOC_THREEJUNCTION
+    (1<<COND_DEEP),	// LOC_LOWROOM
+    (1<<COND_DEEP),	// LOC_DEADCRAWL
+    (1<<COND_DEEP),	// LOC_SECRET3
+    (1<<COND_DEEP),	// LOC_WIDEPLACE
+    (1<<COND_DEEP),	// LOC_TIGHTPLACE
+    (1<<COND_DEEP),	// LOC_TALL
+    (1<<COND_DEEP),	// LOC_BOULDERS1
+    (1<<COND_DEEP)|(1<<COND_FORCED),	// LOC_SEWER
+    (1<<COND_DEEP)|(1<<COND_NOBACK)|(1<<COND_HMAZE),	// LOC_ALIKE11
+    (1<<COND_DEEP)|(1<<COND_HMAZE),	// LOC_DEADEND8
+    (1<<COND_DEEP)|(1<<COND_NOARRR)|(1<<COND_HMAZE),	// LOC_DEADEND9
+    (1<<COND_DEEP)|(1<<COND_NOBACK),	// LOC_ALIKE12
+    (1<<COND_DEEP)|(1<<COND_NOBACK),	// LOC_ALIKE13
+    (1<<COND_NOARRR)|(1<<COND_DEEP),	// LOC_DEADEND10
+    (1<<COND_DEEP)|(1<<COND_NOARRR)|(1<<COND_HMAZE),	// LOC_DEADEND11
+    (1<<COND_DEEP)|(1<<COND_NOBACK)|(1<<COND_HMAZE),	// LOC_ALIKE14
+    (1<<COND_DEEP),	// LOC_NARROW
+    (1<<COND_DEEP)|(1<<COND_FORCED),	// LOC_NOCLIMB
+    (1<<COND_DEEP)|(1<<COND_FORCED),	// LOC_PLANTTOP
+    (1<<COND_DEEP),	// LOC_INCLINE
+    (1<<COND_DEEP),	// LOC_GIANTROOM
+    (1<<COND_DEEP),	// LOC_CAVEIN
+    (1<<COND_DEEP),	// LOC_IMMENSE
+    (1<<COND_FLUID)|(1<<COND_DEEP),	// LOC_WATERFALL
+    (1<<COND_DEEP),	// LOC_SOFTROOM
+    (1<<COND_DEEP),	// LOC_ORIENTAL
+    (1<<COND_DEEP),	// LOC_MISTY
+    (1<<COND_DEEP)|(1<<COND_HDARK),	// LOC_ALCOVE
+    (1<<COND_DEEP)|(1<<COND_LIT)|(1<<COND_HDARK),	// LOC_PLOVER
+    (1<<COND_DEEP)|(1<<COND_HDARK),	// LOC_DARKROOM
+    (1<<COND_DEEP),	// LOC_ARCHED
+    (1<<COND_DEEP),	// LOC_SHELLROOM
+    (1<<COND_DEEP),	// LOC_SLOPING1
+    (1<<COND_DEEP),	// LOC_CULDESAC
+    (1<<COND_DEEP),	// LOC_ANTEROOM
+    (1<<COND_DEEP)|(1<<COND_NOBACK),	// LOC_DIFFERENT1
+    (1<<COND_DEEP)|(1<<COND_NOBACK)|(1<<COND_HWITT),	// LOC_WITTSEND
+    (1<<COND_DEEP)|(1<<COND_HJADE),	// LOC_MIRRORCANYON
+    (1<<COND_DEEP),	// LOC_WINDOW2
+    (1<<COND_DEEP),	// LOC_TOPSTALACTITE
+    (1<<COND_DEEP)|(1<<COND_NOBACK),	// LOC_DIFFERENT2
+    (1<<COND_FLUID)|(1<<COND_DEEP),	// LOC_RESERVOIR
+    (1<<COND_DEEP),	// LOC_DEADEND12
+    (1<<COND_DEEP)|(1<<COND_LIT),	// LOC_NE
+    (1<<COND_DEEP)|(1<<COND_LIT),	// LOC_SW
+    (1<<COND_DEEP),	// LOC_SWCHASM
+    (1<<COND_DEEP),	// LOC_WINDING
+    (1<<COND_DEEP),	// LOC_SECRET4
+    (1<<COND_DEEP),	// LOC_SECRET5
+    (1<<COND_DEEP),	// LOC_SECRET6
+    (1<<COND_NOARRR)|(1<<COND_DEEP),	// LOC_NECHASM
+    (1<<COND_NOARRR)|(1<<COND_DEEP),	// LOC_CORRIDOR
+    (1<<COND_NOARRR)|(1<<COND_DEEP),	// LOC_FORK
+    (1<<COND_NOARRR)|(1<<COND_DEEP),	// LOC_WARMWALLS
+    (1<<COND_NOARRR)|(1<<COND_LIT)|(1<<COND_DEEP)|(1<<COND_HJADE),	// LOC_BREATHTAKING
+    (1<<COND_NOARRR)|(1<<COND_DEEP),	// LOC_BOULDERS2
+    (1<<COND_NOARRR)|(1<<COND_DEEP),	// LOC_LIMESTONE
+    (1<<COND_NOARRR)|(1<<COND_DEEP),	// LOC_BARRENFRONT
+    (1<<COND_NOARRR)|(1<<COND_DEEP),	// LOC_BARRENROOM
+    (1<<COND_DEEP)|(1<<COND_NOBACK),	// LOC_DIFFERENT3
+    (1<<COND_DEEP)|(1<<COND_NOBACK),	// LOC_DIFFERENT4
+    (1<<COND_DEEP)|(1<<COND_NOBACK),	// LOC_DIFFERENT5
+    (1<<COND_DEEP)|(1<<COND_NOBACK),	// LOC_DIFFERENT6
+    (1<<COND_DEEP)|(1<<COND_NOBACK),	// LOC_DIFFERENT7
+    (1<<COND_DEEP)|(1<<COND_NOBACK),	// LOC_DIFFERENT8
+    (1<<COND_DEEP)|(1<<COND_NOBACK),	// LOC_DIFFERENT9
+    (1<<COND_DEEP)|(1<<COND_NOBACK),	// LOC_DIFFERENT10
+    (1<<COND_DEEP)|(1<<COND_NOBACK),	// LOC_DIFFERENT11
+    (1<<COND_DEEP),	// LOC_DEADEND13
+    (1<<COND_DEEP),	// LOC_ROUGHHEWN
+    (1<<COND_DEEP)|(1<<COND_FORCED),	// LOC_BADDIRECTION
+    (1<<COND_DEEP)|(1<<COND_HOGRE),	// LOC_LARGE
+    (1<<COND_DEEP),	// LOC_STOREROOM
+    (1<<COND_FOREST)|(1<<COND_NOBACK)|(1<<COND_LIT)|(1<<COND_HWOODS),	// LOC_FOREST1
+    (1<<COND_FOREST)|(1<<COND_NOBACK)|(1<<COND_LIT)|(1<<COND_HWOODS),	// LOC_FOREST2
+    (1<<COND_FOREST)|(1<<COND_NOBACK)|(1<<COND_LIT)|(1<<COND_HWOODS),	// LOC_FOREST3
+    (1<<COND_FOREST)|(1<<COND_NOBACK)|(1<<COND_LIT)|(1<<COND_HWOODS),	// LOC_FOREST4
+    (1<<COND_FOREST)|(1<<COND_NOBACK)|(1<<COND_LIT)|(1<<COND_HWOODS),	// LOC_FOREST5
+    (1<<COND_FOREST)|(1<<COND_NOBACK)|(1<<COND_LIT)|(1<<COND_HWOODS),	// LOC_FOREST6
+    (1<<COND_FOREST)|(1<<COND_NOBACK)|(1<<COND_LIT)|(1<<COND_HWOODS),	// LOC_FOREST7
+    (1<<COND_FOREST)|(1<<COND_NOBACK)|(1<<COND_LIT)|(1<<COND_HWOODS),	// LOC_FOREST8
+    (1<<COND_FOREST)|(1<<COND_NOBACK)|(1<<COND_LIT)|(1<<COND_HWOODS),	// LOC_FOREST9
+    (1<<COND_FOREST)|(1<<COND_NOBACK)|(1<<COND_LIT)|(1<<COND_HWOODS),	// LOC_FOREST10
+    (1<<COND_FOREST)|(1<<COND_NOBACK)|(1<<COND_LIT)|(1<<COND_HWOODS),	// LOC_FOREST11
+    (1<<COND_FOREST)|(1<<COND_NOBACK)|(1<<COND_LIT)|(1<<COND_HWOODS),	// LOC_FOREST12
+    (1<<COND_FOREST)|(1<<COND_NOBACK)|(1<<COND_LIT)|(1<<COND_HWOODS),	// LOC_FOREST13
+    (1<<COND_FOREST)|(1<<COND_NOBACK)|(1<<COND_LIT)|(1<<COND_HWOODS),	// LOC_FOREST14
+    (1<<COND_FOREST)|(1<<COND_NOBACK)|(1<<COND_LIT)|(1<<COND_HWOODS),	// LOC_FOREST15
+    (1<<COND_FOREST)|(1<<COND_NOBACK)|(1<<COND_LIT)|(1<<COND_HWOODS),	// LOC_FOREST16
+    (1<<COND_FOREST)|(1<<COND_NOBACK)|(1<<COND_LIT)|(1<<COND_HWOODS),	// LOC_FOREST17
+    (1<<COND_FOREST)|(1<<COND_NOBACK)|(1<<COND_LIT)|(1<<COND_HWOODS),	// LOC_FOREST18
+    (1<<COND_FOREST)|(1<<COND_NOBACK)|(1<<COND_LIT)|(1<<COND_HWOODS),	// LOC_FOREST19
+    (1<<COND_FOREST)|(1<<COND_NOBACK)|(1<<COND_LIT)|(1<<COND_HWOODS),	// LOC_FOREST20
+    (1<<COND_FOREST)|(1<<COND_NOBACK)|(1<<COND_LIT)|(1<<COND_HWOODS),	// LOC_FOREST21
+    (1<<COND_FOREST)|(1<<COND_NOBACK)|(1<<COND_LIT)|(1<<COND_HWOODS),	// LOC_FOREST22
+    (1<<COND_ABOVE)|(1<<COND_LIT),	// LOC_LEDGE
+    (1<<COND_FLUID)|(1<<COND_DEEP),	// LOC_RESBOTTOM
+    (1<<COND_FLUID)|(1<<COND_DEEP),	// LOC_RESNORTH
+    (1<<COND_DEEP),	// LOC_TREACHEROUS
+    (1<<COND_DEEP),	// LOC_STEEP
+    (1<<COND_DEEP),	// LOC_CLIFFBASE
+    (1<<COND_DEEP),	// LOC_CLIFFACE
+    (1<<COND_DEEP)|(1<<COND_FORCED),	// LOC_FOOTSLIP
+    (1<<COND_DEEP)|(1<<COND_FORCED),	// LOC_CLIFFTOP
+    (1<<COND_DEEP),	// LOC_CLIFFLEDGE
+    (1<<COND_DEEP),	// LOC_REACHDEAD
+    (1<<COND_DEEP)|(1<<COND_FORCED),	// LOC_GRUESOME
+    (1<<COND_FORCED),	// LOC_FOOF1
+    (1<<COND_ABOVE)|(1<<COND_FORCED),	// LOC_FOOF2
+    (1<<COND_DEEP)|(1<<COND_FORCED),	// LOC_FOOF3
+    (1<<COND_ABOVE)|(1<<COND_FORCED),	// LOC_FOOF4
+    (1<<COND_DEEP)|(1<<COND_FORCED),	// LOC_FOOF5
+    (1<<COND_DEEP)|(1<<COND_FORCED),	// LOC_FOOF6
+
+};
+
+/* The hints that can come due at each location, bit n for hint n */
+const uint32_t location_hints[] = {
+    0x0000,	// LOC_NOWHERE
+    0x0000,	// LOC_START
+    0x0000,	// LOC_HILL
+    0x0000,	// LOC_BUILDING
+    0x0000,	// LOC_VALLEY
+    0x0000,	// LOC_ROADEND
+    0x0040,	// LOC_CLIFF
+    0x0000,	// LOC_SLIT
+    0x0201,	// LOC_GRATE
+    0x0000,	// LOC_BELOWGRATE
+    0x0000,	// LOC_COBBLE
+    0x0000,	// LOC_DEBRIS
+    0x0000,	// LOC_AWKWARD
+    0x0002,	// LOC_BIRD
+    0x0000,	// LOC_PITTOP
+    0x0200,	// LOC_MISTHALL
+    0x0000,	// LOC_CRACK
+    0x0000,	// LOC_EASTBANK
+    0x0000,	// LOC_NUGGET
+    0x0004,	// LOC_KINGHALL
+    0x0000,	// LOC_NECKBROKE
+    0x0000,	// LOC_NOMAKE
+    0x0000,	// LOC_DOME
+    0x0000,	// LOC_WESTEND
+    0x0000,	// LOC_EASTPIT
+    0x0000,	// LOC_WESTPIT
+    0x0000,	// LOC_CLIMBSTALK
+    0x0000,	// LOC_WESTBANK
+    0x0000,	// LOC_FLOORHOLE
+    0x0000,	// LOC_SOUTHSIDE
+    0x0000,	// LOC_WESTSIDE
+    0x0000,	// LOC_BUILDING1
+    0x0000,	// LOC_SNAKEBLOCK
+    0x0000,	// LOC_Y2
+    0x0000,	// LOC_JUMBLE
+    0x0000,	// LOC_WINDOW1
+    0x0000,	// LOC_BROKEN
+    0x0000,	// LOC_SMALLPITBRINK
+    0x0000,	// LOC_SMALLPIT
+    0x0000,	// LOC_DUSTY
+    0x0000,	// LOC_PARALLEL1
+    0x0000,	// LOC_MISTWEST
+    0x0008,	// LOC_ALIKE1
+    0x0008,	// LOC_ALIKE2
+    0x0008,	// LOC_ALIKE3
+    0x0008,	// LOC_ALIKE4
+    0x0008,	// LOC_DEADEND1
+    0x0008,	// LOC_DEADEND2
+    0x0008,	// LOC_DEADEND3
+    0x0008,	// LOC_ALIKE5
+    0x0008,	// LOC_ALIKE6
+    0x0008,	// LOC_ALIKE7
+    0x0008,	// LOC_ALIKE8
+    0x0008,	// LOC_ALIKE9
+    0x0008,	// LOC_DEADEND4
+    0x0008,	// LOC_ALIKE10
+    0x0008,	// LOC_DEADEND5
+    0x0000,	// LOC_PITBRINK
+    0x0000,	// LOC_DEADEND6
+    0x0000,	// LOC_PARALLEL2
+    0x0000,	// LOC_LONGEAST
+    0x0000,	// LOC_LONGWEST
+    0x0000,	// LOC_CROSSOVER
+    0x0000,	// LOC_DEADEND7
+    0x0200,	// LOC_COMPLEX
+    0x0000,	// LOC_BEDQUILT
+    0x0000,	// LOC_SWISSCHEESE
+    0x0000,	// LOC_EASTEND
+    0x0000,	// LOC_SLAB
+    0x0000,	// LOC_SECRET1
+    0x0000,	// LOC_SECRET2
+    0x0000,	// LOC_THREEJUNCTION
+    0x0000,	// LOC_LOWROOM
+    0x0000,	// LOC_DEADCRAWL
+    0x0000,	// LOC_SECRET3
+    0x0000,	// LOC_WIDEPLACE
+    0x0000,	// LOC_TIGHTPLACE
+    0x0000,	// LOC_TALL
+    0x0000,	// LOC_BOULDERS1
+    0x0000,	// LOC_SEWER
+    0x0008,	// LOC_ALIKE11
+    0x0008,	// LOC_DEADEND8
+    0x0008,	// LOC_DEADEND9
+    0x0000,	// LOC_ALIKE12
+    0x0000,	// LOC_ALIKE13
+    0x0000,	// LOC_DEADEND10
+    0x0008,	// LOC_DEADEND11
+    0x0008,	// LOC_ALIKE14
+    0x0000,	// LOC_NARROW
+    0x0000,	// LOC_NOCLIMB
+    0x0000,	// LOC_PLANTTOP
+    0x0000,	// LOC_INCLINE
+    0x0000,	// LOC_GIANTROOM
+    0x0000,	// LOC_CAVEIN
+    0x0000,	// LOC_IMMENSE
+    0x0000,	// LOC_WATERFALL
+    0x0000,	// LOC_SOFTROOM
+    0x0000,	// LOC_ORIENTAL
+    0x0000,	// LOC_MISTY
+    0x0010,	// LOC_ALCOVE
+    0x0010,	// LOC_PLOVER
+    0x0010,	// LOC_DARKROOM
+    0x0000,	// LOC_ARCHED
+    0x0000,	// LOC_SHELLROOM
+    0x0000,	// LOC_SLOPING1
+    0x0000,	// LOC_CULDESAC
+    0x0000,	// LOC_ANTEROOM
+    0x0000,	// LOC_DIFFERENT1
+    0x0020,	// LOC_WITTSEND
+    0x0200,	// LOC_MIRRORCANYON
+    0x0000,	// LOC_WINDOW2
+    0x0000,	// LOC_TOPSTALACTITE
+    0x0000,	// LOC_DIFFERENT2
+    0x0000,	// LOC_RESERVOIR
+    0x0000,	// LOC_DEADEND12
+    0x0000,	// LOC_NE
+    0x0000,	// LOC_SW
+    0x0000,	// LOC_SWCHASM
+    0x0000,	// LOC_WINDING
+    0x0000,	// LOC_SECRET4
+    0x0000,	// LOC_SECRET5
+    0x0000,	// LOC_SECRET6
+    0x0000,	// LOC_NECHASM
+    0x0000,	// LOC_CORRIDOR
+    0x0000,	// LOC_FORK
+    0x0000,	// LOC_WARMWALLS
+    0x0200,	// LOC_BREATHTAKING
+    0x0000,	// LOC_BOULDERS2
+    0x0000,	// LOC_LIMESTONE
+    0x0000,	// LOC_BARRENFRONT
+    0x0000,	// LOC_BARRENROOM
+    0x0000,	// LOC_DIFFERENT3
+    0x0000,	// LOC_DIFFERENT4
+    0x0000,	// LOC_DIFFERENT5
+    0x0000,	// LOC_DIFFERENT6
+    0x0000,	// LOC_DIFFERENT7
+    0x0000,	// LOC_DIFFERENT8
+    0x0000,	// LOC_DIFFERENT9
+    0x0000,	// LOC_DIFFERENT10
+    0x0000,	// LOC_DIFFERENT11
+    0x0000,	// LOC_DEADEND13
+    0x0000,	// LOC_ROUGHHEWN
+    0x0000,	// LOC_BADDIRECTION
+    0x0100,	// LOC_LARGE
+    0x0000,	// LOC_STOREROOM
+    0x0080,	// LOC_FOREST1
+    0x0080,	// LOC_FOREST2
+    0x0080,	// LOC_FOREST3
+    0x0080,	// LOC_FOREST4
+    0x0080,	// LOC_FOREST5
+    0x0080,	// LOC_FOREST6
+    0x0080,	// LOC_FOREST7
+    0x0080,	// LOC_FOREST8
+    0x0080,	// LOC_FOREST9
+    0x0080,	// LOC_FOREST10
+    0x0080,	// LOC_FOREST11
+    0x0080,	// LOC_FOREST12
+    0x0080,	// LOC_FOREST13
+    0x0080,	// LOC_FOREST14
+    0x0080,	// LOC_FOREST15
+    0x0080,	// LOC_FOREST16
+    0x0080,	// LOC_FOREST17
+    0x0080,	// LOC_FOREST18
+    0x0080,	// LOC_FOREST19
+    0x0080,	// LOC_FOREST20
+    0x0080,	// LOC_FOREST21
+    0x0080,	// LOC_FOREST22
+    0x0000,	// LOC_LEDGE
+    0x0000,	// LOC_RESBOTTOM
+    0x0000,	// LOC_RESNORTH
+    0x0000,	// LOC_TREACHEROUS
+    0x0000,	// LOC_STEEP
+    0x0000,	// LOC_CLIFFBASE
+    0x0000,	// LOC_CLIFFACE
+    0x0000,	// LOC_FOOTSLIP
+    0x0000,	// LOC_CLIFFTOP
+    0x0000,	// LOC_CLIFFLEDGE
+    0x0000,	// LOC_REACHDEAD
+    0x0000,	// LOC_GRUESOME
+    0x0000,	// LOC_FOOF1
+    0x0000,	// LOC_FOOF2
+    0x0000,	// LOC_FOOF3
+    0x0000,	// LOC_FOOF4
+    0x0000,	// LOC_FOOF5
+    0x0000,	// LOC_FOOF6
+};
+
+const motion_t motions[] = {
+    {
+        .words = {
+            .strs = 0,
+            .n = 0,
+        },
+    },
+    {
+        .words = {
+            .strs = 0,
+            .n = 0,
+        },
+    },
+    {
+        .words = {
+            .strs = 581,
+            .n = 2,
+        },
+    },
+    {
+        .words = {
+            .strs = 583,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 584,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 585,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 586,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 587,
+            .n = 3,
+        },
+    },
+    {
+        .words = {
+            .strs = 590,
+            .n = 3,
+        },
+    },
+    {
+        .words = {
+            .strs = 593,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 594,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 595,
+            .n = 4,
+        },
+    },
+    {
+        .words = {
+            .strs = 599,
+            .n = 2,
+        },
+    },
+    {
+        .words = {
+            .strs = 601,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 602,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 603,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 604,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 605,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 606,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 607,
+            .n = 3,
+        },
+    },
+    {
+        .words = {
+            .strs = 610,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 611,
+            .n = 2,
+        },
+    },
+    {
+        .words = {
+            .strs = 613,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 614,
+            .n = 2,
+        },
+    },
+    {
+        .words = {
+            .strs = 616,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 617,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 618,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 619,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 620,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 621,
+            .n = 5,
+        },
+    },
+    {
+        .words = {
+            .strs = 626,
+            .n = 4,
+        },
+    },
+    {
+        .words = {
+            .strs = 630,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 631,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 632,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 633,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 634,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 635,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 636,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 637,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 638,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 639,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 640,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 641,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 642,
+            .n = 2,
+        },
+    },
+    {
+        .words = {
+            .strs = 644,
+            .n = 2,
+        },
+    },
+    {
+        .words = {
+            .strs = 646,
+            .n = 2,
+        },
+    },
+    {
+        .words = {
+            .strs = 648,
+            .n = 2,
+        },
+    },
+    {
+        .words = {
+            .strs = 650,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 651,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 652,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 653,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 654,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 655,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 656,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 657,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 658,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 659,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 660,
+            .n = 6,
+        },
+    },
+    {
+        .words = {
+            .strs = 666,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 667,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 668,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 669,
+            .n = 2,
+        },
+    },
+    {
+        .words = {
+            .strs = 671,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 672,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 673,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 674,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 675,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 676,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 677,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 678,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 679,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 680,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 681,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 682,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 683,
+            .n = 1,
+        },
+    },
+    {
+        .words = {
+            .strs = 684,
+            .n = 2,
+        },
+    },
+
+};
+
+const action_t actions[] = {
+    {
+        .words = {
+            .strs = 0,
+            .n = 0,
+        },
+        .message = 0,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 686,
+            .n = 10,
+        },
+        .message = 1628,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 696,
+            .n = 5,
+        },
+        .message = 1864,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 701,
+            .n = 5,
+        },
+        .message = 48079,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 706,
+            .n = 2,
+        },
+        .message = 2014,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 708,
+            .n = 2,
+        },
+        .message = 48079,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 710,
+            .n = 2,
+        },
+        .message = 2014,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 712,
+            .n = 2,
+        },
+        .message = 9844,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 714,
+            .n = 2,
+        },
+        .message = 9844,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 716,
+            .n = 3,
+        },
+        .message = 2201,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 719,
+            .n = 3,
+        },
+        .message = 1278,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 722,
+            .n = 9,
+        },
+        .message = 2218,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 731,
+            .n = 6,
+        },
+        .message = 4089,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 737,
+            .n = 1,
+        },
+        .message = 1864,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 738,
+            .n = 2,
+        },
+        .message = 4089,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 740,
+            .n = 1,
+        },
+        .message = 48266,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 741,
+            .n = 1,
+        },
+        .message = 48396,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 742,
+            .n = 2,
+        },
+        .message = 1864,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 744,
+            .n = 1,
+        },
+        .message = 2991,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 745,
+            .n = 2,
+        },
+        .message = 2836,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 747,
+            .n = 2,
+        },
+        .message = 2836,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 749,
+            .n = 1,
+        },
+        .message = 48528,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 750,
+            .n = 1,
+        },
+        .message = 48563,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 751,
+            .n = 4,
+        },
+        .message = 3049,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 755,
+            .n = 1,
+        },
+        .message = 2991,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 756,
+            .n = 1,
+        },
+        .message = 7193,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 757,
+            .n = 1,
+        },
+        .message = 7193,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 758,
+            .n = 1,
+        },
+        .message = 7193,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 759,
+            .n = 1,
+        },
+        .message = 7193,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 760,
+            .n = 1,
+        },
+        .message = 7193,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 761,
+            .n = 1,
+        },
+        .message = 48640,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 762,
+            .n = 2,
+        },
+        .message = 9844,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 764,
+            .n = 3,
+        },
+        .message = 7157,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 767,
+            .n = 2,
+        },
+        .message = 4089,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 769,
+            .n = 3,
+        },
+        .message = 2991,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 772,
+            .n = 2,
+        },
+        .message = 2991,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 774,
+            .n = 1,
+        },
+        .message = 1278,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 775,
+            .n = 1,
+        },
+        .message = 9844,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 776,
+            .n = 1,
+        },
+        .message = 2201,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 777,
+            .n = 1,
+        },
+        .message = 48739,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 778,
+            .n = 1,
+        },
+        .message = 48760,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 0,
+            .n = 0,
+        },
+        .message = 2991,
+        .noaction = false,
+    },
+    {
+        .words = {
+            .strs = 779,
+            .n = 1,
+        },
+        .message = 48787,
+        .noaction = true,
+    },
+    {
+        .words = {
+            .strs = 780,
+            .n = 7,
+        },
+        .message = 48850,
+        .noaction = true,
+    },
+    {
+        .words = {
+            .strs = 787,
+            .n = 2,
+        },
+        .message = 48907,
+        .noaction = true,
+    },
+    {
+        .words = {
+            .strs = 789,
+            .n = 1,
+        },
+        .message = 2561,
+        .noaction = true,
+    },
+    {
+        .words = {
+            .strs = 790,
+            .n = 2,
+        },
+        .message = 50867,
+        .noaction = true,
+    },
+    {
+        .words = {
+            .strs = 792,
+            .n = 2,
+        },
+        .message = 51236,
+        .noaction = true,
+    },
+    {
+        .words = {
+            .strs = 794,
+            .n = 1,
+        },
+        .message = 51330,
+        .noaction = true,
+    },
+    {
+        .words = {
+            .strs = 795,
+            .n = 1,
+        },
+        .message = 51363,
+        .noaction = true,
+    },
+    {
+        .words = {
+            .strs = 796,
+            .n = 1,
+        },
+        .message = 51530,
+        .noaction = true,
+    },
+    {
+        .words = {
+            .strs = 797,
+            .n = 1,
+        },
+        .message = 51545,
+        .noaction = true,
+    },
+    {
+        .words = {
+            .strs = 798,
+            .n = 2,
+        },
+        .message = 51622,
+        .noaction = true,
+    },
+    {
+        .words = {
+            .strs = 800,
+            .n = 1,
+        },
+        .message = 7193,
+        .noaction = true,
+    },
+    {
+        .words = {
+            .strs = 801,
+            .n = 1,
+        },
+        .message = 53075,
+        .noaction = true,
+    },
+    {
+        .words = {
+            .strs = 802,
+            .n = 1,
+        },
+        .message = 53127,
+        .noaction = true,
+    },
+    {
+        .words = {
+            .strs = 803,
+            .n = 1,
+        },
+        .message = 53145,
+        .noaction = true,
+    },
+    {
+        .words = {
+            .strs = 804,
+            .n = 1,
+        },
+        .message = 53739,
+        .noaction = true,
+    },
+};
+
+const long tkey[] = {
+    0, 1, 16, 23, 30, 41, 49, 53, 68, 80,
+    89, 97, 110, 119, 127, 138, 154, 155, 164, 167,
+    180, 181, 182, 183, 190, 192, 196, 197, 206, 213,
+    216, 221, 223, 224, 232, 235, 238, 244, 249, 259,
+    265, 266, 274, 279, 282, 286, 292, 294, 296, 298,
+    300, 304, 308, 314, 317, 319, 323, 325, 331, 333,
+    334, 341, 344, 348, 350, 358, 370, 377, 382, 386,
+    392, 396, 399, 404, 407, 411, 413, 414, 418, 419,
+    420, 424, 426, 428, 431, 434, 436, 438, 440, 446,
+    447, 448, 453, 456, 459, 466, 470, 472, 478, 481,
+    486, 494, 497, 500, 506, 509, 512, 515, 525, 536,
+    539, 541, 547, 557, 563, 564, 565, 567, 576, 578,
+    582, 584, 588, 598, 603, 611, 617, 623, 628, 635,
+    643, 647, 657, 667, 677, 687, 697, 707, 717, 727,
+    737, 741, 743, 744, 747, 749, 753, 757, 761, 765,
+    769, 773, 777, 781, 785, 789, 793, 797, 801, 805,
+    809, 813, 817, 821, 825, 829, 833, 837, 838, 840,
+    847, 851, 855, 859, 862, 863, 864, 868, 871, 872,
+    873, 874, 875, 876, 877
+};
+
+const travelop_t travel[] = {
+    { // from 0: LOC_NOWHERE
+        .motion = 0,
+        .condtype = 0,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = 0,
+        .destval = 0,
+        .flags = 0,
+    },
+    { // from 1: LOC_START
+        .motion = MOT_2,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_HILL,
+        .flags = 0,
+    },
+    { // from 1: LOC_START
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_HILL,
+        .flags = 0,
+    },
+    { // from 1: LOC_START
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_HILL,
+        .flags = 0,
+    },
+    { // from 1: LOC_START
+        .motion = ENTER,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BUILDING,
+        .flags = 0,
+    },
+    { // from 1: LOC_START
+        .motion = MOT_12,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BUILDING,
+        .flags = 0,
+    },
+    { // from 1: LOC_START
+        .motion = INSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BUILDING,
+        .flags = 0,
+    },
+    { // from 1: LOC_START
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BUILDING,
+        .flags = 0,
+    },
+    { // from 1: LOC_START
+        .motion = MOT_5,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_VALLEY,
+        .flags = 0,
+    },
+    { // from 1: LOC_START
+        .motion = MOT_13,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_VALLEY,
+        .flags = 0,
+    },
+    { // from 1: LOC_START
+        .motion = STREAM,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_VALLEY,
+        .flags = 0,
+    },
+    { // from 1: LOC_START
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_VALLEY,
+        .flags = 0,
+    },
+    { // from 1: LOC_START
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_VALLEY,
+        .flags = 0,
+    },
+    { // from 1: LOC_START
+        .motion = MOT_6,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST1,
+        .flags = 0,
+    },
+    { // from 1: LOC_START
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST1,
+        .flags = 0,
+    },
+    { // from 1: LOC_START
+        .motion = DEPRESSION,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_GRATE,
+        .flags = TF_STOP,
+    },
+    { // from 2: LOC_HILL
+        .motion = MOT_12,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_START,
+        .flags = 0,
+    },
+    { // from 2: LOC_HILL
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_START,
+        .flags = 0,
+    },
+    { // from 2: LOC_HILL
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ROADEND,
+        .flags = 0,
+    },
+    { // from 2: LOC_HILL
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST20,
+        .flags = 0,
+    },
+    { // from 2: LOC_HILL
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST13,
+        .flags = 0,
+    },
+    { // from 2: LOC_HILL
+        .motion = MOT_6,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST13,
+        .flags = 0,
+    },
+    { // from 2: LOC_HILL
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = WHICH_WAY,
+        .flags = TF_STOP,
+    },
+    { // from 3: LOC_BUILDING
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_START,
+        .flags = 0,
+    },
+    { // from 3: LOC_BUILDING
+        .motion = MOT_32,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_START,
+        .flags = 0,
+    },
+    { // from 3: LOC_BUILDING
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_START,
+        .flags = 0,
+    },
+    { // from 3: LOC_BUILDING
+        .motion = XYZZY,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOOF1,
+        .flags = 0,
+    },
+    { // from 3: LOC_BUILDING
+        .motion = PLUGH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOOF3,
+        .flags = 0,
+    },
+    { // from 3: LOC_BUILDING
+        .motion = MOT_5,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SEWER,
+        .flags = 0,
+    },
+    { // from 3: LOC_BUILDING
+        .motion = STREAM,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SEWER,
+        .flags = TF_STOP,
+    },
+    { // from 4: LOC_VALLEY
+        .motion = MOT_4,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_START,
+        .flags = 0,
+    },
+    { // from 4: LOC_VALLEY
+        .motion = MOT_12,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_START,
+        .flags = 0,
+    },
+    { // from 4: LOC_VALLEY
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_START,
+        .flags = 0,
+    },
+    { // from 4: LOC_VALLEY
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST6,
+        .flags = 0,
+    },
+    { // from 4: LOC_VALLEY
+        .motion = MOT_6,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST6,
+        .flags = 0,
+    },
+    { // from 4: LOC_VALLEY
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST12,
+        .flags = 0,
+    },
+    { // from 4: LOC_VALLEY
+        .motion = MOT_5,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SLIT,
+        .flags = 0,
+    },
+    { // from 4: LOC_VALLEY
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SLIT,
+        .flags = 0,
+    },
+    { // from 4: LOC_VALLEY
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SLIT,
+        .flags = 0,
+    },
+    { // from 4: LOC_VALLEY
+        .motion = DEPRESSION,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_GRATE,
+        .flags = 0,
+    },
+    { // from 4: LOC_VALLEY
+        .motion = STREAM,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = UPSTREAM_DOWNSTREAM,
+        .flags = TF_STOP,
+    },
+    { // from 5: LOC_ROADEND
+        .motion = MOT_2,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_HILL,
+        .flags = 0,
+    },
+    { // from 5: LOC_ROADEND
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_HILL,
+        .flags = 0,
+    },
+    { // from 5: LOC_ROADEND
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_HILL,
+        .flags = 0,
+    },
+    { // from 5: LOC_ROADEND
+        .motion = MOT_12,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_START,
+        .flags = 0,
+    },
+    { // from 5: LOC_ROADEND
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST14,
+        .flags = 0,
+    },
+    { // from 5: LOC_ROADEND
+        .motion = MOT_6,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST14,
+        .flags = 0,
+    },
+    { // from 5: LOC_ROADEND
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST15,
+        .flags = 0,
+    },
+    { // from 5: LOC_ROADEND
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST21,
+        .flags = TF_STOP,
+    },
+    { // from 6: LOC_CLIFF
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST17,
+        .flags = 0,
+    },
+    { // from 6: LOC_CLIFF
+        .motion = MOT_6,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST17,
+        .flags = 0,
+    },
+    { // from 6: LOC_CLIFF
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST19,
+        .flags = 0,
+    },
+    { // from 6: LOC_CLIFF
+        .motion = MOT_39,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_NOMAKE,
+        .flags = TF_STOP,
+    },
+    { // from 7: LOC_SLIT
+        .motion = MOT_12,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_START,
+        .flags = 0,
+    },
+    { // from 7: LOC_SLIT
+        .motion = MOT_4,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_VALLEY,
+        .flags = 0,
+    },
+    { // from 7: LOC_SLIT
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_VALLEY,
+        .flags = 0,
+    },
+    { // from 7: LOC_SLIT
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST6,
+        .flags = 0,
+    },
+    { // from 7: LOC_SLIT
+        .motion = MOT_6,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST6,
+        .flags = 0,
+    },
+    { // from 7: LOC_SLIT
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST10,
+        .flags = 0,
+    },
+    { // from 7: LOC_SLIT
+        .motion = MOT_5,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_GRATE,
+        .flags = 0,
+    },
+    { // from 7: LOC_SLIT
+        .motion = MOT_16,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_GRATE,
+        .flags = 0,
+    },
+    { // from 7: LOC_SLIT
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_GRATE,
+        .flags = 0,
+    },
+    { // from 7: LOC_SLIT
+        .motion = DEPRESSION,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_GRATE,
+        .flags = 0,
+    },
+    { // from 7: LOC_SLIT
+        .motion = MOT_60,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = DONT_FIT,
+        .flags = 0,
+    },
+    { // from 7: LOC_SLIT
+        .motion = STREAM,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = DONT_FIT,
+        .flags = 0,
+    },
+    { // from 7: LOC_SLIT
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = DONT_FIT,
+        .flags = 0,
+    },
+    { // from 7: LOC_SLIT
+        .motion = INSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = DONT_FIT,
+        .flags = 0,
+    },
+    { // from 7: LOC_SLIT
+        .motion = ENTER,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = DONT_FIT,
+        .flags = TF_STOP,
+    },
+    { // from 8: LOC_GRATE
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST7,
+        .flags = 0,
+    },
+    { // from 8: LOC_GRATE
+        .motion = MOT_6,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST7,
+        .flags = 0,
+    },
+    { // from 8: LOC_GRATE
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST10,
+        .flags = 0,
+    },
+    { // from 8: LOC_GRATE
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST9,
+        .flags = 0,
+    },
+    { // from 8: LOC_GRATE
+        .motion = MOT_12,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_START,
+        .flags = 0,
+    },
+    { // from 8: LOC_GRATE
+        .motion = MOT_4,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SLIT,
+        .flags = 0,
+    },
+    { // from 8: LOC_GRATE
+        .motion = MOT_13,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SLIT,
+        .flags = 0,
+    },
+    { // from 8: LOC_GRATE
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SLIT,
+        .flags = 0,
+    },
+    { // from 8: LOC_GRATE
+        .motion = ENTER,
+        .condtype = cond_not,
+        .condarg1 = 3,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BELOWGRATE,
+        .flags = 0,
+    },
+    { // from 8: LOC_GRATE
+        .motion = INSIDE,
+        .condtype = cond_not,
+        .condarg1 = 3,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BELOWGRATE,
+        .flags = 0,
+    },
+    { // from 8: LOC_GRATE
+        .motion = DOWN,
+        .condtype = cond_not,
+        .condarg1 = 3,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BELOWGRATE,
+        .flags = 0,
+    },
+    { // from 8: LOC_GRATE
+        .motion = ENTER,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = GRATE_NOWAY,
+        .flags = TF_STOP,
+    },
+    { // from 9: LOC_BELOWGRATE
+        .motion = OUTSIDE,
+        .condtype = cond_not,
+        .condarg1 = 3,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_GRATE,
+        .flags = 0,
+    },
+    { // from 9: LOC_BELOWGRATE
+        .motion = UP,
+        .condtype = cond_not,
+        .condarg1 = 3,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_GRATE,
+        .flags = 0,
+    },
+    { // from 9: LOC_BELOWGRATE
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = GRATE_NOWAY,
+        .flags = 0,
+    },
+    { // from 9: LOC_BELOWGRATE
+        .motion = CRAWL,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_COBBLE,
+        .flags = 0,
+    },
+    { // from 9: LOC_BELOWGRATE
+        .motion = MOT_18,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_COBBLE,
+        .flags = 0,
+    },
+    { // from 9: LOC_BELOWGRATE
+        .motion = INSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_COBBLE,
+        .flags = 0,
+    },
+    { // from 9: LOC_BELOWGRATE
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_COBBLE,
+        .flags = 0,
+    },
+    { // from 9: LOC_BELOWGRATE
+        .motion = MOT_31,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_PITTOP,
+        .flags = 0,
+    },
+    { // from 9: LOC_BELOWGRATE
+        .motion = MOT_51,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEBRIS,
+        .flags = TF_STOP,
+    },
+    { // from 10: LOC_COBBLE
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BELOWGRATE,
+        .flags = 0,
+    },
+    { // from 10: LOC_COBBLE
+        .motion = MOT_20,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BELOWGRATE,
+        .flags = 0,
+    },
+    { // from 10: LOC_COBBLE
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BELOWGRATE,
+        .flags = 0,
+    },
+    { // from 10: LOC_COBBLE
+        .motion = INSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEBRIS,
+        .flags = 0,
+    },
+    { // from 10: LOC_COBBLE
+        .motion = MOT_22,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEBRIS,
+        .flags = 0,
+    },
+    { // from 10: LOC_COBBLE
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEBRIS,
+        .flags = 0,
+    },
+    { // from 10: LOC_COBBLE
+        .motion = MOT_51,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEBRIS,
+        .flags = 0,
+    },
+    { // from 10: LOC_COBBLE
+        .motion = MOT_31,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_PITTOP,
+        .flags = TF_STOP,
+    },
+    { // from 11: LOC_DEBRIS
+        .motion = DEPRESSION,
+        .condtype = cond_not,
+        .condarg1 = 3,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_GRATE,
+        .flags = 0,
+    },
+    { // from 11: LOC_DEBRIS
+        .motion = ENTRANCE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BELOWGRATE,
+        .flags = 0,
+    },
+    { // from 11: LOC_DEBRIS
+        .motion = CRAWL,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_COBBLE,
+        .flags = 0,
+    },
+    { // from 11: LOC_DEBRIS
+        .motion = MOT_18,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_COBBLE,
+        .flags = 0,
+    },
+    { // from 11: LOC_DEBRIS
+        .motion = MOT_23,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_COBBLE,
+        .flags = 0,
+    },
+    { // from 11: LOC_DEBRIS
+        .motion = MOT_24,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_COBBLE,
+        .flags = 0,
+    },
+    { // from 11: LOC_DEBRIS
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_COBBLE,
+        .flags = 0,
+    },
+    { // from 11: LOC_DEBRIS
+        .motion = MOT_25,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_AWKWARD,
+        .flags = 0,
+    },
+    { // from 11: LOC_DEBRIS
+        .motion = INSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_AWKWARD,
+        .flags = 0,
+    },
+    { // from 11: LOC_DEBRIS
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_AWKWARD,
+        .flags = 0,
+    },
+    { // from 11: LOC_DEBRIS
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_AWKWARD,
+        .flags = 0,
+    },
+    { // from 11: LOC_DEBRIS
+        .motion = XYZZY,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOOF2,
+        .flags = 0,
+    },
+    { // from 11: LOC_DEBRIS
+        .motion = MOT_31,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_PITTOP,
+        .flags = TF_STOP,
+    },
+    { // from 12: LOC_AWKWARD
+        .motion = DEPRESSION,
+        .condtype = cond_not,
+        .condarg1 = 3,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_GRATE,
+        .flags = 0,
+    },
+    { // from 12: LOC_AWKWARD
+        .motion = ENTRANCE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BELOWGRATE,
+        .flags = 0,
+    },
+    { // from 12: LOC_AWKWARD
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEBRIS,
+        .flags = 0,
+    },
+    { // from 12: LOC_AWKWARD
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEBRIS,
+        .flags = 0,
+    },
+    { // from 12: LOC_AWKWARD
+        .motion = MOT_51,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEBRIS,
+        .flags = 0,
+    },
+    { // from 12: LOC_AWKWARD
+        .motion = INSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BIRD,
+        .flags = 0,
+    },
+    { // from 12: LOC_AWKWARD
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BIRD,
+        .flags = 0,
+    },
+    { // from 12: LOC_AWKWARD
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BIRD,
+        .flags = 0,
+    },
+    { // from 12: LOC_AWKWARD
+        .motion = MOT_31,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_PITTOP,
+        .flags = TF_STOP,
+    },
+    { // from 13: LOC_BIRD
+        .motion = DEPRESSION,
+        .condtype = cond_not,
+        .condarg1 = 3,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_GRATE,
+        .flags = 0,
+    },
+    { // from 13: LOC_BIRD
+        .motion = ENTRANCE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BELOWGRATE,
+        .flags = 0,
+    },
+    { // from 13: LOC_BIRD
+        .motion = MOT_51,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEBRIS,
+        .flags = 0,
+    },
+    { // from 13: LOC_BIRD
+        .motion = MOT_25,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_AWKWARD,
+        .flags = 0,
+    },
+    { // from 13: LOC_BIRD
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_AWKWARD,
+        .flags = 0,
+    },
+    { // from 13: LOC_BIRD
+        .motion = MOT_23,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_PITTOP,
+        .flags = 0,
+    },
+    { // from 13: LOC_BIRD
+        .motion = MOT_31,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_PITTOP,
+        .flags = 0,
+    },
+    { // from 13: LOC_BIRD
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_PITTOP,
+        .flags = TF_STOP,
+    },
+    { // from 14: LOC_PITTOP
+        .motion = DEPRESSION,
+        .condtype = cond_not,
+        .condarg1 = 3,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_GRATE,
+        .flags = 0,
+    },
+    { // from 14: LOC_PITTOP
+        .motion = ENTRANCE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BELOWGRATE,
+        .flags = 0,
+    },
+    { // from 14: LOC_PITTOP
+        .motion = MOT_51,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEBRIS,
+        .flags = 0,
+    },
+    { // from 14: LOC_PITTOP
+        .motion = MOT_23,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BIRD,
+        .flags = 0,
+    },
+    { // from 14: LOC_PITTOP
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BIRD,
+        .flags = 0,
+    },
+    { // from 14: LOC_PITTOP
+        .motion = DOWN,
+        .condtype = cond_carry,
+        .condarg1 = NUGGET,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_NECKBROKE,
+        .flags = 0,
+    },
+    { // from 14: LOC_PITTOP
+        .motion = MOT_31,
+        .condtype = cond_carry,
+        .condarg1 = NUGGET,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_NECKBROKE,
+        .flags = 0,
+    },
+    { // from 14: LOC_PITTOP
+        .motion = MOT_34,
+        .condtype = cond_carry,
+        .condarg1 = NUGGET,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_NECKBROKE,
+        .flags = 0,
+    },
+    { // from 14: LOC_PITTOP
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_MISTHALL,
+        .flags = 0,
+    },
+    { // from 14: LOC_PITTOP
+        .motion = MOT_33,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CRACK,
+        .flags = 0,
+    },
+    { // from 14: LOC_PITTOP
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CRACK,
+        .flags = TF_STOP,
+    },
+    { // from 15: LOC_MISTHALL
+        .motion = LEFT,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_NUGGET,
+        .flags = 0,
+    },
+    { // from 15: LOC_MISTHALL
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_NUGGET,
+        .flags = 0,
+    },
+    { // from 15: LOC_MISTHALL
+        .motion = FORWARD,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_EASTBANK,
+        .flags = 0,
+    },
+    { // from 15: LOC_MISTHALL
+        .motion = MOT_38,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_EASTBANK,
+        .flags = 0,
+    },
+    { // from 15: LOC_MISTHALL
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_EASTBANK,
+        .flags = 0,
+    },
+    { // from 15: LOC_MISTHALL
+        .motion = MOT_10,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_KINGHALL,
+        .flags = 0,
+    },
+    { // from 15: LOC_MISTHALL
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_KINGHALL,
+        .flags = 0,
+    },
+    { // from 15: LOC_MISTHALL
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_KINGHALL,
+        .flags = 0,
+    },
+    { // from 15: LOC_MISTHALL
+        .motion = UP,
+        .condtype = cond_carry,
+        .condarg1 = NUGGET,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DOME,
+        .flags = 0,
+    },
+    { // from 15: LOC_MISTHALL
+        .motion = MOT_31,
+        .condtype = cond_carry,
+        .condarg1 = NUGGET,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DOME,
+        .flags = 0,
+    },
+    { // from 15: LOC_MISTHALL
+        .motion = MOT_34,
+        .condtype = cond_carry,
+        .condarg1 = NUGGET,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DOME,
+        .flags = 0,
+    },
+    { // from 15: LOC_MISTHALL
+        .motion = MOT_35,
+        .condtype = cond_carry,
+        .condarg1 = NUGGET,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DOME,
+        .flags = 0,
+    },
+    { // from 15: LOC_MISTHALL
+        .motion = MOT_23,
+        .condtype = cond_carry,
+        .condarg1 = NUGGET,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DOME,
+        .flags = 0,
+    },
+    { // from 15: LOC_MISTHALL
+        .motion = EAST,
+        .condtype = cond_carry,
+        .condarg1 = NUGGET,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DOME,
+        .flags = 0,
+    },
+    { // from 15: LOC_MISTHALL
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_PITTOP,
+        .flags = 0,
+    },
+    { // from 15: LOC_MISTHALL
+        .motion = MOT_55,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_JUMBLE,
+        .flags = TF_STOP,
+    },
+    { // from 16: LOC_CRACK
+        .motion = 1,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_PITTOP,
+        .flags = TF_STOP,
+    },
+    { // from 17: LOC_EASTBANK
+        .motion = MOT_38,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_MISTHALL,
+        .flags = 0,
+    },
+    { // from 17: LOC_EASTBANK
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_MISTHALL,
+        .flags = 0,
+    },
+    { // from 17: LOC_EASTBANK
+        .motion = MOT_39,
+        .condtype = cond_not,
+        .condarg1 = 12,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = CROSS_BRIDGE,
+        .flags = 0,
+    },
+    { // from 17: LOC_EASTBANK
+        .motion = FORWARD,
+        .condtype = cond_not,
+        .condarg1 = 12,
+        .condarg2 = 1,
+        .desttype = dest_goto,
+        .destval = LOC_NOMAKE,
+        .flags = 0,
+    },
+    { // from 17: LOC_EASTBANK
+        .motion = MOT_41,
+        .condtype = cond_not,
+        .condarg1 = 12,
+        .condarg2 = 1,
+        .desttype = dest_speak,
+        .destval = NO_CROSS,
+        .flags = 0,
+    },
+    { // from 17: LOC_EASTBANK
+        .motion = MOT_42,
+        .condtype = cond_not,
+        .condarg1 = 12,
+        .condarg2 = 1,
+        .desttype = dest_speak,
+        .destval = NO_CROSS,
+        .flags = 0,
+    },
+    { // from 17: LOC_EASTBANK
+        .motion = WEST,
+        .condtype = cond_not,
+        .condarg1 = 12,
+        .condarg2 = 1,
+        .desttype = dest_speak,
+        .destval = NO_CROSS,
+        .flags = 0,
+    },
+    { // from 17: LOC_EASTBANK
+        .motion = CROSS,
+        .condtype = cond_not,
+        .condarg1 = 12,
+        .condarg2 = 1,
+        .desttype = dest_speak,
+        .destval = NO_CROSS,
+        .flags = 0,
+    },
+    { // from 17: LOC_EASTBANK
+        .motion = MOT_41,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WESTBANK,
+        .flags = TF_STOP,
+    },
+    { // from 18: LOC_NUGGET
+        .motion = MOT_38,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_MISTHALL,
+        .flags = 0,
+    },
+    { // from 18: LOC_NUGGET
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_MISTHALL,
+        .flags = 0,
+    },
+    { // from 18: LOC_NUGGET
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_MISTHALL,
+        .flags = TF_STOP,
+    },
+    { // from 19: LOC_KINGHALL
+        .motion = MOT_10,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_MISTHALL,
+        .flags = 0,
+    },
+    { // from 19: LOC_KINGHALL
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_MISTHALL,
+        .flags = 0,
+    },
+    { // from 19: LOC_KINGHALL
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_MISTHALL,
+        .flags = 0,
+    },
+    { // from 19: LOC_KINGHALL
+        .motion = NORTH,
+        .condtype = cond_not,
+        .condarg1 = 11,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FLOORHOLE,
+        .flags = 0,
+    },
+    { // from 19: LOC_KINGHALL
+        .motion = RIGHT,
+        .condtype = cond_not,
+        .condarg1 = 11,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FLOORHOLE,
+        .flags = 0,
+    },
+    { // from 19: LOC_KINGHALL
+        .motion = SOUTH,
+        .condtype = cond_not,
+        .condarg1 = 11,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SOUTHSIDE,
+        .flags = 0,
+    },
+    { // from 19: LOC_KINGHALL
+        .motion = LEFT,
+        .condtype = cond_not,
+        .condarg1 = 11,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SOUTHSIDE,
+        .flags = 0,
+    },
+    { // from 19: LOC_KINGHALL
+        .motion = WEST,
+        .condtype = cond_not,
+        .condarg1 = 11,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WESTSIDE,
+        .flags = 0,
+    },
+    { // from 19: LOC_KINGHALL
+        .motion = FORWARD,
+        .condtype = cond_not,
+        .condarg1 = 11,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WESTSIDE,
+        .flags = 0,
+    },
+    { // from 19: LOC_KINGHALL
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SNAKEBLOCK,
+        .flags = 0,
+    },
+    { // from 19: LOC_KINGHALL
+        .motion = SW,
+        .condtype = cond_pct,
+        .condarg1 = 35,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SECRET3,
+        .flags = 0,
+    },
+    { // from 19: LOC_KINGHALL
+        .motion = SW,
+        .condtype = cond_with,
+        .condarg1 = SNAKE,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SNAKEBLOCK,
+        .flags = 0,
+    },
+    { // from 19: LOC_KINGHALL
+        .motion = MOT_66,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SECRET3,
+        .flags = TF_STOP,
+    },
+    { // from 20: LOC_NECKBROKE
+        .motion = 1,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_NOWHERE,
+        .flags = TF_STOP,
+    },
+    { // from 21: LOC_NOMAKE
+        .motion = 1,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_NOWHERE,
+        .flags = TF_STOP,
+    },
+    { // from 22: LOC_DOME
+        .motion = 1,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_MISTHALL,
+        .flags = TF_STOP,
+    },
+    { // from 23: LOC_WESTEND
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_EASTEND,
+        .flags = 0,
+    },
+    { // from 23: LOC_WESTEND
+        .motion = MOT_42,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_EASTEND,
+        .flags = 0,
+    },
+    { // from 23: LOC_WESTEND
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SLAB,
+        .flags = 0,
+    },
+    { // from 23: LOC_WESTEND
+        .motion = MOT_61,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SLAB,
+        .flags = 0,
+    },
+    { // from 23: LOC_WESTEND
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WESTPIT,
+        .flags = 0,
+    },
+    { // from 23: LOC_WESTEND
+        .motion = MOT_31,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WESTPIT,
+        .flags = 0,
+    },
+    { // from 23: LOC_WESTEND
+        .motion = MOT_52,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = TOO_FAR,
+        .flags = TF_STOP,
+    },
+    { // from 24: LOC_EASTPIT
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_EASTEND,
+        .flags = 0,
+    },
+    { // from 24: LOC_EASTPIT
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_EASTEND,
+        .flags = TF_STOP,
+    },
+    { // from 25: LOC_WESTPIT
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WESTEND,
+        .flags = 0,
+    },
+    { // from 25: LOC_WESTPIT
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WESTEND,
+        .flags = 0,
+    },
+    { // from 25: LOC_WESTPIT
+        .motion = MOT_56,
+        .condtype = cond_not,
+        .condarg1 = 24,
+        .condarg2 = 2,
+        .desttype = dest_goto,
+        .destval = LOC_BUILDING1,
+        .flags = 0,
+    },
+    { // from 25: LOC_WESTPIT
+        .motion = MOT_56,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CLIMBSTALK,
+        .flags = TF_STOP,
+    },
+    { // from 26: LOC_CLIMBSTALK
+        .motion = 1,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_NARROW,
+        .flags = TF_STOP,
+    },
+    { // from 27: LOC_WESTBANK
+        .motion = MOT_39,
+        .condtype = cond_not,
+        .condarg1 = 12,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = CROSS_BRIDGE,
+        .flags = 0,
+    },
+    { // from 27: LOC_WESTBANK
+        .motion = FORWARD,
+        .condtype = cond_not,
+        .condarg1 = 12,
+        .condarg2 = 1,
+        .desttype = dest_goto,
+        .destval = LOC_NOMAKE,
+        .flags = 0,
+    },
+    { // from 27: LOC_WESTBANK
+        .motion = MOT_41,
+        .condtype = cond_not,
+        .condarg1 = 12,
+        .condarg2 = 1,
+        .desttype = dest_speak,
+        .destval = NO_CROSS,
+        .flags = 0,
+    },
+    { // from 27: LOC_WESTBANK
+        .motion = MOT_42,
+        .condtype = cond_not,
+        .condarg1 = 12,
+        .condarg2 = 1,
+        .desttype = dest_speak,
+        .destval = NO_CROSS,
+        .flags = 0,
+    },
+    { // from 27: LOC_WESTBANK
+        .motion = EAST,
+        .condtype = cond_not,
+        .condarg1 = 12,
+        .condarg2 = 1,
+        .desttype = dest_speak,
+        .destval = NO_CROSS,
+        .flags = 0,
+    },
+    { // from 27: LOC_WESTBANK
+        .motion = CROSS,
+        .condtype = cond_not,
+        .condarg1 = 12,
+        .condarg2 = 1,
+        .desttype = dest_speak,
+        .destval = NO_CROSS,
+        .flags = 0,
+    },
+    { // from 27: LOC_WESTBANK
+        .motion = MOT_41,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_EASTBANK,
+        .flags = 0,
+    },
+    { // from 27: LOC_WESTBANK
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_PARALLEL1,
+        .flags = 0,
+    },
+    { // from 27: LOC_WESTBANK
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_MISTWEST,
+        .flags = TF_STOP,
+    },
+    { // from 28: LOC_FLOORHOLE
+        .motion = MOT_38,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_KINGHALL,
+        .flags = 0,
+    },
+    { // from 28: LOC_FLOORHOLE
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_KINGHALL,
+        .flags = 0,
+    },
+    { // from 28: LOC_FLOORHOLE
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_KINGHALL,
+        .flags = 0,
+    },
+    { // from 28: LOC_FLOORHOLE
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_Y2,
+        .flags = 0,
+    },
+    { // from 28: LOC_FLOORHOLE
+        .motion = MOT_55,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_Y2,
+        .flags = 0,
+    },
+    { // from 28: LOC_FLOORHOLE
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BROKEN,
+        .flags = 0,
+    },
+    { // from 28: LOC_FLOORHOLE
+        .motion = MOT_52,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BROKEN,
+        .flags = TF_STOP,
+    },
+    { // from 29: LOC_SOUTHSIDE
+        .motion = MOT_38,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_KINGHALL,
+        .flags = 0,
+    },
+    { // from 29: LOC_SOUTHSIDE
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_KINGHALL,
+        .flags = 0,
+    },
+    { // from 29: LOC_SOUTHSIDE
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_KINGHALL,
+        .flags = TF_STOP,
+    },
+    { // from 30: LOC_WESTSIDE
+        .motion = MOT_38,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_KINGHALL,
+        .flags = 0,
+    },
+    { // from 30: LOC_WESTSIDE
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_KINGHALL,
+        .flags = 0,
+    },
+    { // from 30: LOC_WESTSIDE
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_KINGHALL,
+        .flags = 0,
+    },
+    { // from 30: LOC_WESTSIDE
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CROSSOVER,
+        .flags = 0,
+    },
+    { // from 30: LOC_WESTSIDE
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CROSSOVER,
+        .flags = TF_STOP,
+    },
+    { // from 31: LOC_BUILDING1
+        .motion = 1,
+        .condtype = cond_not,
+        .condarg1 = 24,
+        .condarg2 = 1,
+        .desttype = dest_goto,
+        .destval = LOC_NOCLIMB,
+        .flags = 0,
+    },
+    { // from 31: LOC_BUILDING1
+        .motion = 1,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_PLANTTOP,
+        .flags = TF_STOP,
+    },
+    { // from 32: LOC_SNAKEBLOCK
+        .motion = 1,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_KINGHALL,
+        .flags = TF_STOP,
+    },
+    { // from 33: LOC_Y2
+        .motion = PLUGH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOOF4,
+        .flags = 0,
+    },
+    { // from 33: LOC_Y2
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FLOORHOLE,
+        .flags = 0,
+    },
+    { // from 33: LOC_Y2
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_JUMBLE,
+        .flags = 0,
+    },
+    { // from 33: LOC_Y2
+        .motion = MOT_53,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_JUMBLE,
+        .flags = 0,
+    },
+    { // from 33: LOC_Y2
+        .motion = MOT_54,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_JUMBLE,
+        .flags = 0,
+    },
+    { // from 33: LOC_Y2
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WINDOW1,
+        .flags = 0,
+    },
+    { // from 33: LOC_Y2
+        .motion = PLOVER,
+        .condtype = cond_carry,
+        .condarg1 = EMERALD,
+        .condarg2 = 0,
+        .desttype = dest_special,
+        .destval = LOC_HILL,
+        .flags = 0,
+    },
+    { // from 33: LOC_Y2
+        .motion = PLOVER,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOOF5,
+        .flags = TF_STOP,
+    },
+    { // from 34: LOC_JUMBLE
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_Y2,
+        .flags = 0,
+    },
+    { // from 34: LOC_JUMBLE
+        .motion = MOT_55,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_Y2,
+        .flags = 0,
+    },
+    { // from 34: LOC_JUMBLE
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_MISTHALL,
+        .flags = TF_STOP,
+    },
+    { // from 35: LOC_WINDOW1
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_Y2,
+        .flags = 0,
+    },
+    { // from 35: LOC_WINDOW1
+        .motion = MOT_55,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_Y2,
+        .flags = 0,
+    },
+    { // from 35: LOC_WINDOW1
+        .motion = MOT_39,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_NECKBROKE,
+        .flags = TF_STOP,
+    },
+    { // from 36: LOC_BROKEN
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SMALLPITBRINK,
+        .flags = 0,
+    },
+    { // from 36: LOC_BROKEN
+        .motion = CRAWL,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SMALLPITBRINK,
+        .flags = 0,
+    },
+    { // from 36: LOC_BROKEN
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FLOORHOLE,
+        .flags = 0,
+    },
+    { // from 36: LOC_BROKEN
+        .motion = MOT_52,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FLOORHOLE,
+        .flags = 0,
+    },
+    { // from 36: LOC_BROKEN
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DUSTY,
+        .flags = 0,
+    },
+    { // from 36: LOC_BROKEN
+        .motion = BEDQUILT,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BEDQUILT,
+        .flags = TF_STOP,
+    },
+    { // from 37: LOC_SMALLPITBRINK
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BROKEN,
+        .flags = 0,
+    },
+    { // from 37: LOC_SMALLPITBRINK
+        .motion = CRAWL,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BROKEN,
+        .flags = 0,
+    },
+    { // from 37: LOC_SMALLPITBRINK
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SMALLPIT,
+        .flags = 0,
+    },
+    { // from 37: LOC_SMALLPITBRINK
+        .motion = MOT_31,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SMALLPIT,
+        .flags = 0,
+    },
+    { // from 37: LOC_SMALLPITBRINK
+        .motion = MOT_56,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SMALLPIT,
+        .flags = TF_STOP,
+    },
+    { // from 38: LOC_SMALLPIT
+        .motion = MOT_56,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SMALLPITBRINK,
+        .flags = 0,
+    },
+    { // from 38: LOC_SMALLPIT
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SMALLPITBRINK,
+        .flags = 0,
+    },
+    { // from 38: LOC_SMALLPIT
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SMALLPITBRINK,
+        .flags = 0,
+    },
+    { // from 38: LOC_SMALLPIT
+        .motion = MOT_60,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = DONT_FIT,
+        .flags = 0,
+    },
+    { // from 38: LOC_SMALLPIT
+        .motion = STREAM,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = DONT_FIT,
+        .flags = 0,
+    },
+    { // from 38: LOC_SMALLPIT
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = DONT_FIT,
+        .flags = 0,
+    },
+    { // from 38: LOC_SMALLPIT
+        .motion = MOT_4,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = DONT_FIT,
+        .flags = 0,
+    },
+    { // from 38: LOC_SMALLPIT
+        .motion = MOT_5,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = DONT_FIT,
+        .flags = 0,
+    },
+    { // from 38: LOC_SMALLPIT
+        .motion = ENTER,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = DONT_FIT,
+        .flags = 0,
+    },
+    { // from 38: LOC_SMALLPIT
+        .motion = INSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = DONT_FIT,
+        .flags = TF_STOP,
+    },
+    { // from 39: LOC_DUSTY
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BROKEN,
+        .flags = 0,
+    },
+    { // from 39: LOC_DUSTY
+        .motion = MOT_23,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BROKEN,
+        .flags = 0,
+    },
+    { // from 39: LOC_DUSTY
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_COMPLEX,
+        .flags = 0,
+    },
+    { // from 39: LOC_DUSTY
+        .motion = MOT_52,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_COMPLEX,
+        .flags = 0,
+    },
+    { // from 39: LOC_DUSTY
+        .motion = MOT_58,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_COMPLEX,
+        .flags = 0,
+    },
+    { // from 39: LOC_DUSTY
+        .motion = BEDQUILT,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BEDQUILT,
+        .flags = TF_STOP,
+    },
+    { // from 40: LOC_PARALLEL1
+        .motion = 1,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_MISTWEST,
+        .flags = TF_STOP,
+    },
+    { // from 41: LOC_MISTWEST
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE1,
+        .flags = 0,
+    },
+    { // from 41: LOC_MISTWEST
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE1,
+        .flags = 0,
+    },
+    { // from 41: LOC_MISTWEST
+        .motion = MOT_23,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE1,
+        .flags = 0,
+    },
+    { // from 41: LOC_MISTWEST
+        .motion = MOT_56,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE1,
+        .flags = 0,
+    },
+    { // from 41: LOC_MISTWEST
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WESTBANK,
+        .flags = 0,
+    },
+    { // from 41: LOC_MISTWEST
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_PARALLEL2,
+        .flags = 0,
+    },
+    { // from 41: LOC_MISTWEST
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_LONGEAST,
+        .flags = 0,
+    },
+    { // from 41: LOC_MISTWEST
+        .motion = CRAWL,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_LONGEAST,
+        .flags = TF_STOP,
+    },
+    { // from 42: LOC_ALIKE1
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_MISTWEST,
+        .flags = 0,
+    },
+    { // from 42: LOC_ALIKE1
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE1,
+        .flags = 0,
+    },
+    { // from 42: LOC_ALIKE1
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE2,
+        .flags = 0,
+    },
+    { // from 42: LOC_ALIKE1
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE4,
+        .flags = 0,
+    },
+    { // from 42: LOC_ALIKE1
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE11,
+        .flags = TF_STOP,
+    },
+    { // from 43: LOC_ALIKE2
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE1,
+        .flags = 0,
+    },
+    { // from 43: LOC_ALIKE2
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE3,
+        .flags = 0,
+    },
+    { // from 43: LOC_ALIKE2
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE4,
+        .flags = TF_STOP,
+    },
+    { // from 44: LOC_ALIKE3
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE2,
+        .flags = 0,
+    },
+    { // from 44: LOC_ALIKE3
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEADEND3,
+        .flags = 0,
+    },
+    { // from 44: LOC_ALIKE3
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE6,
+        .flags = 0,
+    },
+    { // from 44: LOC_ALIKE3
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEADEND9,
+        .flags = TF_STOP,
+    },
+    { // from 45: LOC_ALIKE4
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE1,
+        .flags = 0,
+    },
+    { // from 45: LOC_ALIKE4
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE2,
+        .flags = 0,
+    },
+    { // from 45: LOC_ALIKE4
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEADEND1,
+        .flags = 0,
+    },
+    { // from 45: LOC_ALIKE4
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEADEND2,
+        .flags = 0,
+    },
+    { // from 45: LOC_ALIKE4
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE14,
+        .flags = 0,
+    },
+    { // from 45: LOC_ALIKE4
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE14,
+        .flags = TF_STOP,
+    },
+    { // from 46: LOC_DEADEND1
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE4,
+        .flags = 0,
+    },
+    { // from 46: LOC_DEADEND1
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE4,
+        .flags = TF_STOP,
+    },
+    { // from 47: LOC_DEADEND2
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE4,
+        .flags = 0,
+    },
+    { // from 47: LOC_DEADEND2
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE4,
+        .flags = TF_STOP,
+    },
+    { // from 48: LOC_DEADEND3
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE3,
+        .flags = 0,
+    },
+    { // from 48: LOC_DEADEND3
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE3,
+        .flags = TF_STOP,
+    },
+    { // from 49: LOC_ALIKE5
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE6,
+        .flags = 0,
+    },
+    { // from 49: LOC_ALIKE5
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE7,
+        .flags = TF_STOP,
+    },
+    { // from 50: LOC_ALIKE6
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE3,
+        .flags = 0,
+    },
+    { // from 50: LOC_ALIKE6
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE5,
+        .flags = 0,
+    },
+    { // from 50: LOC_ALIKE6
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE7,
+        .flags = 0,
+    },
+    { // from 50: LOC_ALIKE6
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE8,
+        .flags = TF_STOP,
+    },
+    { // from 51: LOC_ALIKE7
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE5,
+        .flags = 0,
+    },
+    { // from 51: LOC_ALIKE7
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE6,
+        .flags = 0,
+    },
+    { // from 51: LOC_ALIKE7
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE8,
+        .flags = 0,
+    },
+    { // from 51: LOC_ALIKE7
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE9,
+        .flags = TF_STOP,
+    },
+    { // from 52: LOC_ALIKE8
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE6,
+        .flags = 0,
+    },
+    { // from 52: LOC_ALIKE8
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE7,
+        .flags = 0,
+    },
+    { // from 52: LOC_ALIKE8
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE8,
+        .flags = 0,
+    },
+    { // from 52: LOC_ALIKE8
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE9,
+        .flags = 0,
+    },
+    { // from 52: LOC_ALIKE8
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE10,
+        .flags = 0,
+    },
+    { // from 52: LOC_ALIKE8
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEADEND11,
+        .flags = TF_STOP,
+    },
+    { // from 53: LOC_ALIKE9
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE7,
+        .flags = 0,
+    },
+    { // from 53: LOC_ALIKE9
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE8,
+        .flags = 0,
+    },
+    { // from 53: LOC_ALIKE9
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEADEND4,
+        .flags = TF_STOP,
+    },
+    { // from 54: LOC_DEADEND4
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE9,
+        .flags = 0,
+    },
+    { // from 54: LOC_DEADEND4
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE9,
+        .flags = TF_STOP,
+    },
+    { // from 55: LOC_ALIKE10
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE8,
+        .flags = 0,
+    },
+    { // from 55: LOC_ALIKE10
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE10,
+        .flags = 0,
+    },
+    { // from 55: LOC_ALIKE10
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEADEND5,
+        .flags = 0,
+    },
+    { // from 55: LOC_ALIKE10
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_PITBRINK,
+        .flags = TF_STOP,
+    },
+    { // from 56: LOC_DEADEND5
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE10,
+        .flags = 0,
+    },
+    { // from 56: LOC_DEADEND5
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE10,
+        .flags = TF_STOP,
+    },
+    { // from 57: LOC_PITBRINK
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BIRD,
+        .flags = 0,
+    },
+    { // from 57: LOC_PITBRINK
+        .motion = MOT_56,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BIRD,
+        .flags = 0,
+    },
+    { // from 57: LOC_PITBRINK
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE10,
+        .flags = 0,
+    },
+    { // from 57: LOC_PITBRINK
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEADEND6,
+        .flags = 0,
+    },
+    { // from 57: LOC_PITBRINK
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE12,
+        .flags = 0,
+    },
+    { // from 57: LOC_PITBRINK
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE13,
+        .flags = TF_STOP,
+    },
+    { // from 58: LOC_DEADEND6
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_PITBRINK,
+        .flags = 0,
+    },
+    { // from 58: LOC_DEADEND6
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_PITBRINK,
+        .flags = TF_STOP,
+    },
+    { // from 59: LOC_PARALLEL2
+        .motion = 1,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WESTBANK,
+        .flags = TF_STOP,
+    },
+    { // from 60: LOC_LONGEAST
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_MISTWEST,
+        .flags = 0,
+    },
+    { // from 60: LOC_LONGEAST
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_MISTWEST,
+        .flags = 0,
+    },
+    { // from 60: LOC_LONGEAST
+        .motion = CRAWL,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_MISTWEST,
+        .flags = 0,
+    },
+    { // from 60: LOC_LONGEAST
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_LONGWEST,
+        .flags = 0,
+    },
+    { // from 60: LOC_LONGEAST
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CROSSOVER,
+        .flags = 0,
+    },
+    { // from 60: LOC_LONGEAST
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CROSSOVER,
+        .flags = 0,
+    },
+    { // from 60: LOC_LONGEAST
+        .motion = MOT_52,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CROSSOVER,
+        .flags = TF_STOP,
+    },
+    { // from 61: LOC_LONGWEST
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_LONGEAST,
+        .flags = 0,
+    },
+    { // from 61: LOC_LONGWEST
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CROSSOVER,
+        .flags = 0,
+    },
+    { // from 61: LOC_LONGWEST
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 100,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT1,
+        .flags = TF_NODWARVES | TF_STOP,
+    },
+    { // from 62: LOC_CROSSOVER
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_LONGEAST,
+        .flags = 0,
+    },
+    { // from 62: LOC_CROSSOVER
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEADEND7,
+        .flags = 0,
+    },
+    { // from 62: LOC_CROSSOVER
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WESTSIDE,
+        .flags = 0,
+    },
+    { // from 62: LOC_CROSSOVER
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_LONGWEST,
+        .flags = TF_STOP,
+    },
+    { // from 63: LOC_DEADEND7
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CROSSOVER,
+        .flags = 0,
+    },
+    { // from 63: LOC_DEADEND7
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CROSSOVER,
+        .flags = TF_STOP,
+    },
+    { // from 64: LOC_COMPLEX
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DUSTY,
+        .flags = 0,
+    },
+    { // from 64: LOC_COMPLEX
+        .motion = MOT_56,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DUSTY,
+        .flags = 0,
+    },
+    { // from 64: LOC_COMPLEX
+        .motion = MOT_59,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DUSTY,
+        .flags = 0,
+    },
+    { // from 64: LOC_COMPLEX
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BEDQUILT,
+        .flags = 0,
+    },
+    { // from 64: LOC_COMPLEX
+        .motion = BEDQUILT,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BEDQUILT,
+        .flags = 0,
+    },
+    { // from 64: LOC_COMPLEX
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SHELLROOM,
+        .flags = 0,
+    },
+    { // from 64: LOC_COMPLEX
+        .motion = SHELLROOM,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SHELLROOM,
+        .flags = 0,
+    },
+    { // from 64: LOC_COMPLEX
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ANTEROOM,
+        .flags = TF_STOP,
+    },
+    { // from 65: LOC_BEDQUILT
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_COMPLEX,
+        .flags = 0,
+    },
+    { // from 65: LOC_BEDQUILT
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SWISSCHEESE,
+        .flags = 0,
+    },
+    { // from 65: LOC_BEDQUILT
+        .motion = SOUTH,
+        .condtype = cond_pct,
+        .condarg1 = 65,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = FUTILE_CRAWL,
+        .flags = 0,
+    },
+    { // from 65: LOC_BEDQUILT
+        .motion = MOT_61,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SLAB,
+        .flags = 0,
+    },
+    { // from 65: LOC_BEDQUILT
+        .motion = UP,
+        .condtype = cond_pct,
+        .condarg1 = 60,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = FUTILE_CRAWL,
+        .flags = 0,
+    },
+    { // from 65: LOC_BEDQUILT
+        .motion = UP,
+        .condtype = cond_pct,
+        .condarg1 = 70,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SECRET2,
+        .flags = 0,
+    },
+    { // from 65: LOC_BEDQUILT
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DUSTY,
+        .flags = 0,
+    },
+    { // from 65: LOC_BEDQUILT
+        .motion = NORTH,
+        .condtype = cond_pct,
+        .condarg1 = 50,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = FUTILE_CRAWL,
+        .flags = 0,
+    },
+    { // from 65: LOC_BEDQUILT
+        .motion = NORTH,
+        .condtype = cond_pct,
+        .condarg1 = 75,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_LOWROOM,
+        .flags = 0,
+    },
+    { // from 65: LOC_BEDQUILT
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_THREEJUNCTION,
+        .flags = 0,
+    },
+    { // from 65: LOC_BEDQUILT
+        .motion = DOWN,
+        .condtype = cond_pct,
+        .condarg1 = 65,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = FUTILE_CRAWL,
+        .flags = 0,
+    },
+    { // from 65: LOC_BEDQUILT
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ANTEROOM,
+        .flags = TF_STOP,
+    },
+    { // from 66: LOC_SWISSCHEESE
+        .motion = NE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BEDQUILT,
+        .flags = 0,
+    },
+    { // from 66: LOC_SWISSCHEESE
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_EASTEND,
+        .flags = 0,
+    },
+    { // from 66: LOC_SWISSCHEESE
+        .motion = SOUTH,
+        .condtype = cond_pct,
+        .condarg1 = 80,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = FUTILE_CRAWL,
+        .flags = 0,
+    },
+    { // from 66: LOC_SWISSCHEESE
+        .motion = MOT_25,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_TALL,
+        .flags = 0,
+    },
+    { // from 66: LOC_SWISSCHEESE
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SOFTROOM,
+        .flags = 0,
+    },
+    { // from 66: LOC_SWISSCHEESE
+        .motion = NW,
+        .condtype = cond_pct,
+        .condarg1 = 50,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = FUTILE_CRAWL,
+        .flags = 0,
+    },
+    { // from 66: LOC_SWISSCHEESE
+        .motion = ORIENTAL,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ORIENTAL,
+        .flags = TF_STOP,
+    },
+    { // from 67: LOC_EASTEND
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SWISSCHEESE,
+        .flags = 0,
+    },
+    { // from 67: LOC_EASTEND
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WESTEND,
+        .flags = 0,
+    },
+    { // from 67: LOC_EASTEND
+        .motion = MOT_42,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WESTEND,
+        .flags = 0,
+    },
+    { // from 67: LOC_EASTEND
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_EASTPIT,
+        .flags = 0,
+    },
+    { // from 67: LOC_EASTEND
+        .motion = MOT_31,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_EASTPIT,
+        .flags = TF_STOP,
+    },
+    { // from 68: LOC_SLAB
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WESTEND,
+        .flags = 0,
+    },
+    { // from 68: LOC_SLAB
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SECRET1,
+        .flags = 0,
+    },
+    { // from 68: LOC_SLAB
+        .motion = MOT_56,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SECRET1,
+        .flags = 0,
+    },
+    { // from 68: LOC_SLAB
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BEDQUILT,
+        .flags = TF_STOP,
+    },
+    { // from 69: LOC_SECRET1
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SLAB,
+        .flags = 0,
+    },
+    { // from 69: LOC_SECRET1
+        .motion = MOT_61,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SLAB,
+        .flags = 0,
+    },
+    { // from 69: LOC_SECRET1
+        .motion = SOUTH,
+        .condtype = cond_not,
+        .condarg1 = 31,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SECRET5,
+        .flags = 0,
+    },
+    { // from 69: LOC_SECRET1
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SECRET4,
+        .flags = 0,
+    },
+    { // from 69: LOC_SECRET1
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_MIRRORCANYON,
+        .flags = 0,
+    },
+    { // from 69: LOC_SECRET1
+        .motion = RESERVOIR,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_RESERVOIR,
+        .flags = TF_STOP,
+    },
+    { // from 70: LOC_SECRET2
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_THREEJUNCTION,
+        .flags = 0,
+    },
+    { // from 70: LOC_SECRET2
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BEDQUILT,
+        .flags = 0,
+    },
+    { // from 70: LOC_SECRET2
+        .motion = MOT_23,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BEDQUILT,
+        .flags = 0,
+    },
+    { // from 70: LOC_SECRET2
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_TOPSTALACTITE,
+        .flags = TF_STOP,
+    },
+    { // from 71: LOC_THREEJUNCTION
+        .motion = SE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BEDQUILT,
+        .flags = 0,
+    },
+    { // from 71: LOC_THREEJUNCTION
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SECRET2,
+        .flags = 0,
+    },
+    { // from 71: LOC_THREEJUNCTION
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WINDOW2,
+        .flags = TF_STOP,
+    },
+    { // from 72: LOC_LOWROOM
+        .motion = BEDQUILT,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BEDQUILT,
+        .flags = 0,
+    },
+    { // from 72: LOC_LOWROOM
+        .motion = SW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WINDING,
+        .flags = 0,
+    },
+    { // from 72: LOC_LOWROOM
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEADCRAWL,
+        .flags = 0,
+    },
+    { // from 72: LOC_LOWROOM
+        .motion = SE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ORIENTAL,
+        .flags = 0,
+    },
+    { // from 72: LOC_LOWROOM
+        .motion = ORIENTAL,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ORIENTAL,
+        .flags = TF_STOP,
+    },
+    { // from 73: LOC_DEADCRAWL
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_LOWROOM,
+        .flags = 0,
+    },
+    { // from 73: LOC_DEADCRAWL
+        .motion = CRAWL,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_LOWROOM,
+        .flags = 0,
+    },
+    { // from 73: LOC_DEADCRAWL
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_LOWROOM,
+        .flags = TF_STOP,
+    },
+    { // from 74: LOC_SECRET3
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_KINGHALL,
+        .flags = 0,
+    },
+    { // from 74: LOC_SECRET3
+        .motion = WEST,
+        .condtype = cond_not,
+        .condarg1 = 31,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SECRET5,
+        .flags = 0,
+    },
+    { // from 74: LOC_SECRET3
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SECRET6,
+        .flags = 0,
+    },
+    { // from 74: LOC_SECRET3
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WIDEPLACE,
+        .flags = TF_STOP,
+    },
+    { // from 75: LOC_WIDEPLACE
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_TIGHTPLACE,
+        .flags = 0,
+    },
+    { // from 75: LOC_WIDEPLACE
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_TALL,
+        .flags = TF_STOP,
+    },
+    { // from 76: LOC_TIGHTPLACE
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WIDEPLACE,
+        .flags = TF_STOP,
+    },
+    { // from 77: LOC_TALL
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WIDEPLACE,
+        .flags = 0,
+    },
+    { // from 77: LOC_TALL
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BOULDERS1,
+        .flags = 0,
+    },
+    { // from 77: LOC_TALL
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SWISSCHEESE,
+        .flags = 0,
+    },
+    { // from 77: LOC_TALL
+        .motion = CRAWL,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SWISSCHEESE,
+        .flags = TF_STOP,
+    },
+    { // from 78: LOC_BOULDERS1
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_TALL,
+        .flags = TF_STOP,
+    },
+    { // from 79: LOC_SEWER
+        .motion = 1,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BUILDING,
+        .flags = TF_STOP,
+    },
+    { // from 80: LOC_ALIKE11
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE1,
+        .flags = 0,
+    },
+    { // from 80: LOC_ALIKE11
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE11,
+        .flags = 0,
+    },
+    { // from 80: LOC_ALIKE11
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE11,
+        .flags = 0,
+    },
+    { // from 80: LOC_ALIKE11
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEADEND8,
+        .flags = TF_STOP,
+    },
+    { // from 81: LOC_DEADEND8
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE11,
+        .flags = 0,
+    },
+    { // from 81: LOC_DEADEND8
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE11,
+        .flags = TF_STOP,
+    },
+    { // from 82: LOC_DEADEND9
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE3,
+        .flags = 0,
+    },
+    { // from 82: LOC_DEADEND9
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE3,
+        .flags = TF_STOP,
+    },
+    { // from 83: LOC_ALIKE12
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_PITBRINK,
+        .flags = 0,
+    },
+    { // from 83: LOC_ALIKE12
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE13,
+        .flags = 0,
+    },
+    { // from 83: LOC_ALIKE12
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEADEND10,
+        .flags = TF_STOP,
+    },
+    { // from 84: LOC_ALIKE13
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_PITBRINK,
+        .flags = 0,
+    },
+    { // from 84: LOC_ALIKE13
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE12,
+        .flags = 0,
+    },
+    { // from 84: LOC_ALIKE13
+        .motion = NW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEADEND12,
+        .flags = TF_STOP,
+    },
+    { // from 85: LOC_DEADEND10
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE12,
+        .flags = 0,
+    },
+    { // from 85: LOC_DEADEND10
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE12,
+        .flags = TF_STOP,
+    },
+    { // from 86: LOC_DEADEND11
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE8,
+        .flags = 0,
+    },
+    { // from 86: LOC_DEADEND11
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE8,
+        .flags = TF_STOP,
+    },
+    { // from 87: LOC_ALIKE14
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE4,
+        .flags = 0,
+    },
+    { // from 87: LOC_ALIKE14
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE4,
+        .flags = TF_STOP,
+    },
+    { // from 88: LOC_NARROW
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WESTPIT,
+        .flags = 0,
+    },
+    { // from 88: LOC_NARROW
+        .motion = MOT_56,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WESTPIT,
+        .flags = 0,
+    },
+    { // from 88: LOC_NARROW
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WESTPIT,
+        .flags = 0,
+    },
+    { // from 88: LOC_NARROW
+        .motion = MOT_39,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_NECKBROKE,
+        .flags = 0,
+    },
+    { // from 88: LOC_NARROW
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_GIANTROOM,
+        .flags = 0,
+    },
+    { // from 88: LOC_NARROW
+        .motion = MOT_27,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_GIANTROOM,
+        .flags = TF_STOP,
+    },
+    { // from 89: LOC_NOCLIMB
+        .motion = 1,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WESTPIT,
+        .flags = TF_STOP,
+    },
+    { // from 90: LOC_PLANTTOP
+        .motion = 1,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WESTEND,
+        .flags = TF_STOP,
+    },
+    { // from 91: LOC_INCLINE
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WATERFALL,
+        .flags = 0,
+    },
+    { // from 91: LOC_INCLINE
+        .motion = CAVERN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WATERFALL,
+        .flags = 0,
+    },
+    { // from 91: LOC_INCLINE
+        .motion = MOT_23,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WATERFALL,
+        .flags = 0,
+    },
+    { // from 91: LOC_INCLINE
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_LOWROOM,
+        .flags = 0,
+    },
+    { // from 91: LOC_INCLINE
+        .motion = MOT_56,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_LOWROOM,
+        .flags = TF_STOP,
+    },
+    { // from 92: LOC_GIANTROOM
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_NARROW,
+        .flags = 0,
+    },
+    { // from 92: LOC_GIANTROOM
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CAVEIN,
+        .flags = 0,
+    },
+    { // from 92: LOC_GIANTROOM
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_IMMENSE,
+        .flags = TF_STOP,
+    },
+    { // from 93: LOC_CAVEIN
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_GIANTROOM,
+        .flags = 0,
+    },
+    { // from 93: LOC_CAVEIN
+        .motion = MOT_27,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_GIANTROOM,
+        .flags = 0,
+    },
+    { // from 93: LOC_CAVEIN
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_GIANTROOM,
+        .flags = TF_STOP,
+    },
+    { // from 94: LOC_IMMENSE
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_GIANTROOM,
+        .flags = 0,
+    },
+    { // from 94: LOC_IMMENSE
+        .motion = MOT_27,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_GIANTROOM,
+        .flags = 0,
+    },
+    { // from 94: LOC_IMMENSE
+        .motion = MOT_23,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_GIANTROOM,
+        .flags = 0,
+    },
+    { // from 94: LOC_IMMENSE
+        .motion = NORTH,
+        .condtype = cond_not,
+        .condarg1 = 9,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WATERFALL,
+        .flags = 0,
+    },
+    { // from 94: LOC_IMMENSE
+        .motion = ENTER,
+        .condtype = cond_not,
+        .condarg1 = 9,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WATERFALL,
+        .flags = 0,
+    },
+    { // from 94: LOC_IMMENSE
+        .motion = CAVERN,
+        .condtype = cond_not,
+        .condarg1 = 9,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WATERFALL,
+        .flags = 0,
+    },
+    { // from 94: LOC_IMMENSE
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = RUSTY_DOOR,
+        .flags = TF_STOP,
+    },
+    { // from 95: LOC_WATERFALL
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_IMMENSE,
+        .flags = 0,
+    },
+    { // from 95: LOC_WATERFALL
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_IMMENSE,
+        .flags = 0,
+    },
+    { // from 95: LOC_WATERFALL
+        .motion = MOT_27,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_GIANTROOM,
+        .flags = 0,
+    },
+    { // from 95: LOC_WATERFALL
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_INCLINE,
+        .flags = TF_STOP,
+    },
+    { // from 96: LOC_SOFTROOM
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SWISSCHEESE,
+        .flags = 0,
+    },
+    { // from 96: LOC_SOFTROOM
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SWISSCHEESE,
+        .flags = TF_STOP,
+    },
+    { // from 97: LOC_ORIENTAL
+        .motion = SE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SWISSCHEESE,
+        .flags = 0,
+    },
+    { // from 97: LOC_ORIENTAL
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_LOWROOM,
+        .flags = 0,
+    },
+    { // from 97: LOC_ORIENTAL
+        .motion = CRAWL,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_LOWROOM,
+        .flags = 0,
+    },
+    { // from 97: LOC_ORIENTAL
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_MISTY,
+        .flags = 0,
+    },
+    { // from 97: LOC_ORIENTAL
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_MISTY,
+        .flags = 0,
+    },
+    { // from 97: LOC_ORIENTAL
+        .motion = CAVERN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_MISTY,
+        .flags = TF_STOP,
+    },
+    { // from 98: LOC_MISTY
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ORIENTAL,
+        .flags = 0,
+    },
+    { // from 98: LOC_MISTY
+        .motion = ORIENTAL,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ORIENTAL,
+        .flags = 0,
+    },
+    { // from 98: LOC_MISTY
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALCOVE,
+        .flags = TF_STOP,
+    },
+    { // from 99: LOC_ALCOVE
+        .motion = NW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_MISTY,
+        .flags = 0,
+    },
+    { // from 99: LOC_ALCOVE
+        .motion = CAVERN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_MISTY,
+        .flags = 0,
+    },
+    { // from 99: LOC_ALCOVE
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_special,
+        .destval = LOC_START,
+        .flags = 0,
+    },
+    { // from 99: LOC_ALCOVE
+        .motion = MOT_23,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_special,
+        .destval = LOC_START,
+        .flags = 0,
+    },
+    { // from 99: LOC_ALCOVE
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_PLOVER,
+        .flags = TF_STOP,
+    },
+    { // from 100: LOC_PLOVER
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_special,
+        .destval = LOC_START,
+        .flags = 0,
+    },
+    { // from 100: LOC_PLOVER
+        .motion = MOT_23,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_special,
+        .destval = LOC_START,
+        .flags = 0,
+    },
+    { // from 100: LOC_PLOVER
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_special,
+        .destval = LOC_START,
+        .flags = 0,
+    },
+    { // from 100: LOC_PLOVER
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALCOVE,
+        .flags = 0,
+    },
+    { // from 100: LOC_PLOVER
+        .motion = PLOVER,
+        .condtype = cond_carry,
+        .condarg1 = EMERALD,
+        .condarg2 = 0,
+        .desttype = dest_special,
+        .destval = LOC_HILL,
+        .flags = 0,
+    },
+    { // from 100: LOC_PLOVER
+        .motion = PLOVER,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOOF6,
+        .flags = 0,
+    },
+    { // from 100: LOC_PLOVER
+        .motion = NE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DARKROOM,
+        .flags = 0,
+    },
+    { // from 100: LOC_PLOVER
+        .motion = MOT_22,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DARKROOM,
+        .flags = TF_STOP,
+    },
+    { // from 101: LOC_DARKROOM
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_PLOVER,
+        .flags = 0,
+    },
+    { // from 101: LOC_DARKROOM
+        .motion = PLOVER,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_PLOVER,
+        .flags = 0,
+    },
+    { // from 101: LOC_DARKROOM
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_PLOVER,
+        .flags = TF_STOP,
+    },
+    { // from 102: LOC_ARCHED
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SHELLROOM,
+        .flags = 0,
+    },
+    { // from 102: LOC_ARCHED
+        .motion = SHELLROOM,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SHELLROOM,
+        .flags = 0,
+    },
+    { // from 102: LOC_ARCHED
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SHELLROOM,
+        .flags = TF_STOP,
+    },
+    { // from 103: LOC_SHELLROOM
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ARCHED,
+        .flags = 0,
+    },
+    { // from 103: LOC_SHELLROOM
+        .motion = MOT_38,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ARCHED,
+        .flags = 0,
+    },
+    { // from 103: LOC_SHELLROOM
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SLOPING1,
+        .flags = 0,
+    },
+    { // from 103: LOC_SHELLROOM
+        .motion = SOUTH,
+        .condtype = cond_carry,
+        .condarg1 = CLAM,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = CLAM_BLOCKER,
+        .flags = 0,
+    },
+    { // from 103: LOC_SHELLROOM
+        .motion = SOUTH,
+        .condtype = cond_carry,
+        .condarg1 = OYSTER,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = OYSTER_BLOCKER,
+        .flags = 0,
+    },
+    { // from 103: LOC_SHELLROOM
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_COMPLEX,
+        .flags = TF_STOP,
+    },
+    { // from 104: LOC_SLOPING1
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SHELLROOM,
+        .flags = 0,
+    },
+    { // from 104: LOC_SLOPING1
+        .motion = SHELLROOM,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SHELLROOM,
+        .flags = 0,
+    },
+    { // from 104: LOC_SLOPING1
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CULDESAC,
+        .flags = TF_STOP,
+    },
+    { // from 105: LOC_CULDESAC
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SLOPING1,
+        .flags = 0,
+    },
+    { // from 105: LOC_CULDESAC
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SLOPING1,
+        .flags = 0,
+    },
+    { // from 105: LOC_CULDESAC
+        .motion = SHELLROOM,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SHELLROOM,
+        .flags = TF_STOP,
+    },
+    { // from 106: LOC_ANTEROOM
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_COMPLEX,
+        .flags = 0,
+    },
+    { // from 106: LOC_ANTEROOM
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BEDQUILT,
+        .flags = 0,
+    },
+    { // from 106: LOC_ANTEROOM
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WITTSEND,
+        .flags = TF_STOP,
+    },
+    { // from 107: LOC_DIFFERENT1
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT3,
+        .flags = 0,
+    },
+    { // from 107: LOC_DIFFERENT1
+        .motion = SW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT4,
+        .flags = 0,
+    },
+    { // from 107: LOC_DIFFERENT1
+        .motion = NE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT5,
+        .flags = 0,
+    },
+    { // from 107: LOC_DIFFERENT1
+        .motion = SE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT6,
+        .flags = 0,
+    },
+    { // from 107: LOC_DIFFERENT1
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT7,
+        .flags = 0,
+    },
+    { // from 107: LOC_DIFFERENT1
+        .motion = NW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT8,
+        .flags = 0,
+    },
+    { // from 107: LOC_DIFFERENT1
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT9,
+        .flags = 0,
+    },
+    { // from 107: LOC_DIFFERENT1
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT10,
+        .flags = 0,
+    },
+    { // from 107: LOC_DIFFERENT1
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT11,
+        .flags = 0,
+    },
+    { // from 107: LOC_DIFFERENT1
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_LONGWEST,
+        .flags = TF_STOP,
+    },
+    { // from 108: LOC_WITTSEND
+        .motion = EAST,
+        .condtype = cond_pct,
+        .condarg1 = 95,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = FUTILE_CRAWL,
+        .flags = 0,
+    },
+    { // from 108: LOC_WITTSEND
+        .motion = NORTH,
+        .condtype = cond_pct,
+        .condarg1 = 95,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = FUTILE_CRAWL,
+        .flags = 0,
+    },
+    { // from 108: LOC_WITTSEND
+        .motion = SOUTH,
+        .condtype = cond_pct,
+        .condarg1 = 95,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = FUTILE_CRAWL,
+        .flags = 0,
+    },
+    { // from 108: LOC_WITTSEND
+        .motion = NE,
+        .condtype = cond_pct,
+        .condarg1 = 95,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = FUTILE_CRAWL,
+        .flags = 0,
+    },
+    { // from 108: LOC_WITTSEND
+        .motion = SE,
+        .condtype = cond_pct,
+        .condarg1 = 95,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = FUTILE_CRAWL,
+        .flags = 0,
+    },
+    { // from 108: LOC_WITTSEND
+        .motion = SW,
+        .condtype = cond_pct,
+        .condarg1 = 95,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = FUTILE_CRAWL,
+        .flags = 0,
+    },
+    { // from 108: LOC_WITTSEND
+        .motion = NW,
+        .condtype = cond_pct,
+        .condarg1 = 95,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = FUTILE_CRAWL,
+        .flags = 0,
+    },
+    { // from 108: LOC_WITTSEND
+        .motion = UP,
+        .condtype = cond_pct,
+        .condarg1 = 95,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = FUTILE_CRAWL,
+        .flags = 0,
+    },
+    { // from 108: LOC_WITTSEND
+        .motion = DOWN,
+        .condtype = cond_pct,
+        .condarg1 = 95,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = FUTILE_CRAWL,
+        .flags = 0,
+    },
+    { // from 108: LOC_WITTSEND
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ANTEROOM,
+        .flags = 0,
+    },
+    { // from 108: LOC_WITTSEND
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = WAY_BLOCKED,
+        .flags = TF_STOP,
+    },
+    { // from 109: LOC_MIRRORCANYON
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SECRET1,
+        .flags = 0,
+    },
+    { // from 109: LOC_MIRRORCANYON
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_RESERVOIR,
+        .flags = 0,
+    },
+    { // from 109: LOC_MIRRORCANYON
+        .motion = RESERVOIR,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_RESERVOIR,
+        .flags = TF_STOP,
+    },
+    { // from 110: LOC_WINDOW2
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_THREEJUNCTION,
+        .flags = 0,
+    },
+    { // from 110: LOC_WINDOW2
+        .motion = MOT_39,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_NECKBROKE,
+        .flags = TF_STOP,
+    },
+    { // from 111: LOC_TOPSTALACTITE
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SECRET2,
+        .flags = 0,
+    },
+    { // from 111: LOC_TOPSTALACTITE
+        .motion = DOWN,
+        .condtype = cond_pct,
+        .condarg1 = 40,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE6,
+        .flags = 0,
+    },
+    { // from 111: LOC_TOPSTALACTITE
+        .motion = MOT_39,
+        .condtype = cond_pct,
+        .condarg1 = 40,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE6,
+        .flags = 0,
+    },
+    { // from 111: LOC_TOPSTALACTITE
+        .motion = MOT_56,
+        .condtype = cond_pct,
+        .condarg1 = 40,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE6,
+        .flags = 0,
+    },
+    { // from 111: LOC_TOPSTALACTITE
+        .motion = DOWN,
+        .condtype = cond_pct,
+        .condarg1 = 50,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE9,
+        .flags = 0,
+    },
+    { // from 111: LOC_TOPSTALACTITE
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE4,
+        .flags = TF_STOP,
+    },
+    { // from 112: LOC_DIFFERENT2
+        .motion = SW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT3,
+        .flags = 0,
+    },
+    { // from 112: LOC_DIFFERENT2
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT4,
+        .flags = 0,
+    },
+    { // from 112: LOC_DIFFERENT2
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT5,
+        .flags = 0,
+    },
+    { // from 112: LOC_DIFFERENT2
+        .motion = NW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT6,
+        .flags = 0,
+    },
+    { // from 112: LOC_DIFFERENT2
+        .motion = SE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT7,
+        .flags = 0,
+    },
+    { // from 112: LOC_DIFFERENT2
+        .motion = NE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT8,
+        .flags = 0,
+    },
+    { // from 112: LOC_DIFFERENT2
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT9,
+        .flags = 0,
+    },
+    { // from 112: LOC_DIFFERENT2
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT10,
+        .flags = 0,
+    },
+    { // from 112: LOC_DIFFERENT2
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT11,
+        .flags = 0,
+    },
+    { // from 112: LOC_DIFFERENT2
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEADEND13,
+        .flags = TF_STOP,
+    },
+    { // from 113: LOC_RESERVOIR
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_MIRRORCANYON,
+        .flags = 0,
+    },
+    { // from 113: LOC_RESERVOIR
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_MIRRORCANYON,
+        .flags = 0,
+    },
+    { // from 113: LOC_RESERVOIR
+        .motion = NORTH,
+        .condtype = cond_not,
+        .condarg1 = 45,
+        .condarg2 = 1,
+        .desttype = dest_speak,
+        .destval = BAD_DIRECTION,
+        .flags = 0,
+    },
+    { // from 113: LOC_RESERVOIR
+        .motion = MOT_42,
+        .condtype = cond_not,
+        .condarg1 = 45,
+        .condarg2 = 1,
+        .desttype = dest_speak,
+        .destval = BAD_DIRECTION,
+        .flags = 0,
+    },
+    { // from 113: LOC_RESERVOIR
+        .motion = CROSS,
+        .condtype = cond_not,
+        .condarg1 = 45,
+        .condarg2 = 1,
+        .desttype = dest_speak,
+        .destval = BAD_DIRECTION,
+        .flags = 0,
+    },
+    { // from 113: LOC_RESERVOIR
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_RESBOTTOM,
+        .flags = TF_STOP,
+    },
+    { // from 114: LOC_DEADEND12
+        .motion = SE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ALIKE13,
+        .flags = TF_STOP,
+    },
+    { // from 115: LOC_NE
+        .motion = SW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SW,
+        .flags = TF_STOP,
+    },
+    { // from 116: LOC_SW
+        .motion = NE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_NE,
+        .flags = 0,
+    },
+    { // from 116: LOC_SW
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = GRATE_NOWAY,
+        .flags = TF_STOP,
+    },
+    { // from 117: LOC_SWCHASM
+        .motion = SW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WINDING,
+        .flags = 0,
+    },
+    { // from 117: LOC_SWCHASM
+        .motion = MOT_41,
+        .condtype = cond_with,
+        .condarg1 = TROLL,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = TROLL_BLOCKS,
+        .flags = 0,
+    },
+    { // from 117: LOC_SWCHASM
+        .motion = MOT_42,
+        .condtype = cond_with,
+        .condarg1 = TROLL,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = TROLL_BLOCKS,
+        .flags = 0,
+    },
+    { // from 117: LOC_SWCHASM
+        .motion = CROSS,
+        .condtype = cond_with,
+        .condarg1 = TROLL,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = TROLL_BLOCKS,
+        .flags = 0,
+    },
+    { // from 117: LOC_SWCHASM
+        .motion = NE,
+        .condtype = cond_with,
+        .condarg1 = TROLL,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = TROLL_BLOCKS,
+        .flags = 0,
+    },
+    { // from 117: LOC_SWCHASM
+        .motion = MOT_41,
+        .condtype = cond_not,
+        .condarg1 = 32,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = BRIDGE_GONE,
+        .flags = 0,
+    },
+    { // from 117: LOC_SWCHASM
+        .motion = MOT_41,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_special,
+        .destval = LOC_BUILDING,
+        .flags = 0,
+    },
+    { // from 117: LOC_SWCHASM
+        .motion = MOT_39,
+        .condtype = cond_not,
+        .condarg1 = 32,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_NOMAKE,
+        .flags = 0,
+    },
+    { // from 117: LOC_SWCHASM
+        .motion = MOT_39,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = CROSS_BRIDGE,
+        .flags = TF_STOP,
+    },
+    { // from 118: LOC_WINDING
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_LOWROOM,
+        .flags = 0,
+    },
+    { // from 118: LOC_WINDING
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SWCHASM,
+        .flags = TF_STOP,
+    },
+    { // from 119: LOC_SECRET4
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SECRET1,
+        .flags = 0,
+    },
+    { // from 119: LOC_SECRET4
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SECRET1,
+        .flags = 0,
+    },
+    { // from 119: LOC_SECRET4
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = NASTY_DRAGON,
+        .flags = 0,
+    },
+    { // from 119: LOC_SECRET4
+        .motion = FORWARD,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = NASTY_DRAGON,
+        .flags = TF_STOP,
+    },
+    { // from 120: LOC_SECRET5
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SECRET1,
+        .flags = 0,
+    },
+    { // from 120: LOC_SECRET5
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SECRET3,
+        .flags = TF_STOP,
+    },
+    { // from 121: LOC_SECRET6
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SECRET3,
+        .flags = 0,
+    },
+    { // from 121: LOC_SECRET6
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SECRET3,
+        .flags = 0,
+    },
+    { // from 121: LOC_SECRET6
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = NASTY_DRAGON,
+        .flags = 0,
+    },
+    { // from 121: LOC_SECRET6
+        .motion = FORWARD,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = NASTY_DRAGON,
+        .flags = TF_STOP,
+    },
+    { // from 122: LOC_NECHASM
+        .motion = NE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CORRIDOR,
+        .flags = 0,
+    },
+    { // from 122: LOC_NECHASM
+        .motion = MOT_41,
+        .condtype = cond_with,
+        .condarg1 = TROLL,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = TROLL_BLOCKS,
+        .flags = 0,
+    },
+    { // from 122: LOC_NECHASM
+        .motion = MOT_42,
+        .condtype = cond_with,
+        .condarg1 = TROLL,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = TROLL_BLOCKS,
+        .flags = 0,
+    },
+    { // from 122: LOC_NECHASM
+        .motion = CROSS,
+        .condtype = cond_with,
+        .condarg1 = TROLL,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = TROLL_BLOCKS,
+        .flags = 0,
+    },
+    { // from 122: LOC_NECHASM
+        .motion = SW,
+        .condtype = cond_with,
+        .condarg1 = TROLL,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = TROLL_BLOCKS,
+        .flags = 0,
+    },
+    { // from 122: LOC_NECHASM
+        .motion = MOT_41,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_special,
+        .destval = LOC_BUILDING,
+        .flags = 0,
+    },
+    { // from 122: LOC_NECHASM
+        .motion = MOT_39,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = CROSS_BRIDGE,
+        .flags = 0,
+    },
+    { // from 122: LOC_NECHASM
+        .motion = MOT_15,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FORK,
+        .flags = 0,
+    },
+    { // from 122: LOC_NECHASM
+        .motion = MOT_28,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BREATHTAKING,
+        .flags = 0,
+    },
+    { // from 122: LOC_NECHASM
+        .motion = MOT_40,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BARRENFRONT,
+        .flags = TF_STOP,
+    },
+    { // from 123: LOC_CORRIDOR
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_NECHASM,
+        .flags = 0,
+    },
+    { // from 123: LOC_CORRIDOR
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FORK,
+        .flags = 0,
+    },
+    { // from 123: LOC_CORRIDOR
+        .motion = MOT_15,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FORK,
+        .flags = 0,
+    },
+    { // from 123: LOC_CORRIDOR
+        .motion = MOT_28,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BREATHTAKING,
+        .flags = 0,
+    },
+    { // from 123: LOC_CORRIDOR
+        .motion = MOT_40,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BARRENFRONT,
+        .flags = TF_STOP,
+    },
+    { // from 124: LOC_FORK
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CORRIDOR,
+        .flags = 0,
+    },
+    { // from 124: LOC_FORK
+        .motion = NE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WARMWALLS,
+        .flags = 0,
+    },
+    { // from 124: LOC_FORK
+        .motion = LEFT,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WARMWALLS,
+        .flags = 0,
+    },
+    { // from 124: LOC_FORK
+        .motion = SE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_LIMESTONE,
+        .flags = 0,
+    },
+    { // from 124: LOC_FORK
+        .motion = RIGHT,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_LIMESTONE,
+        .flags = 0,
+    },
+    { // from 124: LOC_FORK
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_LIMESTONE,
+        .flags = 0,
+    },
+    { // from 124: LOC_FORK
+        .motion = MOT_28,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BREATHTAKING,
+        .flags = 0,
+    },
+    { // from 124: LOC_FORK
+        .motion = MOT_40,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BARRENFRONT,
+        .flags = TF_STOP,
+    },
+    { // from 125: LOC_WARMWALLS
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FORK,
+        .flags = 0,
+    },
+    { // from 125: LOC_WARMWALLS
+        .motion = MOT_15,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FORK,
+        .flags = 0,
+    },
+    { // from 125: LOC_WARMWALLS
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BREATHTAKING,
+        .flags = 0,
+    },
+    { // from 125: LOC_WARMWALLS
+        .motion = MOT_28,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BREATHTAKING,
+        .flags = 0,
+    },
+    { // from 125: LOC_WARMWALLS
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BOULDERS2,
+        .flags = 0,
+    },
+    { // from 125: LOC_WARMWALLS
+        .motion = CRAWL,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BOULDERS2,
+        .flags = TF_STOP,
+    },
+    { // from 126: LOC_BREATHTAKING
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WARMWALLS,
+        .flags = 0,
+    },
+    { // from 126: LOC_BREATHTAKING
+        .motion = MOT_23,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WARMWALLS,
+        .flags = 0,
+    },
+    { // from 126: LOC_BREATHTAKING
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WARMWALLS,
+        .flags = 0,
+    },
+    { // from 126: LOC_BREATHTAKING
+        .motion = MOT_15,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FORK,
+        .flags = 0,
+    },
+    { // from 126: LOC_BREATHTAKING
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = RIDICULOUS_ATTEMPT,
+        .flags = 0,
+    },
+    { // from 126: LOC_BREATHTAKING
+        .motion = MOT_39,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_GRUESOME,
+        .flags = TF_STOP,
+    },
+    { // from 127: LOC_BOULDERS2
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WARMWALLS,
+        .flags = 0,
+    },
+    { // from 127: LOC_BOULDERS2
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WARMWALLS,
+        .flags = 0,
+    },
+    { // from 127: LOC_BOULDERS2
+        .motion = CRAWL,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_WARMWALLS,
+        .flags = 0,
+    },
+    { // from 127: LOC_BOULDERS2
+        .motion = MOT_15,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FORK,
+        .flags = 0,
+    },
+    { // from 127: LOC_BOULDERS2
+        .motion = MOT_28,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BREATHTAKING,
+        .flags = TF_STOP,
+    },
+    { // from 128: LOC_LIMESTONE
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FORK,
+        .flags = 0,
+    },
+    { // from 128: LOC_LIMESTONE
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FORK,
+        .flags = 0,
+    },
+    { // from 128: LOC_LIMESTONE
+        .motion = MOT_15,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FORK,
+        .flags = 0,
+    },
+    { // from 128: LOC_LIMESTONE
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BARRENFRONT,
+        .flags = 0,
+    },
+    { // from 128: LOC_LIMESTONE
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BARRENFRONT,
+        .flags = 0,
+    },
+    { // from 128: LOC_LIMESTONE
+        .motion = MOT_40,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BARRENFRONT,
+        .flags = 0,
+    },
+    { // from 128: LOC_LIMESTONE
+        .motion = MOT_28,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BREATHTAKING,
+        .flags = TF_STOP,
+    },
+    { // from 129: LOC_BARRENFRONT
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_LIMESTONE,
+        .flags = 0,
+    },
+    { // from 129: LOC_BARRENFRONT
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_LIMESTONE,
+        .flags = 0,
+    },
+    { // from 129: LOC_BARRENFRONT
+        .motion = MOT_15,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FORK,
+        .flags = 0,
+    },
+    { // from 129: LOC_BARRENFRONT
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BARRENROOM,
+        .flags = 0,
+    },
+    { // from 129: LOC_BARRENFRONT
+        .motion = INSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BARRENROOM,
+        .flags = 0,
+    },
+    { // from 129: LOC_BARRENFRONT
+        .motion = MOT_40,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BARRENROOM,
+        .flags = 0,
+    },
+    { // from 129: LOC_BARRENFRONT
+        .motion = ENTER,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BARRENROOM,
+        .flags = 0,
+    },
+    { // from 129: LOC_BARRENFRONT
+        .motion = MOT_28,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BREATHTAKING,
+        .flags = TF_STOP,
+    },
+    { // from 130: LOC_BARRENROOM
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BARRENFRONT,
+        .flags = 0,
+    },
+    { // from 130: LOC_BARRENROOM
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BARRENFRONT,
+        .flags = 0,
+    },
+    { // from 130: LOC_BARRENROOM
+        .motion = MOT_15,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FORK,
+        .flags = 0,
+    },
+    { // from 130: LOC_BARRENROOM
+        .motion = MOT_28,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BREATHTAKING,
+        .flags = TF_STOP,
+    },
+    { // from 131: LOC_DIFFERENT3
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT1,
+        .flags = 0,
+    },
+    { // from 131: LOC_DIFFERENT3
+        .motion = SE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT4,
+        .flags = 0,
+    },
+    { // from 131: LOC_DIFFERENT3
+        .motion = NW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT5,
+        .flags = 0,
+    },
+    { // from 131: LOC_DIFFERENT3
+        .motion = SW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT6,
+        .flags = 0,
+    },
+    { // from 131: LOC_DIFFERENT3
+        .motion = NE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT7,
+        .flags = 0,
+    },
+    { // from 131: LOC_DIFFERENT3
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT8,
+        .flags = 0,
+    },
+    { // from 131: LOC_DIFFERENT3
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT9,
+        .flags = 0,
+    },
+    { // from 131: LOC_DIFFERENT3
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT10,
+        .flags = 0,
+    },
+    { // from 131: LOC_DIFFERENT3
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT11,
+        .flags = 0,
+    },
+    { // from 131: LOC_DIFFERENT3
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT2,
+        .flags = TF_STOP,
+    },
+    { // from 132: LOC_DIFFERENT4
+        .motion = NW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT1,
+        .flags = 0,
+    },
+    { // from 132: LOC_DIFFERENT4
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT3,
+        .flags = 0,
+    },
+    { // from 132: LOC_DIFFERENT4
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT5,
+        .flags = 0,
+    },
+    { // from 132: LOC_DIFFERENT4
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT6,
+        .flags = 0,
+    },
+    { // from 132: LOC_DIFFERENT4
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT7,
+        .flags = 0,
+    },
+    { // from 132: LOC_DIFFERENT4
+        .motion = SW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT8,
+        .flags = 0,
+    },
+    { // from 132: LOC_DIFFERENT4
+        .motion = NE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT9,
+        .flags = 0,
+    },
+    { // from 132: LOC_DIFFERENT4
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT10,
+        .flags = 0,
+    },
+    { // from 132: LOC_DIFFERENT4
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT11,
+        .flags = 0,
+    },
+    { // from 132: LOC_DIFFERENT4
+        .motion = SE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT2,
+        .flags = TF_STOP,
+    },
+    { // from 133: LOC_DIFFERENT5
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT1,
+        .flags = 0,
+    },
+    { // from 133: LOC_DIFFERENT5
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT3,
+        .flags = 0,
+    },
+    { // from 133: LOC_DIFFERENT5
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT4,
+        .flags = 0,
+    },
+    { // from 133: LOC_DIFFERENT5
+        .motion = NE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT6,
+        .flags = 0,
+    },
+    { // from 133: LOC_DIFFERENT5
+        .motion = SW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT7,
+        .flags = 0,
+    },
+    { // from 133: LOC_DIFFERENT5
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT8,
+        .flags = 0,
+    },
+    { // from 133: LOC_DIFFERENT5
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT9,
+        .flags = 0,
+    },
+    { // from 133: LOC_DIFFERENT5
+        .motion = NW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT10,
+        .flags = 0,
+    },
+    { // from 133: LOC_DIFFERENT5
+        .motion = SE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT11,
+        .flags = 0,
+    },
+    { // from 133: LOC_DIFFERENT5
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT2,
+        .flags = TF_STOP,
+    },
+    { // from 134: LOC_DIFFERENT6
+        .motion = NE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT1,
+        .flags = 0,
+    },
+    { // from 134: LOC_DIFFERENT6
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT3,
+        .flags = 0,
+    },
+    { // from 134: LOC_DIFFERENT6
+        .motion = NW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT4,
+        .flags = 0,
+    },
+    { // from 134: LOC_DIFFERENT6
+        .motion = SE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT5,
+        .flags = 0,
+    },
+    { // from 134: LOC_DIFFERENT6
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT7,
+        .flags = 0,
+    },
+    { // from 134: LOC_DIFFERENT6
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT8,
+        .flags = 0,
+    },
+    { // from 134: LOC_DIFFERENT6
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT9,
+        .flags = 0,
+    },
+    { // from 134: LOC_DIFFERENT6
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT10,
+        .flags = 0,
+    },
+    { // from 134: LOC_DIFFERENT6
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT11,
+        .flags = 0,
+    },
+    { // from 134: LOC_DIFFERENT6
+        .motion = SW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT2,
+        .flags = TF_STOP,
+    },
+    { // from 135: LOC_DIFFERENT7
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT1,
+        .flags = 0,
+    },
+    { // from 135: LOC_DIFFERENT7
+        .motion = SE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT3,
+        .flags = 0,
+    },
+    { // from 135: LOC_DIFFERENT7
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT4,
+        .flags = 0,
+    },
+    { // from 135: LOC_DIFFERENT7
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT5,
+        .flags = 0,
+    },
+    { // from 135: LOC_DIFFERENT7
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT6,
+        .flags = 0,
+    },
+    { // from 135: LOC_DIFFERENT7
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT8,
+        .flags = 0,
+    },
+    { // from 135: LOC_DIFFERENT7
+        .motion = SW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT9,
+        .flags = 0,
+    },
+    { // from 135: LOC_DIFFERENT7
+        .motion = NE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT10,
+        .flags = 0,
+    },
+    { // from 135: LOC_DIFFERENT7
+        .motion = NW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT11,
+        .flags = 0,
+    },
+    { // from 135: LOC_DIFFERENT7
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT2,
+        .flags = TF_STOP,
+    },
+    { // from 136: LOC_DIFFERENT8
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT1,
+        .flags = 0,
+    },
+    { // from 136: LOC_DIFFERENT8
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT3,
+        .flags = 0,
+    },
+    { // from 136: LOC_DIFFERENT8
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT4,
+        .flags = 0,
+    },
+    { // from 136: LOC_DIFFERENT8
+        .motion = SW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT5,
+        .flags = 0,
+    },
+    { // from 136: LOC_DIFFERENT8
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT6,
+        .flags = 0,
+    },
+    { // from 136: LOC_DIFFERENT8
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT7,
+        .flags = 0,
+    },
+    { // from 136: LOC_DIFFERENT8
+        .motion = NW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT9,
+        .flags = 0,
+    },
+    { // from 136: LOC_DIFFERENT8
+        .motion = SE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT10,
+        .flags = 0,
+    },
+    { // from 136: LOC_DIFFERENT8
+        .motion = NE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT11,
+        .flags = 0,
+    },
+    { // from 136: LOC_DIFFERENT8
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT2,
+        .flags = TF_STOP,
+    },
+    { // from 137: LOC_DIFFERENT9
+        .motion = SE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT1,
+        .flags = 0,
+    },
+    { // from 137: LOC_DIFFERENT9
+        .motion = NE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT3,
+        .flags = 0,
+    },
+    { // from 137: LOC_DIFFERENT9
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT4,
+        .flags = 0,
+    },
+    { // from 137: LOC_DIFFERENT9
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT5,
+        .flags = 0,
+    },
+    { // from 137: LOC_DIFFERENT9
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT6,
+        .flags = 0,
+    },
+    { // from 137: LOC_DIFFERENT9
+        .motion = NW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT7,
+        .flags = 0,
+    },
+    { // from 137: LOC_DIFFERENT9
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT8,
+        .flags = 0,
+    },
+    { // from 137: LOC_DIFFERENT9
+        .motion = SW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT10,
+        .flags = 0,
+    },
+    { // from 137: LOC_DIFFERENT9
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT11,
+        .flags = 0,
+    },
+    { // from 137: LOC_DIFFERENT9
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT2,
+        .flags = TF_STOP,
+    },
+    { // from 138: LOC_DIFFERENT10
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT1,
+        .flags = 0,
+    },
+    { // from 138: LOC_DIFFERENT10
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT3,
+        .flags = 0,
+    },
+    { // from 138: LOC_DIFFERENT10
+        .motion = NE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT4,
+        .flags = 0,
+    },
+    { // from 138: LOC_DIFFERENT10
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT5,
+        .flags = 0,
+    },
+    { // from 138: LOC_DIFFERENT10
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT6,
+        .flags = 0,
+    },
+    { // from 138: LOC_DIFFERENT10
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT7,
+        .flags = 0,
+    },
+    { // from 138: LOC_DIFFERENT10
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT8,
+        .flags = 0,
+    },
+    { // from 138: LOC_DIFFERENT10
+        .motion = SE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT9,
+        .flags = 0,
+    },
+    { // from 138: LOC_DIFFERENT10
+        .motion = SW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT11,
+        .flags = 0,
+    },
+    { // from 138: LOC_DIFFERENT10
+        .motion = NW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT2,
+        .flags = TF_STOP,
+    },
+    { // from 139: LOC_DIFFERENT11
+        .motion = SW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT1,
+        .flags = 0,
+    },
+    { // from 139: LOC_DIFFERENT11
+        .motion = NW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT3,
+        .flags = 0,
+    },
+    { // from 139: LOC_DIFFERENT11
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT4,
+        .flags = 0,
+    },
+    { // from 139: LOC_DIFFERENT11
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT5,
+        .flags = 0,
+    },
+    { // from 139: LOC_DIFFERENT11
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT6,
+        .flags = 0,
+    },
+    { // from 139: LOC_DIFFERENT11
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT7,
+        .flags = 0,
+    },
+    { // from 139: LOC_DIFFERENT11
+        .motion = SE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT8,
+        .flags = 0,
+    },
+    { // from 139: LOC_DIFFERENT11
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT9,
+        .flags = 0,
+    },
+    { // from 139: LOC_DIFFERENT11
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT10,
+        .flags = 0,
+    },
+    { // from 139: LOC_DIFFERENT11
+        .motion = NE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT2,
+        .flags = TF_STOP,
+    },
+    { // from 140: LOC_DEADEND13
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT2,
+        .flags = 0,
+    },
+    { // from 140: LOC_DEADEND13
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DIFFERENT2,
+        .flags = 0,
+    },
+    { // from 140: LOC_DEADEND13
+        .motion = SOUTH,
+        .condtype = cond_not,
+        .condarg1 = 38,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ROUGHHEWN,
+        .flags = 0,
+    },
+    { // from 140: LOC_DEADEND13
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BADDIRECTION,
+        .flags = TF_STOP,
+    },
+    { // from 141: LOC_ROUGHHEWN
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEADEND13,
+        .flags = 0,
+    },
+    { // from 141: LOC_ROUGHHEWN
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_LARGE,
+        .flags = TF_STOP,
+    },
+    { // from 142: LOC_BADDIRECTION
+        .motion = 1,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEADEND13,
+        .flags = TF_STOP,
+    },
+    { // from 143: LOC_LARGE
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ROUGHHEWN,
+        .flags = 0,
+    },
+    { // from 143: LOC_LARGE
+        .motion = NORTH,
+        .condtype = cond_with,
+        .condarg1 = OGRE,
+        .condarg2 = 0,
+        .desttype = dest_speak,
+        .destval = OGRE_SNARL,
+        .flags = 0,
+    },
+    { // from 143: LOC_LARGE
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_STOREROOM,
+        .flags = TF_STOP,
+    },
+    { // from 144: LOC_STOREROOM
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_LARGE,
+        .flags = 0,
+    },
+    { // from 144: LOC_STOREROOM
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_LARGE,
+        .flags = TF_STOP,
+    },
+    { // from 145: LOC_FOREST1
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_START,
+        .flags = 0,
+    },
+    { // from 145: LOC_FOREST1
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST13,
+        .flags = 0,
+    },
+    { // from 145: LOC_FOREST1
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST2,
+        .flags = 0,
+    },
+    { // from 145: LOC_FOREST1
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST3,
+        .flags = TF_STOP,
+    },
+    { // from 146: LOC_FOREST2
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST1,
+        .flags = 0,
+    },
+    { // from 146: LOC_FOREST2
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST19,
+        .flags = 0,
+    },
+    { // from 146: LOC_FOREST2
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST3,
+        .flags = 0,
+    },
+    { // from 146: LOC_FOREST2
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST18,
+        .flags = TF_STOP,
+    },
+    { // from 147: LOC_FOREST3
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST4,
+        .flags = 0,
+    },
+    { // from 147: LOC_FOREST3
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST4,
+        .flags = 0,
+    },
+    { // from 147: LOC_FOREST3
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST2,
+        .flags = 0,
+    },
+    { // from 147: LOC_FOREST3
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST1,
+        .flags = TF_STOP,
+    },
+    { // from 148: LOC_FOREST4
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST3,
+        .flags = 0,
+    },
+    { // from 148: LOC_FOREST4
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST3,
+        .flags = 0,
+    },
+    { // from 148: LOC_FOREST4
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST5,
+        .flags = 0,
+    },
+    { // from 148: LOC_FOREST4
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST5,
+        .flags = TF_STOP,
+    },
+    { // from 149: LOC_FOREST5
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST4,
+        .flags = 0,
+    },
+    { // from 149: LOC_FOREST5
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST4,
+        .flags = 0,
+    },
+    { // from 149: LOC_FOREST5
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST7,
+        .flags = 0,
+    },
+    { // from 149: LOC_FOREST5
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST6,
+        .flags = TF_STOP,
+    },
+    { // from 150: LOC_FOREST6
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST5,
+        .flags = 0,
+    },
+    { // from 150: LOC_FOREST6
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST7,
+        .flags = 0,
+    },
+    { // from 150: LOC_FOREST6
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_VALLEY,
+        .flags = 0,
+    },
+    { // from 150: LOC_FOREST6
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SLIT,
+        .flags = TF_STOP,
+    },
+    { // from 151: LOC_FOREST7
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST5,
+        .flags = 0,
+    },
+    { // from 151: LOC_FOREST7
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST6,
+        .flags = 0,
+    },
+    { // from 151: LOC_FOREST7
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_GRATE,
+        .flags = 0,
+    },
+    { // from 151: LOC_FOREST7
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST8,
+        .flags = TF_STOP,
+    },
+    { // from 152: LOC_FOREST8
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST9,
+        .flags = 0,
+    },
+    { // from 152: LOC_FOREST8
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST11,
+        .flags = 0,
+    },
+    { // from 152: LOC_FOREST8
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST22,
+        .flags = 0,
+    },
+    { // from 152: LOC_FOREST8
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST7,
+        .flags = TF_STOP,
+    },
+    { // from 153: LOC_FOREST9
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST11,
+        .flags = 0,
+    },
+    { // from 153: LOC_FOREST9
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST8,
+        .flags = 0,
+    },
+    { // from 153: LOC_FOREST9
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST10,
+        .flags = 0,
+    },
+    { // from 153: LOC_FOREST9
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_GRATE,
+        .flags = TF_STOP,
+    },
+    { // from 154: LOC_FOREST10
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_SLIT,
+        .flags = 0,
+    },
+    { // from 154: LOC_FOREST10
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST11,
+        .flags = 0,
+    },
+    { // from 154: LOC_FOREST10
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST9,
+        .flags = 0,
+    },
+    { // from 154: LOC_FOREST10
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_GRATE,
+        .flags = TF_STOP,
+    },
+    { // from 155: LOC_FOREST11
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST10,
+        .flags = 0,
+    },
+    { // from 155: LOC_FOREST11
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST8,
+        .flags = 0,
+    },
+    { // from 155: LOC_FOREST11
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST22,
+        .flags = 0,
+    },
+    { // from 155: LOC_FOREST11
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST9,
+        .flags = TF_STOP,
+    },
+    { // from 156: LOC_FOREST12
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST13,
+        .flags = 0,
+    },
+    { // from 156: LOC_FOREST12
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST14,
+        .flags = 0,
+    },
+    { // from 156: LOC_FOREST12
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST22,
+        .flags = 0,
+    },
+    { // from 156: LOC_FOREST12
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_VALLEY,
+        .flags = TF_STOP,
+    },
+    { // from 157: LOC_FOREST13
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST1,
+        .flags = 0,
+    },
+    { // from 157: LOC_FOREST13
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST12,
+        .flags = 0,
+    },
+    { // from 157: LOC_FOREST13
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST20,
+        .flags = 0,
+    },
+    { // from 157: LOC_FOREST13
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_HILL,
+        .flags = TF_STOP,
+    },
+    { // from 158: LOC_FOREST14
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ROADEND,
+        .flags = 0,
+    },
+    { // from 158: LOC_FOREST14
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST16,
+        .flags = 0,
+    },
+    { // from 158: LOC_FOREST14
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST15,
+        .flags = 0,
+    },
+    { // from 158: LOC_FOREST14
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST12,
+        .flags = TF_STOP,
+    },
+    { // from 159: LOC_FOREST15
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST16,
+        .flags = 0,
+    },
+    { // from 159: LOC_FOREST15
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST22,
+        .flags = 0,
+    },
+    { // from 159: LOC_FOREST15
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ROADEND,
+        .flags = 0,
+    },
+    { // from 159: LOC_FOREST15
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST14,
+        .flags = TF_STOP,
+    },
+    { // from 160: LOC_FOREST16
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST17,
+        .flags = 0,
+    },
+    { // from 160: LOC_FOREST16
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST17,
+        .flags = 0,
+    },
+    { // from 160: LOC_FOREST16
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST14,
+        .flags = 0,
+    },
+    { // from 160: LOC_FOREST16
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST15,
+        .flags = TF_STOP,
+    },
+    { // from 161: LOC_FOREST17
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST18,
+        .flags = 0,
+    },
+    { // from 161: LOC_FOREST17
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST16,
+        .flags = 0,
+    },
+    { // from 161: LOC_FOREST17
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST16,
+        .flags = 0,
+    },
+    { // from 161: LOC_FOREST17
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CLIFF,
+        .flags = TF_STOP,
+    },
+    { // from 162: LOC_FOREST18
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST19,
+        .flags = 0,
+    },
+    { // from 162: LOC_FOREST18
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST17,
+        .flags = 0,
+    },
+    { // from 162: LOC_FOREST18
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST2,
+        .flags = 0,
+    },
+    { // from 162: LOC_FOREST18
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST21,
+        .flags = TF_STOP,
+    },
+    { // from 163: LOC_FOREST19
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST2,
+        .flags = 0,
+    },
+    { // from 163: LOC_FOREST19
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST18,
+        .flags = 0,
+    },
+    { // from 163: LOC_FOREST19
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CLIFF,
+        .flags = 0,
+    },
+    { // from 163: LOC_FOREST19
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST20,
+        .flags = TF_STOP,
+    },
+    { // from 164: LOC_FOREST20
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_HILL,
+        .flags = 0,
+    },
+    { // from 164: LOC_FOREST20
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST21,
+        .flags = 0,
+    },
+    { // from 164: LOC_FOREST20
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST19,
+        .flags = 0,
+    },
+    { // from 164: LOC_FOREST20
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST13,
+        .flags = TF_STOP,
+    },
+    { // from 165: LOC_FOREST21
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST20,
+        .flags = 0,
+    },
+    { // from 165: LOC_FOREST21
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_ROADEND,
+        .flags = 0,
+    },
+    { // from 165: LOC_FOREST21
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST18,
+        .flags = 0,
+    },
+    { // from 165: LOC_FOREST21
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST21,
+        .flags = TF_STOP,
+    },
+    { // from 166: LOC_FOREST22
+        .motion = EAST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST8,
+        .flags = 0,
+    },
+    { // from 166: LOC_FOREST22
+        .motion = WEST,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST11,
+        .flags = 0,
+    },
+    { // from 166: LOC_FOREST22
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST15,
+        .flags = 0,
+    },
+    { // from 166: LOC_FOREST22
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOREST12,
+        .flags = TF_STOP,
+    },
+    { // from 167: LOC_LEDGE
+        .motion = MOT_39,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_NOMAKE,
+        .flags = TF_STOP,
+    },
+    { // from 168: LOC_RESBOTTOM
+        .motion = NORTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_RESNORTH,
+        .flags = 0,
+    },
+    { // from 168: LOC_RESBOTTOM
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_RESERVOIR,
+        .flags = TF_STOP,
+    },
+    { // from 169: LOC_RESNORTH
+        .motion = SOUTH,
+        .condtype = cond_not,
+        .condarg1 = 45,
+        .condarg2 = 1,
+        .desttype = dest_speak,
+        .destval = BAD_DIRECTION,
+        .flags = 0,
+    },
+    { // from 169: LOC_RESNORTH
+        .motion = MOT_42,
+        .condtype = cond_not,
+        .condarg1 = 45,
+        .condarg2 = 1,
+        .desttype = dest_speak,
+        .destval = BAD_DIRECTION,
+        .flags = 0,
+    },
+    { // from 169: LOC_RESNORTH
+        .motion = CROSS,
+        .condtype = cond_not,
+        .condarg1 = 45,
+        .condarg2 = 1,
+        .desttype = dest_speak,
+        .destval = BAD_DIRECTION,
+        .flags = 0,
+    },
+    { // from 169: LOC_RESNORTH
+        .motion = SOUTH,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_RESBOTTOM,
+        .flags = 0,
+    },
+    { // from 169: LOC_RESNORTH
+        .motion = NW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_TREACHEROUS,
+        .flags = 0,
+    },
+    { // from 169: LOC_RESNORTH
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_TREACHEROUS,
+        .flags = 0,
+    },
+    { // from 169: LOC_RESNORTH
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_TREACHEROUS,
+        .flags = TF_STOP,
+    },
+    { // from 170: LOC_TREACHEROUS
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_STEEP,
+        .flags = 0,
+    },
+    { // from 170: LOC_TREACHEROUS
+        .motion = NW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_STEEP,
+        .flags = 0,
+    },
+    { // from 170: LOC_TREACHEROUS
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_RESNORTH,
+        .flags = 0,
+    },
+    { // from 170: LOC_TREACHEROUS
+        .motion = SE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_RESNORTH,
+        .flags = TF_STOP,
+    },
+    { // from 171: LOC_STEEP
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_TREACHEROUS,
+        .flags = 0,
+    },
+    { // from 171: LOC_STEEP
+        .motion = SE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_TREACHEROUS,
+        .flags = 0,
+    },
+    { // from 171: LOC_STEEP
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CLIFFBASE,
+        .flags = 0,
+    },
+    { // from 171: LOC_STEEP
+        .motion = NW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CLIFFBASE,
+        .flags = TF_STOP,
+    },
+    { // from 172: LOC_CLIFFBASE
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_STEEP,
+        .flags = 0,
+    },
+    { // from 172: LOC_CLIFFBASE
+        .motion = SE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_STEEP,
+        .flags = 0,
+    },
+    { // from 172: LOC_CLIFFBASE
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CLIFFACE,
+        .flags = 0,
+    },
+    { // from 172: LOC_CLIFFBASE
+        .motion = MOT_56,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CLIFFACE,
+        .flags = TF_STOP,
+    },
+    { // from 173: LOC_CLIFFACE
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CLIFFBASE,
+        .flags = 0,
+    },
+    { // from 173: LOC_CLIFFACE
+        .motion = UP,
+        .condtype = cond_carry,
+        .condarg1 = OBJ_46,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CLIFFTOP,
+        .flags = 0,
+    },
+    { // from 173: LOC_CLIFFACE
+        .motion = UP,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_FOOTSLIP,
+        .flags = TF_STOP,
+    },
+    { // from 174: LOC_FOOTSLIP
+        .motion = 1,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_NOWHERE,
+        .flags = TF_STOP,
+    },
+    { // from 175: LOC_CLIFFTOP
+        .motion = 1,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CLIFFLEDGE,
+        .flags = TF_STOP,
+    },
+    { // from 176: LOC_CLIFFLEDGE
+        .motion = MOT_56,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CLIFFACE,
+        .flags = 0,
+    },
+    { // from 176: LOC_CLIFFLEDGE
+        .motion = DOWN,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CLIFFACE,
+        .flags = 0,
+    },
+    { // from 176: LOC_CLIFFLEDGE
+        .motion = NE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_REACHDEAD,
+        .flags = 0,
+    },
+    { // from 176: LOC_CLIFFLEDGE
+        .motion = CRAWL,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_REACHDEAD,
+        .flags = TF_STOP,
+    },
+    { // from 177: LOC_REACHDEAD
+        .motion = SW,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CLIFFLEDGE,
+        .flags = 0,
+    },
+    { // from 177: LOC_REACHDEAD
+        .motion = OUTSIDE,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CLIFFLEDGE,
+        .flags = 0,
+    },
+    { // from 177: LOC_REACHDEAD
+        .motion = CRAWL,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_CLIFFLEDGE,
+        .flags = TF_STOP,
+    },
+    { // from 178: LOC_GRUESOME
+        .motion = 1,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_NOWHERE,
+        .flags = TF_STOP,
+    },
+    { // from 179: LOC_FOOF1
+        .motion = 1,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_DEBRIS,
+        .flags = TF_STOP,
+    },
+    { // from 180: LOC_FOOF2
+        .motion = 1,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BUILDING,
+        .flags = TF_STOP,
+    },
+    { // from 181: LOC_FOOF3
+        .motion = 1,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_Y2,
+        .flags = TF_STOP,
+    },
+    { // from 182: LOC_FOOF4
+        .motion = 1,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_BUILDING,
+        .flags = TF_STOP,
+    },
+    { // from 183: LOC_FOOF5
+        .motion = 1,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_PLOVER,
+        .flags = TF_STOP,
+    },
+    { // from 184: LOC_FOOF6
+        .motion = 1,
+        .condtype = cond_goto,
+        .condarg1 = 0,
+        .condarg2 = 0,
+        .desttype = dest_goto,
+        .destval = LOC_Y2,
+        .flags = TF_STOP,
+    },
+};
+
+const unsigned char travel_index[][NMOTIONS] = {
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_NOWHERE
+    {0, 0, 1, 4, 0, 8, 13, 0, 0, 0, 0, 0, 5, 9, 10, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 12, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 2, 14, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_START
+    {0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_HILL
+    {0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 1, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_BUILDING
+    {0, 0, 0, 0, 1, 7, 5, 0, 0, 0, 0, 0, 2, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 6, 3, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_VALLEY
+    {0, 0, 1, 0, 0, 0, 6, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 7, 8, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_ROADEND
+    {0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 3, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_CLIFF
+    {0, 0, 0, 15, 2, 7, 5, 0, 0, 0, 0, 0, 1, 0, 12, 0, 8, 0, 0, 14, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 6, 3, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_SLIT
+    {0, 0, 0, 9, 6, 0, 2, 0, 0, 0, 0, 0, 5, 7, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 8, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_GRATE
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 4, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_BELOWGRATE
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 4, 2, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 6, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_COBBLE
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 9, 0, 0, 0, 5, 6, 8, 0, 0, 0, 10, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_DEBRIS
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 3, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_AWKWARD
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 4, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 8, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_BIRD
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 6, 7, 0, 10, 8, 0, 0, 0, 0, 0, 0, 0, 0, 5, 11, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_PITTOP
+    {0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 9, 7, 10, 0, 0, 11, 12, 1, 0, 4, 0, 0, 0, 0, 14, 5, 8, 2, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_MISTHALL
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // LOC_CRACK
+    {0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 0, 5, 6, 2, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0}, // LOC_EASTBANK
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_NUGGET
+    {0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 7, 5, 0, 0, 0, 0, 0, 3, 8, 4, 6, 0, 0, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_KINGHALL
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // LOC_NECKBROKE
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // LOC_NOMAKE
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // LOC_DOME
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 3, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_WESTEND
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_EASTPIT
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_WESTPIT
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // LOC_CLIMBSTALK
+    {0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 3, 4, 5, 9, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0}, // LOC_WESTBANK
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 4, 3, 0, 0, 0, 0, 0, 7, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_FLOORHOLE
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_SOUTHSIDE
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_WESTSIDE
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // LOC_BUILDING1
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // LOC_SNAKEBLOCK
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 6, 0, 2, 0, 0, 0, 0, 0, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0}, // LOC_Y2
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_JUMBLE
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_WINDOW1
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 5, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0}, // LOC_BROKEN
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_SMALLPITBRINK
+    {0, 0, 0, 9, 7, 8, 0, 0, 0, 0, 0, 3, 0, 0, 5, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_SMALLPIT
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0}, // LOC_DUSTY
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // LOC_PARALLEL1
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 7, 6, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_MISTWEST
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 5, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_ALIKE1
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_ALIKE2
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_ALIKE3
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_ALIKE4
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_DEADEND1
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_DEADEND2
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_DEADEND3
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_ALIKE5
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_ALIKE6
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_ALIKE7
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 5, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_ALIKE8
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_ALIKE9
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_DEADEND4
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_ALIKE10
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_DEADEND5
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 3, 5, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_PITBRINK
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_DEADEND6
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // LOC_PARALLEL2
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 5, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_LONGEAST
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_LONGWEST
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_CROSSOVER
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_DEADEND7
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 4, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 7, 0, 0}, // LOC_COMPLEX
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 8, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_BEDQUILT
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 2, 0, 3, 1, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0}, // LOC_SWISSCHEESE
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_EASTEND
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_SLAB
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0}, // LOC_SECRET1
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_SECRET2
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_THREEJUNCTION
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 4, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 5, 0, 0, 0, 0}, // LOC_LOWROOM
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_DEADCRAWL
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_SECRET3
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_WIDEPLACE
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_TIGHTPLACE
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_TALL
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_BOULDERS1
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // LOC_SEWER
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 2, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_ALIKE11
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_DEADEND8
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_DEADEND9
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_ALIKE12
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_ALIKE13
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_DEADEND10
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_DEADEND11
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_ALIKE14
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 3, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_NARROW
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // LOC_NOCLIMB
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // LOC_PLANTTOP
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0}, // LOC_INCLINE
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_GIANTROOM
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_CAVEIN
+    {0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0}, // LOC_IMMENSE
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_WATERFALL
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_SOFTROOM
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 5, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0}, // LOC_ORIENTAL
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0}, // LOC_MISTY
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0}, // LOC_ALCOVE
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0}, // LOC_PLOVER
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0}, // LOC_DARKROOM
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0}, // LOC_ARCHED
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_SHELLROOM
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0}, // LOC_SLOPING1
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0}, // LOC_CULDESAC
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_ANTEROOM
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 8, 9, 1, 3, 4, 2, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_DIFFERENT1
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 11, 2, 3, 4, 5, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_WITTSEND
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0}, // LOC_MIRRORCANYON
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_WINDOW2
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_TOPSTALACTITE
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 7, 2, 10, 6, 5, 1, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_DIFFERENT2
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0}, // LOC_RESERVOIR
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_DEADEND12
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_NE
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_SW
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 2, 3, 0, 0, 0, 0, 5, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0}, // LOC_SWCHASM
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_WINDING
+    {0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_SECRET4
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_SECRET5
+    {0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_SECRET6
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 10, 2, 3, 0, 0, 0, 0, 1, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0}, // LOC_NECHASM
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_CORRIDOR
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 6, 0, 0, 0, 0, 0, 3, 5, 0, 0, 8, 0, 0, 0, 1, 0, 0, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_FORK
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_WARMWALLS
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_BREATHTAKING
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 4, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_BOULDERS2
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 2, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 1, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_LIMESTONE
+    {0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 8, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_BARRENFRONT
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_BARRENROOM
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 1, 8, 9, 5, 2, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_DIFFERENT3
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 5, 3, 4, 7, 10, 6, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_DIFFERENT4
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 3, 7, 10, 4, 9, 5, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_DIFFERENT5
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 9, 2, 7, 1, 4, 10, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_DIFFERENT6
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 6, 1, 4, 8, 2, 7, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_DIFFERENT7
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 10, 6, 9, 8, 4, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_DIFFERENT8
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 5, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 10, 7, 3, 2, 1, 8, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_DIFFERENT9
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 5, 6, 7, 3, 8, 9, 10, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_DIFFERENT10
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 4, 5, 9, 10, 7, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_DIFFERENT11
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_DEADEND13
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_ROUGHHEWN
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // LOC_BADDIRECTION
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_LARGE
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_STOREROOM
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_FOREST1
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_FOREST2
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_FOREST3
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_FOREST4
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_FOREST5
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_FOREST6
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_FOREST7
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_FOREST8
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_FOREST9
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_FOREST10
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_FOREST11
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_FOREST12
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_FOREST13
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_FOREST14
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_FOREST15
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_FOREST16
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 4, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_FOREST17
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_FOREST18
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_FOREST19
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_FOREST20
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_FOREST21
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_FOREST22
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_LEDGE
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_RESBOTTOM
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0}, // LOC_RESNORTH
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_TREACHEROUS
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_STEEP
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_CLIFFBASE
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_CLIFFACE
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // LOC_FOOTSLIP
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // LOC_CLIFFTOP
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_CLIFFLEDGE
+    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}, // LOC_REACHDEAD
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // LOC_GRUESOME
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // LOC_FOOF1
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // LOC_FOOF2
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // LOC_FOOF3
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // LOC_FOOF4
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // LOC_FOOF5
+    {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}, // LOC_FOOF6
+};
+
+const long forced_dest[] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, 14, -1, -1, -1,
+    0, 0, 15, -1, -1, -1, 88, -1, -1, -1,
+    -1, -1, 19, -1, -1, -1, -1, -1, -1, -1,
+    41, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 27,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 3,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, 25,
+    23, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, 140, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, 0, 176, -1, -1, 0, 11,
+    3, 33, 3, 100, 33
+};
+
+const dwarfmoves_t dwarf_moves[] = {
+    { // LOC_NOWHERE
+        .dwarves = 805,
+        .pirate = 806,
+        .newloc = LOC_NOWHERE,
+    },
+    { // LOC_START
+        .dwarves = 807,
+        .pirate = 808,
+        .newloc = LOC_GRATE,
+    },
+    { // LOC_HILL
+        .dwarves = 809,
+        .pirate = 810,
+        .newloc = WHICH_WAY,
+    },
+    { // LOC_BUILDING
+        .dwarves = 811,
+        .pirate = 812,
+        .newloc = LOC_SEWER,
+    },
+    { // LOC_VALLEY
+        .dwarves = 813,
+        .pirate = 814,
+        .newloc = UPSTREAM_DOWNSTREAM,
+    },
+    { // LOC_ROADEND
+        .dwarves = 815,
+        .pirate = 816,
+        .newloc = LOC_FOREST21,
+    },
+    { // LOC_CLIFF
+        .dwarves = 817,
+        .pirate = 818,
+        .newloc = LOC_NOMAKE,
+    },
+    { // LOC_SLIT
+        .dwarves = 819,
+        .pirate = 820,
+        .newloc = DONT_FIT,
+    },
+    { // LOC_GRATE
+        .dwarves = 821,
+        .pirate = 822,
+        .newloc = GRATE_NOWAY,
+    },
+    { // LOC_BELOWGRATE
+        .dwarves = 823,
+        .pirate = 824,
+        .newloc = LOC_DEBRIS,
+    },
+    { // LOC_COBBLE
+        .dwarves = 825,
+        .pirate = 826,
+        .newloc = LOC_PITTOP,
+    },
+    { // LOC_DEBRIS
+        .dwarves = 827,
+        .pirate = 828,
+        .newloc = LOC_PITTOP,
+    },
+    { // LOC_AWKWARD
+        .dwarves = 829,
+        .pirate = 830,
+        .newloc = LOC_PITTOP,
+    },
+    { // LOC_BIRD
+        .dwarves = 831,
+        .pirate = 832,
+        .newloc = LOC_PITTOP,
+    },
+    { // LOC_PITTOP
+        .dwarves = 833,
+        .pirate = 835,
+        .newloc = LOC_CRACK,
+    },
+    { // LOC_MISTHALL
+        .dwarves = 837,
+        .pirate = 842,
+        .newloc = LOC_JUMBLE,
+    },
+    { // LOC_CRACK
+        .dwarves = 847,
+        .pirate = 848,
+        .newloc = LOC_PITTOP,
+    },
+    { // LOC_EASTBANK
+        .dwarves = 849,
+        .pirate = 852,
+        .newloc = LOC_WESTBANK,
+    },
+    { // LOC_NUGGET
+        .dwarves = 855,
+        .pirate = 857,
+        .newloc = LOC_MISTHALL,
+    },
+    { // LOC_KINGHALL
+        .dwarves = 859,
+        .pirate = 865,
+        .newloc = LOC_SECRET3,
+    },
+    { // LOC_NECKBROKE
+        .dwarves = 871,
+        .pirate = 872,
+        .newloc = LOC_NOWHERE,
+    },
+    { // LOC_NOMAKE
+        .dwarves = 873,
+        .pirate = 874,
+        .newloc = LOC_NOWHERE,
+    },
+    { // LOC_DOME
+        .dwarves = 875,
+        .pirate = 877,
+        .newloc = LOC_MISTHALL,
+    },
+    { // LOC_WESTEND
+        .dwarves = 879,
+        .pirate = 883,
+        .newloc = TOO_FAR,
+    },
+    { // LOC_EASTPIT
+        .dwarves = 887,
+        .pirate = 889,
+        .newloc = LOC_EASTEND,
+    },
+    { // LOC_WESTPIT
+        .dwarves = 891,
+        .pirate = 893,
+        .newloc = LOC_CLIMBSTALK,
+    },
+    { // LOC_CLIMBSTALK
+        .dwarves = 895,
+        .pirate = 897,
+        .newloc = LOC_NARROW,
+    },
+    { // LOC_WESTBANK
+        .dwarves = 899,
+        .pirate = 902,
+        .newloc = LOC_MISTWEST,
+    },
+    { // LOC_FLOORHOLE
+        .dwarves = 905,
+        .pirate = 909,
+        .newloc = LOC_BROKEN,
+    },
+    { // LOC_SOUTHSIDE
+        .dwarves = 913,
+        .pirate = 915,
+        .newloc = LOC_KINGHALL,
+    },
+    { // LOC_WESTSIDE
+        .dwarves = 917,
+        .pirate = 920,
+        .newloc = LOC_CROSSOVER,
+    },
+    { // LOC_BUILDING1
+        .dwarves = 923,
+        .pirate = 924,
+        .newloc = LOC_PLANTTOP,
+    },
+    { // LOC_SNAKEBLOCK
+        .dwarves = 925,
+        .pirate = 927,
+        .newloc = LOC_KINGHALL,
+    },
+    { // LOC_Y2
+        .dwarves = 929,
+        .pirate = 933,
+        .newloc = LOC_FOOF5,
+    },
+    { // LOC_JUMBLE
+        .dwarves = 937,
+        .pirate = 940,
+        .newloc = LOC_MISTHALL,
+    },
+    { // LOC_WINDOW1
+        .dwarves = 943,
+        .pirate = 945,
+        .newloc = LOC_NECKBROKE,
+    },
+    { // LOC_BROKEN
+        .dwarves = 947,
+        .pirate = 952,
+        .newloc = LOC_BEDQUILT,
+    },
+    { // LOC_SMALLPITBRINK
+        .dwarves = 957,
+        .pirate = 960,
+        .newloc = LOC_SMALLPIT,
+    },
+    { // LOC_SMALLPIT
+        .dwarves = 963,
+        .pirate = 965,
+        .newloc = DONT_FIT,
+    },
+    { // LOC_DUSTY
+        .dwarves = 967,
+        .pirate = 971,
+        .newloc = LOC_BEDQUILT,
+    },
+    { // LOC_PARALLEL1
+        .dwarves = 975,
+        .pirate = 977,
+        .newloc = LOC_MISTWEST,
+    },
+    { // LOC_MISTWEST
+        .dwarves = 979,
+        .pirate = 983,
+        .newloc = LOC_LONGEAST,
+    },
+    { // LOC_ALIKE1
+        .dwarves = 987,
+        .pirate = 992,
+        .newloc = LOC_ALIKE11,
+    },
+    { // LOC_ALIKE2
+        .dwarves = 997,
+        .pirate = 1001,
+        .newloc = LOC_ALIKE4,
+    },
+    { // LOC_ALIKE3
+        .dwarves = 1005,
+        .pirate = 1010,
+        .newloc = LOC_DEADEND9,
+    },
+    { // LOC_ALIKE4
+        .dwarves = 1013,
+        .pirate = 1019,
+        .newloc = LOC_ALIKE14,
+    },
+    { // LOC_DEADEND1
+        .dwarves = 1023,
+        .pirate = 1025,
+        .newloc = LOC_ALIKE4,
+    },
+    { // LOC_DEADEND2
+        .dwarves = 1027,
+        .pirate = 1029,
+        .newloc = LOC_ALIKE4,
+    },
+    { // LOC_DEADEND3
+        .dwarves = 1031,
+        .pirate = 1033,
+        .newloc = LOC_ALIKE3,
+    },
+    { // LOC_ALIKE5
+        .dwarves = 1035,
+        .pirate = 1038,
+        .newloc = LOC_ALIKE7,
+    },
+    { // LOC_ALIKE6
+        .dwarves = 1041,
+        .pirate = 1046,
+        .newloc = LOC_ALIKE8,
+    },
+    { // LOC_ALIKE7
+        .dwarves = 1051,
+        .pirate = 1056,
+        .newloc = LOC_ALIKE9,
+    },
+    { // LOC_ALIKE8
+        .dwarves = 1061,
+        .pirate = 1067,
+        .newloc = LOC_DEADEND11,
+    },
+    { // LOC_ALIKE9
+        .dwarves = 1072,
+        .pirate = 1076,
+        .newloc = LOC_DEADEND4,
+    },
+    { // LOC_DEADEND4
+        .dwarves = 1079,
+        .pirate = 1081,
+        .newloc = LOC_ALIKE9,
+    },
+    { // LOC_ALIKE10
+        .dwarves = 1083,
+        .pirate = 1087,
+        .newloc = LOC_PITBRINK,
+    },
+    { // LOC_DEADEND5
+        .dwarves = 1090,
+        .pirate = 1092,
+        .newloc = LOC_ALIKE10,
+    },
+    { // LOC_PITBRINK
+        .dwarves = 1094,
+        .pirate = 1099,
+        .newloc = LOC_ALIKE13,
+    },
+    { // LOC_DEADEND6
+        .dwarves = 1103,
+        .pirate = 1105,
+        .newloc = LOC_PITBRINK,
+    },
+    { // LOC_PARALLEL2
+        .dwarves = 1107,
+        .pirate = 1109,
+        .newloc = LOC_WESTBANK,
+    },
+    { // LOC_LONGEAST
+        .dwarves = 1111,
+        .pirate = 1115,
+        .newloc = LOC_CROSSOVER,
+    },
+    { // LOC_LONGWEST
+        .dwarves = 1119,
+        .pirate = 1122,
+        .newloc = LOC_DIFFERENT1,
+    },
+    { // LOC_CROSSOVER
+        .dwarves = 1125,
+        .pirate = 1130,
+        .newloc = LOC_LONGWEST,
+    },
+    { // LOC_DEADEND7
+        .dwarves = 1135,
+        .pirate = 1137,
+        .newloc = LOC_CROSSOVER,
+    },
+    { // LOC_COMPLEX
+        .dwarves = 1139,
+        .pirate = 1144,
+        .newloc = LOC_ANTEROOM,
+    },
+    { // LOC_BEDQUILT
+        .dwarves = 1149,
+        .pirate = 1158,
+        .newloc = LOC_ANTEROOM,
+    },
+    { // LOC_SWISSCHEESE
+        .dwarves = 1167,
+        .pirate = 1173,
+        .newloc = LOC_ORIENTAL,
+    },
+    { // LOC_EASTEND
+        .dwarves = 1179,
+        .pirate = 1183,
+        .newloc = LOC_EASTPIT,
+    },
+    { // LOC_SLAB
+        .dwarves = 1187,
+        .pirate = 1191,
+        .newloc = LOC_BEDQUILT,
+    },
+    { // LOC_SECRET1
+        .dwarves = 1195,
+        .pirate = 1201,
+        .newloc = LOC_RESERVOIR,
+    },
+    { // LOC_SECRET2
+        .dwarves = 1207,
+        .pirate = 1211,
+        .newloc = LOC_TOPSTALACTITE,
+    },
+    { // LOC_THREEJUNCTION
+        .dwarves = 1215,
+        .pirate = 1219,
+        .newloc = LOC_WINDOW2,
+    },
+    { // LOC_LOWROOM
+        .dwarves = 1223,
+        .pirate = 1228,
+        .newloc = LOC_ORIENTAL,
+    },
+    { // LOC_DEADCRAWL
+        .dwarves = 1233,
+        .pirate = 1235,
+        .newloc = LOC_LOWROOM,
+    },
+    { // LOC_SECRET3
+        .dwarves = 1237,
+        .pirate = 1242,
+        .newloc = LOC_WIDEPLACE,
+    },
+    { // LOC_WIDEPLACE
+        .dwarves = 1247,
+        .pirate = 1250,
+        .newloc = LOC_TALL,
+    },
+    { // LOC_TIGHTPLACE
+        .dwarves = 1253,
+        .pirate = 1255,
+        .newloc = LOC_WIDEPLACE,
+    },
+    { // LOC_TALL
+        .dwarves = 1257,
+        .pirate = 1261,
+        .newloc = LOC_SWISSCHEESE,
+    },
+    { // LOC_BOULDERS1
+        .dwarves = 1265,
+        .pirate = 1267,
+        .newloc = LOC_TALL,
+    },
+    { // LOC_SEWER
+        .dwarves = 1269,
+        .pirate = 1270,
+        .newloc = LOC_BUILDING,
+    },
+    { // LOC_ALIKE11
+        .dwarves = 1271,
+        .pirate = 1274,
+        .newloc = LOC_DEADEND8,
+    },
+    { // LOC_DEADEND8
+        .dwarves = 1277,
+        .pirate = 1279,
+        .newloc = LOC_ALIKE11,
+    },
+    { // LOC_DEADEND9
+        .dwarves = 1281,
+        .pirate = 1283,
+        .newloc = LOC_ALIKE3,
+    },
+    { // LOC_ALIKE12
+        .dwarves = 1285,
+        .pirate = 1289,
+        .newloc = LOC_DEADEND10,
+    },
+    { // LOC_ALIKE13
+        .dwarves = 1292,
+        .pirate = 1296,
+        .newloc = LOC_DEADEND12,
+    },
+    { // LOC_DEADEND10
+        .dwarves = 1300,
+        .pirate = 1302,
+        .newloc = LOC_ALIKE12,
+    },
+    { // LOC_DEADEND11
+        .dwarves = 1304,
+        .pirate = 1306,
+        .newloc = LOC_ALIKE8,
+    },
+    { // LOC_ALIKE14
+        .dwarves = 1308,
+        .pirate = 1310,
+        .newloc = LOC_ALIKE4,
+    },
+    { // LOC_NARROW
+        .dwarves = 1312,
+        .pirate = 1315,
+        .newloc = LOC_GIANTROOM,
+    },
+    { // LOC_NOCLIMB
+        .dwarves = 1318,
+        .pirate = 1320,
+        .newloc = LOC_WESTPIT,
+    },
+    { // LOC_PLANTTOP
+        .dwarves = 1322,
+        .pirate = 1324,
+        .newloc = LOC_WESTEND,
+    },
+    { // LOC_INCLINE
+        .dwarves = 1326,
+        .pirate = 1329,
+        .newloc = LOC_LOWROOM,
+    },
+    { // LOC_GIANTROOM
+        .dwarves = 1332,
+        .pirate = 1336,
+        .newloc = LOC_IMMENSE,
+    },
+    { // LOC_CAVEIN
+        .dwarves = 1340,
+        .pirate = 1342,
+        .newloc = LOC_GIANTROOM,
+    },
+    { // LOC_IMMENSE
+        .dwarves = 1344,
+        .pirate = 1347,
+        .newloc = RUSTY_DOOR,
+    },
+    { // LOC_WATERFALL
+        .dwarves = 1350,
+        .pirate = 1354,
+        .newloc = LOC_INCLINE,
+    },
+    { // LOC_SOFTROOM
+        .dwarves = 1358,
+        .pirate = 1360,
+        .newloc = LOC_SWISSCHEESE,
+    },
+    { // LOC_ORIENTAL
+        .dwarves = 1362,
+        .pirate = 1366,
+        .newloc = LOC_MISTY,
+    },
+    { // LOC_MISTY
+        .dwarves = 1370,
+        .pirate = 1373,
+        .newloc = LOC_ALCOVE,
+    },
+    { // LOC_ALCOVE
+        .dwarves = 1376,
+        .pirate = 1379,
+        .newloc = LOC_PLOVER,
+    },
+    { // LOC_PLOVER
+        .dwarves = 1382,
+        .pirate = 1385,
+        .newloc = LOC_DARKROOM,
+    },
+    { // LOC_DARKROOM
+        .dwarves = 1388,
+        .pirate = 1390,
+        .newloc = LOC_PLOVER,
+    },
+    { // LOC_ARCHED
+        .dwarves = 1392,
+        .pirate = 1394,
+        .newloc = LOC_SHELLROOM,
+    },
+    { // LOC_SHELLROOM
+        .dwarves = 1396,
+        .pirate = 1400,
+        .newloc = LOC_COMPLEX,
+    },
+    { // LOC_SLOPING1
+        .dwarves = 1404,
+        .pirate = 1407,
+        .newloc = LOC_CULDESAC,
+    },
+    { // LOC_CULDESAC
+        .dwarves = 1410,
+        .pirate = 1413,
+        .newloc = LOC_SHELLROOM,
+    },
+    { // LOC_ANTEROOM
+        .dwarves = 1416,
+        .pirate = 1420,
+        .newloc = LOC_WITTSEND,
+    },
+    { // LOC_DIFFERENT1
+        .dwarves = 1424,
+        .pirate = 1435,
+        .newloc = LOC_LONGWEST,
+    },
+    { // LOC_WITTSEND
+        .dwarves = 1446,
+        .pirate = 1448,
+        .newloc = WAY_BLOCKED,
+    },
+    { // LOC_MIRRORCANYON
+        .dwarves = 1450,
+        .pirate = 1453,
+        .newloc = LOC_RESERVOIR,
+    },
+    { // LOC_WINDOW2
+        .dwarves = 1456,
+        .pirate = 1458,
+        .newloc = LOC_NECKBROKE,
+    },
+    { // LOC_TOPSTALACTITE
+        .dwarves = 1460,
+        .pirate = 1465,
+        .newloc = LOC_ALIKE4,
+    },
+    { // LOC_DIFFERENT2
+        .dwarves = 1470,
+        .pirate = 1481,
+        .newloc = LOC_DEADEND13,
+    },
+    { // LOC_RESERVOIR
+        .dwarves = 1492,
+        .pirate = 1495,
+        .newloc = LOC_RESBOTTOM,
+    },
+    { // LOC_DEADEND12
+        .dwarves = 1498,
+        .pirate = 1500,
+        .newloc = LOC_ALIKE13,
+    },
+    { // LOC_NE
+        .dwarves = 1502,
+        .pirate = 1504,
+        .newloc = LOC_SW,
+    },
+    { // LOC_SW
+        .dwarves = 1506,
+        .pirate = 1508,
+        .newloc = GRATE_NOWAY,
+    },
+    { // LOC_SWCHASM
+        .dwarves = 1510,
+        .pirate = 1512,
+        .newloc = CROSS_BRIDGE,
+    },
+    { // LOC_WINDING
+        .dwarves = 1514,
+        .pirate = 1517,
+        .newloc = LOC_SWCHASM,
+    },
+    { // LOC_SECRET4
+        .dwarves = 1520,
+        .pirate = 1522,
+        .newloc = NASTY_DRAGON,
+    },
+    { // LOC_SECRET5
+        .dwarves = 1524,
+        .pirate = 1527,
+        .newloc = LOC_SECRET3,
+    },
+    { // LOC_SECRET6
+        .dwarves = 1530,
+        .pirate = 1532,
+        .newloc = NASTY_DRAGON,
+    },
+    { // LOC_NECHASM
+        .dwarves = 1534,
+        .pirate = 1539,
+        .newloc = LOC_BARRENFRONT,
+    },
+    { // LOC_CORRIDOR
+        .dwarves = 1540,
+        .pirate = 1545,
+        .newloc = LOC_BARRENFRONT,
+    },
+    { // LOC_FORK
+        .dwarves = 1546,
+        .pirate = 1552,
+        .newloc = LOC_BARRENFRONT,
+    },
+    { // LOC_WARMWALLS
+        .dwarves = 1553,
+        .pirate = 1557,
+        .newloc = LOC_BOULDERS2,
+    },
+    { // LOC_BREATHTAKING
+        .dwarves = 1558,
+        .pirate = 1561,
+        .newloc = LOC_GRUESOME,
+    },
+    { // LOC_BOULDERS2
+        .dwarves = 1562,
+        .pirate = 1566,
+        .newloc = LOC_BREATHTAKING,
+    },
+    { // LOC_LIMESTONE
+        .dwarves = 1567,
+        .pirate = 1571,
+        .newloc = LOC_BREATHTAKING,
+    },
+    { // LOC_BARRENFRONT
+        .dwarves = 1572,
+        .pirate = 1577,
+        .newloc = LOC_BREATHTAKING,
+    },
+    { // LOC_BARRENROOM
+        .dwarves = 1578,
+        .pirate = 1582,
+        .newloc = LOC_BREATHTAKING,
+    },
+    { // LOC_DIFFERENT3
+        .dwarves = 1583,
+        .pirate = 1594,
+        .newloc = LOC_DIFFERENT2,
+    },
+    { // LOC_DIFFERENT4
+        .dwarves = 1605,
+        .pirate = 1616,
+        .newloc = LOC_DIFFERENT2,
+    },
+    { // LOC_DIFFERENT5
+        .dwarves = 1627,
+        .pirate = 1638,
+        .newloc = LOC_DIFFERENT2,
+    },
+    { // LOC_DIFFERENT6
+        .dwarves = 1649,
+        .pirate = 1660,
+        .newloc = LOC_DIFFERENT2,
+    },
+    { // LOC_DIFFERENT7
+        .dwarves = 1671,
+        .pirate = 1682,
+        .newloc = LOC_DIFFERENT2,
+    },
+    { // LOC_DIFFERENT8
+        .dwarves = 1693,
+        .pirate = 1704,
+        .newloc = LOC_DIFFERENT2,
+    },
+    { // LOC_DIFFERENT9
+        .dwarves = 1715,
+        .pirate = 1726,
+        .newloc = LOC_DIFFERENT2,
+    },
+    { // LOC_DIFFERENT10
+        .dwarves = 1737,
+        .pirate = 1748,
+        .newloc = LOC_DIFFERENT2,
+    },
+    { // LOC_DIFFERENT11
+        .dwarves = 1759,
+        .pirate = 1770,
+        .newloc = LOC_DIFFERENT2,
+    },
+    { // LOC_DEADEND13
+        .dwarves = 1781,
+        .pirate = 1784,
+        .newloc = LOC_BADDIRECTION,
+    },
+    { // LOC_ROUGHHEWN
+        .dwarves = 1787,
+        .pirate = 1790,
+        .newloc = LOC_LARGE,
+    },
+    { // LOC_BADDIRECTION
+        .dwarves = 1793,
+        .pirate = 1795,
+        .newloc = LOC_DEADEND13,
+    },
+    { // LOC_LARGE
+        .dwarves = 1797,
+        .pirate = 1800,
+        .newloc = LOC_STOREROOM,
+    },
+    { // LOC_STOREROOM
+        .dwarves = 1803,
+        .pirate = 1805,
+        .newloc = LOC_LARGE,
+    },
+    { // LOC_FOREST1
+        .dwarves = 1807,
+        .pirate = 1808,
+        .newloc = LOC_FOREST3,
+    },
+    { // LOC_FOREST2
+        .dwarves = 1809,
+        .pirate = 1810,
+        .newloc = LOC_FOREST18,
+    },
+    { // LOC_FOREST3
+        .dwarves = 1811,
+        .pirate = 1812,
+        .newloc = LOC_FOREST1,
+    },
+    { // LOC_FOREST4
+        .dwarves = 1813,
+        .pirate = 1814,
+        .newloc = LOC_FOREST5,
+    },
+    { // LOC_FOREST5
+        .dwarves = 1815,
+        .pirate = 1816,
+        .newloc = LOC_FOREST6,
+    },
+    { // LOC_FOREST6
+        .dwarves = 1817,
+        .pirate = 1818,
+        .newloc = LOC_SLIT,
+    },
+    { // LOC_FOREST7
+        .dwarves = 1819,
+        .pirate = 1820,
+        .newloc = LOC_FOREST8,
+    },
+    { // LOC_FOREST8
+        .dwarves = 1821,
+        .pirate = 1822,
+        .newloc = LOC_FOREST7,
+    },
+    { // LOC_FOREST9
+        .dwarves = 1823,
+        .pirate = 1824,
+        .newloc = LOC_GRATE,
+    },
+    { // LOC_FOREST10
+        .dwarves = 1825,
+        .pirate = 1826,
+        .newloc = LOC_GRATE,
+    },
+    { // LOC_FOREST11
+        .dwarves = 1827,
+        .pirate = 1828,
+        .newloc = LOC_FOREST9,
+    },
+    { // LOC_FOREST12
+        .dwarves = 1829,
+        .pirate = 1830,
+        .newloc = LOC_VALLEY,
+    },
+    { // LOC_FOREST13
+        .dwarves = 1831,
+        .pirate = 1832,
+        .newloc = LOC_HILL,
+    },
+    { // LOC_FOREST14
+        .dwarves = 1833,
+        .pirate = 1834,
+        .newloc = LOC_FOREST12,
+    },
+    { // LOC_FOREST15
+        .dwarves = 1835,
+        .pirate = 1836,
+        .newloc = LOC_FOREST14,
+    },
+    { // LOC_FOREST16
+        .dwarves = 1837,
+        .pirate = 1838,
+        .newloc = LOC_FOREST15,
+    },
+    { // LOC_FOREST17
+        .dwarves = 1839,
+        .pirate = 1840,
+        .newloc = LOC_CLIFF,
+    },
+    { // LOC_FOREST18
+        .dwarves = 1841,
+        .pirate = 1842,
+        .newloc = LOC_FOREST21,
+    },
+    { // LOC_FOREST19
+        .dwarves = 1843,
+        .pirate = 1844,
+        .newloc = LOC_FOREST20,
+    },
+    { // LOC_FOREST20
+        .dwarves = 1845,
+        .pirate = 1846,
+        .newloc = LOC_FOREST13,
+    },
+    { // LOC_FOREST21
+        .dwarves = 1847,
+        .pirate = 1848,
+        .newloc = LOC_FOREST21,
+    },
+    { // LOC_FOREST22
+        .dwarves = 1849,
+        .pirate = 1850,
+        .newloc = LOC_FOREST12,
+    },
+    { // LOC_LEDGE
+        .dwarves = 1851,
+        .pirate = 1852,
+        .newloc = LOC_NOMAKE,
+    },
+    { // LOC_RESBOTTOM
+        .dwarves = 1853,
+        .pirate = 1856,
+        .newloc = LOC_RESERVOIR,
+    },
+    { // LOC_RESNORTH
+        .dwarves = 1859,
+        .pirate = 1862,
+        .newloc = LOC_TREACHEROUS,
+    },
+    { // LOC_TREACHEROUS
+        .dwarves = 1865,
+        .pirate = 1868,
+        .newloc = LOC_RESNORTH,
+    },
+    { // LOC_STEEP
+        .dwarves = 1871,
+        .pirate = 1874,
+        .newloc = LOC_CLIFFBASE,
+    },
+    { // LOC_CLIFFBASE
+        .dwarves = 1877,
+        .pirate = 1880,
+        .newloc = LOC_CLIFFACE,
+    },
+    { // LOC_CLIFFACE
+        .dwarves = 1883,
+        .pirate = 1885,
+        .newloc = LOC_FOOTSLIP,
+    },
+    { // LOC_FOOTSLIP
+        .dwarves = 1887,
+        .pirate = 1888,
+        .newloc = LOC_NOWHERE,
+    },
+    { // LOC_CLIFFTOP
+        .dwarves = 1889,
+        .pirate = 1891,
+        .newloc = LOC_CLIFFLEDGE,
+    },
+    { // LOC_CLIFFLEDGE
+        .dwarves = 1893,
+        .pirate = 1896,
+        .newloc = LOC_REACHDEAD,
+    },
+    { // LOC_REACHDEAD
+        .dwarves = 1899,
+        .pirate = 1901,
+        .newloc = LOC_CLIFFLEDGE,
+    },
+    { // LOC_GRUESOME
+        .dwarves = 1903,
+        .pirate = 1904,
+        .newloc = LOC_NOWHERE,
+    },
+    { // LOC_FOOF1
+        .dwarves = 1905,
+        .pirate = 1906,
+        .newloc = LOC_DEBRIS,
+    },
+    { // LOC_FOOF2
+        .dwarves = 1907,
+        .pirate = 1908,
+        .newloc = LOC_BUILDING,
+    },
+    { // LOC_FOOF3
+        .dwarves = 1909,
+        .pirate = 1911,
+        .newloc = LOC_Y2,
+    },
+    { // LOC_FOOF4
+        .dwarves = 1913,
+        .pirate = 1914,
+        .newloc = LOC_BUILDING,
+    },
+    { // LOC_FOOF5
+        .dwarves = 1915,
+        .pirate = 1917,
+        .newloc = LOC_PLOVER,
+    },
+    { // LOC_FOOF6
+        .dwarves = 1919,
+        .pirate = 1921,
+        .newloc = LOC_Y2,
+    },
+};
+
+const vocab_entry_t vocabulary[] = {
+    { // yes
+        .key = 0x736579,
+        .match = {{ACTION, 55}, {ACTION, 55}},
+    },
+    { // right
+        .key = 0x7468676972,
+        .match = {{MOTION, 37}, {MOTION, 37}},
+    },
+    { // surfa
+        .key = 0x6166727573,
+        .match = {{MOTION, 20}, {MOTION, 20}},
+    },
+    { // "spel
+        .key = 0x6c65707322,
+        .match = {{OBJECT, 16}, {OBJECT, 16}},
+    },
+    {0},
+    {0},
+    {0},
+    { // score
+        .key = 0x65726f6373,
+        .match = {{ACTION, 24}, {ACTION, 24}},
+    },
+    { // snake
+        .key = 0x656b616e73,
+        .match = {{OBJECT, 11}, {OBJECT, 11}},
+    },
+    { // out
+        .key = 0x74756f,
+        .match = {{MOTION, 11}, {MOTION, 11}},
+    },
+    { // wizar
+        .key = 0x72617a6977,
+        .match = {{ACTION, 54}, {ACTION, 54}},
+    },
+    { // volca
+        .key = 0x61636c6f76,
+        .match = {{OBJECT, 37}, {OBJECT, 37}},
+    },
+    { // ratio
+        .key = 0x6f69746172,
+        .match = {{OBJECT, 19}, {OBJECT, 19}},
+    },
+    { // amber
+        .key = 0x7265626d61,
+        .match = {{OBJECT, 67}, {OBJECT, 67}},
+    },
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    { // say
+        .key = 0x796173,
+        .match = {{ACTION, 3}, {ACTION, 3}},
+    },
+    { // relea
+        .key = 0x61656c6572,
+        .match = {{ACTION, 2}, {ACTION, 2}},
+    },
+    { // rug
+        .key = 0x677572,
+        .match = {{OBJECT, 62}, {OBJECT, 62}},
+    },
+    { // pocus
+        .key = 0x7375636f70,
+        .match = {{ACTION, 43}, {ACTION, 43}},
+    },
+    { // pearl
+        .key = 0x6c72616570,
+        .match = {{OBJECT, 61}, {OBJECT, 61}},
+    },
+    { // exami
+        .key = 0x696d617865,
+        .match = {{MOTION, 57}, {MOTION, 57}},
+    },
+    {0},
+    {0},
+    { // floor
+        .key = 0x726f6f6c66,
+        .match = {{MOTION, 58}, {MOTION, 58}},
+    },
+    {0},
+    { // plove
+        .key = 0x65766f6c70,
+        .match = {{MOTION, 70}, {MOTION, 70}},
+    },
+    {0},
+    {0},
+    { // read
+        .key = 0x64616572,
+        .match = {{ACTION, 31}, {ACTION, 31}},
+    },
+    { // placa
+        .key = 0x6163616c70,
+        .match = {{ACTION, 10}, {ACTION, 10}},
+    },
+    {0},
+    { // abrac
+        .key = 0x6361726261,
+        .match = {{ACTION, 43}, {ACTION, 43}},
+    },
+    { // unloc
+        .key = 0x636f6c6e75,
+        .match = {{ACTION, 4}, {ACTION, 4}},
+    },
+    { // lock
+        .key = 0x6b636f6c,
+        .match = {{ACTION, 6}, {ACTION, 6}},
+    },
+    {0},
+    {0},
+    {0},
+    {0},
+    { // quit
+        .key = 0x74697571,
+        .match = {{ACTION, 18}, {ACTION, 18}},
+    },
+    { // liste
+        .key = 0x657473696c,
+        .match = {{ACTION, 37}, {ACTION, 37}},
+    },
+    {0},
+    { // z
+        .key = 0x7a,
+        .match = {{ACTION, 5}, {NO_WORD_TYPE, 0}},
+    },
+    { // shake
+        .key = 0x656b616873,
+        .match = {{ACTION, 9}, {ACTION, 9}},
+    },
+    {0},
+    { // spice
+        .key = 0x6563697073,
+        .match = {{OBJECT, 63}, {OBJECT, 63}},
+    },
+    { // distu
+        .key = 0x7574736964,
+        .match = {{ACTION, 33}, {ACTION, 33}},
+    },
+    {0},
+    { // coins
+        .key = 0x736e696f63,
+        .match = {{OBJECT, 54}, {OBJECT, 54}},
+    },
+    { // tote
+        .key = 0x65746f74,
+        .match = {{ACTION, 1}, {ACTION, 1}},
+    },
+    { // pirat
+        .key = 0x7461726970,
+        .match = {{OBJECT, 30}, {OBJECT, 30}},
+    },
+    { // news
+        .key = 0x7377656e,
+        .match = {{ACTION, 56}, {ACTION, 56}},
+    },
+    {0},
+    { // touch
+        .key = 0x6863756f74,
+        .match = {{MOTION, 57}, {MOTION, 57}},
+    },
+    { // up
+        .key = 0x7075,
+        .match = {{MOTION, 29}, {MOTION, 29}},
+    },
+    {0},
+    { // view
+        .key = 0x77656976,
+        .match = {{MOTION, 28}, {MOTION, 28}},
+    },
+    { // low
+        .key = 0x776f6c,
+        .match = {{MOTION, 24}, {MOTION, 24}},
+    },
+    { // leave
+        .key = 0x657661656c,
+        .match = {{MOTION, 11}, {MOTION, 11}},
+    },
+    { // stair
+        .key = 0x7269617473,
+        .match = {{MOTION, 10}, {MOTION, 10}},
+    },
+    { // ming
+        .key = 0x676e696d,
+        .match = {{OBJECT, 58}, {OBJECT, 58}},
+    },
+    { // orien
+        .key = 0x6e6569726f,
+        .match = {{MOTION, 71}, {MOTION, 71}},
+    },
+    { // hall
+        .key = 0x6c6c6168,
+        .match = {{MOTION, 38}, {MOTION, 38}},
+    },
+    { // ruby
+        .key = 0x79627572,
+        .match = {{OBJECT, 65}, {OBJECT, 65}},
+    },
+    {0},
+    { // eat
+        .key = 0x746165,
+        .match = {{ACTION, 14}, {ACTION, 14}},
+    },
+    { // grate
+        .key = 0x6574617267,
+        .match = {{OBJECT, 3}, {OBJECT, 3}},
+    },
+    {0},
+    {0},
+    {0},
+    { // run
+        .key = 0x6e7572,
+        .match = {{ACTION, 11}, {ACTION, 11}},
+    },
+    { // shard
+        .key = 0x6472616873,
+        .match = {{OBJECT, 58}, {OBJECT, 58}},
+    },
+    {0},
+    { // utter
+        .key = 0x7265747475,
+        .match = {{ACTION, 3}, {ACTION, 3}},
+    },
+    { // fee
+        .key = 0x656566,
+        .match = {{ACTION, 25}, {ACTION, 25}},
+    },
+    { // foe
+        .key = 0x656f66,
+        .match = {{ACTION, 27}, {ACTION, 27}},
+    },
+    { // se
+        .key = 0x6573,
+        .match = {{MOTION, 48}, {MOTION, 48}},
+    },
+    { // down
+        .key = 0x6e776f64,
+        .match = {{MOTION, 30}, {MOTION, 30}},
+    },
+    {0},
+    { // windo
+        .key = 0x6f646e6977,
+        .match = {{OBJECT, 27}, {OBJECT, 27}},
+    },
+    { // above
+        .key = 0x65766f6261,
+        .match = {{MOTION, 29}, {MOTION, 29}},
+    },
+    {0},
+    { // eggs
+        .key = 0x73676765,
+        .match = {{OBJECT, 56}, {OBJECT, 56}},
+    },
+    { // chest
+        .key = 0x7473656863,
+        .match = {{OBJECT, 55}, {OBJECT, 55}},
+    },
+    { // house
+        .key = 0x6573756f68,
+        .match = {{MOTION, 12}, {MOTION, 12}},
+    },
+    { // road
+        .key = 0x64616f72,
+        .match = {{MOTION, 2}, {MOTION, 2}},
+    },
+    {0},
+    { // entra
+        .key = 0x6172746e65,
+        .match = {{MOTION, 64}, {MOTION, 64}},
+    },
+    { // throw
+        .key = 0x776f726874,
+        .match = {{ACTION, 17}, {ACTION, 17}},
+    },
+    { // downw
+        .key = 0x776e776f64,
+        .match = {{MOTION, 30}, {MOTION, 30}},
+    },
+    { // w
+        .key = 0x77,
+        .match = {{MOTION, 44}, {MOTION, 44}},
+    },
+    {0},
+    { // genie
+        .key = 0x65696e6567,
+        .match = {{OBJECT, 30}, {OBJECT, 30}},
+    },
+    {0},
+    { // drink
+        .key = 0x6b6e697264,
+        .match = {{ACTION, 15}, {ACTION, 15}},
+    },
+    { // devou
+        .key = 0x756f766564,
+        .match = {{ACTION, 14}, {ACTION, 14}},
+    },
+    { // proce
+        .key = 0x65636f7270,
+        .match = {{ACTION, 11}, {ACTION, 11}},
+    },
+    {0},
+    { // note
+        .key = 0x65746f6e,
+        .match = {{OBJECT, 48}, {OBJECT, 48}},
+    },
+    {0},
+    { // tride
+        .key = 0x6564697274,
+        .match = {{OBJECT, 57}, {OBJECT, 57}},
+    },
+    { // fly
+        .key = 0x796c66,
+        .match = {{ACTION, 36}, {ACTION, 36}},
+    },
+    {0},
+    { // rub
+        .key = 0x627572,
+        .match = {{ACTION, 16}, {ACTION, 16}},
+    },
+    {0},
+    { // canyo
+        .key = 0x6f796e6163,
+        .match = {{MOTION, 25}, {MOTION, 25}},
+    },
+    {0},
+    { // valle
+        .key = 0x656c6c6176,
+        .match = {{MOTION, 9}, {MOTION, 9}},
+    },
+    {0},
+    { // build
+        .key = 0x646c697562,
+        .match = {{MOTION, 12}, {MOTION, 12}},
+    },
+    { // drop
+        .key = 0x706f7264,
+        .match = {{ACTION, 2}, {ACTION, 2}},
+    },
+    {0},
+    { // knife
+        .key = 0x6566696e6b,
+        .match = {{OBJECT, 18}, {OBJECT, 18}},
+    },
+    { // emera
+        .key = 0x6172656d65,
+        .match = {{OBJECT, 59}, {OBJECT, 59}},
+    },
+    {0},
+    { // mirro
+        .key = 0x6f7272696d,
+        .match = {{OBJECT, 23}, {OBJECT, 23}},
+    },
+    {0},
+    {0},
+    { // off
+        .key = 0x66666f,
+        .match = {{ACTION, 8}, {ACTION, 8}},
+    },
+    { // kill
+        .key = 0x6c6c696b,
+        .match = {{ACTION, 12}, {ACTION, 12}},
+    },
+    { // i
+        .key = 0x69,
+        .match = {{ACTION, 20}, {NO_WORD_TYPE, 0}},
+    },
+    { // get
+        .key = 0x746567,
+        .match = {{ACTION, 1}, {ACTION, 1}},
+    },
+    { // messa
+        .key = 0x617373656d,
+        .match = {{OBJECT, 36}, {OBJECT, 36}},
+    },
+    { // cage
+        .key = 0x65676163,
+        .match = {{OBJECT, 4}, {OBJECT, 4}},
+    },
+    {0},
+    { // excav
+        .key = 0x7661637865,
+        .match = {{ACTION, 47}, {ACTION, 47}},
+    },
+    { // vendi
+        .key = 0x69646e6576,
+        .match = {{OBJECT, 38}, {OBJECT, 38}},
+    },
+    {0},
+    {0},
+    {0},
+    { // walk
+        .key = 0x6b6c6177,
+        .match = {{ACTION, 11}, {ACTION, 11}},
+    },
+    { // wave
+        .key = 0x65766177,
+        .match = {{ACTION, 9}, {ACTION, 9}},
+    },
+    { // pyram
+        .key = 0x6d61727970,
+        .match = {{OBJECT, 60}, {OBJECT, 60}},
+    },
+    { // sign
+        .key = 0x6e676973,
+        .match = {{OBJECT, 49}, {OBJECT, 49}},
+    },
+    { // bird
+        .key = 0x64726962,
+        .match = {{OBJECT, 8}, {OBJECT, 8}},
+    },
+    { // calm
+        .key = 0x6d6c6163,
+        .match = {{ACTION, 10}, {ACTION, 10}},
+    },
+    {0},
+    { // h2o
+        .key = 0x6f3268,
+        .match = {{OBJECT, 21}, {OBJECT, 21}},
+    },
+    { // djinn
+        .key = 0x6e6e696a64,
+        .match = {{OBJECT, 30}, {OBJECT, 30}},
+    },
+    {0},
+    {0},
+    { // box
+        .key = 0x786f62,
+        .match = {{OBJECT, 55}, {OBJECT, 55}},
+    },
+    { // mist
+        .key = 0x7473696d,
+        .match = {{ACTION, 49}, {ACTION, 49}},
+    },
+    { // potte
+        .key = 0x6574746f70,
+        .match = {{OBJECT, 58}, {OBJECT, 58}},
+    },
+    { // upstr
+        .key = 0x7274737075,
+        .match = {{MOTION, 4}, {MOTION, 4}},
+    },
+    { // retur
+        .key = 0x7275746572,
+        .match = {{MOTION, 8}, {MOTION, 8}},
+    },
+    { // climb
+        .key = 0x626d696c63,
+        .match = {{MOTION, 56}, {MOTION, 56}},
+    },
+    { // find
+        .key = 0x646e6966,
+        .match = {{ACTION, 19}, {ACTION, 19}},
+    },
+    { // reser
+        .key = 0x7265736572,
+        .match = {{MOTION, 74}, {MOTION, 74}},
+    },
+    { // dwarf
+        .key = 0x6672617764,
+        .match = {{OBJECT, 17}, {OBJECT, 17}},
+    },
+    { // shado
+        .key = 0x6f64616873,
+        .match = {{OBJECT, 27}, {OBJECT, 27}},
+    },
+    { // fork
+        .key = 0x6b726f66,
+        .match = {{MOTION, 15}, {MOTION, 15}},
+    },
+    { // strik
+        .key = 0x6b69727473,
+        .match = {{ACTION, 12}, {ACTION, 12}},
+    },
+    { // g
+        .key = 0x67,
+        .match = {{ACTION, 1}, {NO_WORD_TYPE, 0}},
+    },
+    {0},
+    { // geyse
+        .key = 0x6573796567,
+        .match = {{OBJECT, 37}, {OBJECT, 37}},
+    },
+    {0},
+    { // cross
+        .key = 0x73736f7263,
+        .match = {{MOTION, 68}, {MOTION, 68}},
+    },
+    {0},
+    { // dark
+        .key = 0x6b726164,
+        .match = {{MOTION, 22}, {MOTION, 22}},
+    },
+    {0},
+    { // open
+        .key = 0x6e65706f,
+        .match = {{ACTION, 4}, {ACTION, 4}},
+    },
+    { // ne
+        .key = 0x656e,
+        .match = {{MOTION, 47}, {MOTION, 47}},
+    },
+    { // pillo
+        .key = 0x6f6c6c6970,
+        .match = {{OBJECT, 10}, {OBJECT, 10}},
+    },
+    {0},
+    { // fill
+        .key = 0x6c6c6966,
+        .match = {{ACTION, 22}, {ACTION, 22}},
+    },
+    {0},
+    {0},
+    { // lepor
+        .key = 0x726f70656c,
+        .match = {{OBJECT, 46}, {OBJECT, 46}},
+    },
+    { // bed
+        .key = 0x646562,
+        .match = {{MOTION, 16}, {MOTION, 16}},
+    },
+    { // gemst
+        .key = 0x74736d6567,
+        .match = {{OBJECT, 67}, {OBJECT, 67}},
+    },
+    {0},
+    { // dome
+        .key = 0x656d6f64,
+        .match = {{MOTION, 35}, {MOTION, 35}},
+    },
+    {0},
+    { // jade
+        .key = 0x6564616a,
+        .match = {{OBJECT, 66}, {OBJECT, 66}},
+    },
+    { // deton
+        .key = 0x6e6f746564,
+        .match = {{ACTION, 23}, {ACTION, 23}},
+    },
+    { // carpe
+        .key = 0x6570726163,
+        .match = {{OBJECT, 40}, {OBJECT, 40}},
+    },
+    {0},
+    { // knive
+        .key = 0x6576696e6b,
+        .match = {{OBJECT, 18}, {OBJECT, 18}},
+    },
+    { // axe
+        .key = 0x657861,
+        .match = {{OBJECT, 28}, {OBJECT, 28}},
+    },
+    { // retre
+        .key = 0x6572746572,
+        .match = {{MOTION, 8}, {MOTION, 8}},
+    },
+    { // insid
+        .key = 0x6469736e69,
+        .match = {{MOTION, 19}, {MOTION, 19}},
+    },
+    { // over
+        .key = 0x7265766f,
+        .match = {{MOTION, 41}, {MOTION, 41}},
+    },
+    {0},
+    {0},
+    { // back
+        .key = 0x6b636162,
+        .match = {{MOTION, 8}, {MOTION, 8}},
+    },
+    { // table
+        .key = 0x656c626174,
+        .match = {{OBJECT, 13}, {OBJECT, 13}},
+    },
+    { // fissu
+        .key = 0x7573736966,
+        .match = {{OBJECT, 12}, {OBJECT, 12}},
+    },
+    {0},
+    {0},
+    { // south
+        .key = 0x6874756f73,
+        .match = {{MOTION, 46}, {MOTION, 46}},
+    },
+    { // broke
+        .key = 0x656b6f7262,
+        .match = {{MOTION, 54}, {MOTION, 54}},
+    },
+    {0},
+    {0},
+    {0},
+    { // batte
+        .key = 0x6574746162,
+        .match = {{OBJECT, 39}, {OBJECT, 39}},
+    },
+    { // keep
+        .key = 0x7065656b,
+        .match = {{ACTION, 1}, {ACTION, 1}},
+    },
+    {0},
+    {0},
+    {0},
+    {0},
+    { // chasm
+        .key = 0x6d73616863,
+        .match = {{OBJECT, 32}, {OBJECT, 32}},
+    },
+    { // clam
+        .key = 0x6d616c63,
+        .match = {{OBJECT, 14}, {OBJECT, 14}},
+    },
+    { // statu
+        .key = 0x7574617473,
+        .match = {{OBJECT, 69}, {OBJECT, 69}},
+    },
+    { // awkwa
+        .key = 0x61776b7761,
+        .match = {{MOTION, 26}, {MOTION, 26}},
+    },
+    {0},
+    { // left
+        .key = 0x7466656c,
+        .match = {{MOTION, 36}, {MOTION, 36}},
+    },
+    { // attac
+        .key = 0x6361747461,
+        .match = {{ACTION, 12}, {ACTION, 12}},
+    },
+    { // keys
+        .key = 0x7379656b,
+        .match = {{OBJECT, 1}, {OBJECT, 1}},
+    },
+    {0},
+    {0},
+    {0},
+    { // west
+        .key = 0x74736577,
+        .match = {{MOTION, 44}, {MOTION, 44}},
+    },
+    {0},
+    {0},
+    { // wake
+        .key = 0x656b6177,
+        .match = {{ACTION, 33}, {ACTION, 33}},
+    },
+    { // bottl
+        .key = 0x6c74746f62,
+        .match = {{OBJECT, 20}, {OBJECT, 20}},
+    },
+    {0},
+    { // bedqu
+        .key = 0x7571646562,
+        .match = {{MOTION, 69}, {MOTION, 69}},
+    },
+    { // jump
+        .key = 0x706d756a,
+        .match = {{MOTION, 39}, {MOTION, 39}},
+    },
+    { // giant
+        .key = 0x746e616967,
+        .match = {{MOTION, 27}, {MOTION, 27}},
+    },
+    { // drawi
+        .key = 0x6977617264,
+        .match = {{OBJECT, 29}, {OBJECT, 29}},
+    },
+    { // drago
+        .key = 0x6f67617264,
+        .match = {{OBJECT, 31}, {OBJECT, 31}},
+    },
+    {0},
+    { // catch
+        .key = 0x6863746163,
+        .match = {{ACTION, 1}, {ACTION, 1}},
+    },
+    { // foo
+        .key = 0x6f6f66,
+        .match = {{ACTION, 28}, {ACTION, 28}},
+    },
+    {0},
+    { // steps
+        .key = 0x7370657473,
+        .match = {{MOTION, 34}, {MOTION, 34}},
+    },
+    {0},
+    {0},
+    {0},
+    { // resta
+        .key = 0x6174736572,
+        .match = {{ACTION, 35}, {ACTION, 35}},
+    },
+    {0},
+    { // plati
+        .key = 0x6974616c70,
+        .match = {{OBJECT, 60}, {OBJECT, 60}},
+    },
+    { // ignit
+        .key = 0x74696e6769,
+        .match = {{ACTION, 23}, {ACTION, 23}},
+    },
+    { // sing
+        .key = 0x676e6973,
+        .match = {{ACTION, 3}, {ACTION, 3}},
+    },
+    { // free
+        .key = 0x65657266,
+        .match = {{ACTION, 2}, {ACTION, 2}},
+    },
+    {0},
+    { // beans
+        .key = 0x736e616562,
+        .match = {{OBJECT, 24}, {OBJECT, 24}},
+    },
+    { // where
+        .key = 0x6572656877,
+        .match = {{ACTION, 19}, {ACTION, 19}},
+    },
+    { // magaz
+        .key = 0x7a6167616d,
+        .match = {{OBJECT, 16}, {OBJECT, 16}},
+    },
+    { // blast
+        .key = 0x7473616c62,
+        .match = {{ACTION, 23}, {ACTION, 23}},
+    },
+    { // infor
+        .key = 0x726f666e69,
+        .match = {{ACTION, 52}, {ACTION, 52}},
+    },
+    { // info
+        .key = 0x6f666e69,
+        .match = {{ACTION, 52}, {ACTION, 52}},
+    },
+    {0},
+    { // u
+        .key = 0x75,
+        .match = {{MOTION, 29}, {MOTION, 29}},
+    },
+    { // outsi
+        .key = 0x697374756f,
+        .match = {{MOTION, 11}, {MOTION, 11}},
+    },
+    {0},
+    { // spelu
+        .key = 0x756c657073,
+        .match = {{OBJECT, 16}, {OBJECT, 16}},
+    },
+    {0},
+    { // brief
+        .key = 0x6665697262,
+        .match = {{ACTION, 30}, {ACTION, 30}},
+    },
+    {0},
+    {0},
+    {0},
+    { // sw
+        .key = 0x7773,
+        .match = {{MOTION, 49}, {MOTION, 49}},
+    },
+    {0},
+    { // shaza
+        .key = 0x617a616873,
+        .match = {{ACTION, 43}, {ACTION, 43}},
+    },
+    {0},
+    {0},
+    {0},
+    { // forwa
+        .key = 0x6177726f66,
+        .match = {{MOTION, 7}, {MOTION, 7}},
+    },
+    { // secre
+        .key = 0x6572636573,
+        .match = {{MOTION, 66}, {MOTION, 66}},
+    },
+    { // pause
+        .key = 0x6573756170,
+        .match = {{ACTION, 34}, {ACTION, 34}},
+    },
+    { // seed
+        .key = 0x64656573,
+        .match = {{ACTION, 39}, {ACTION, 39}},
+    },
+    { // gold
+        .key = 0x646c6f67,
+        .match = {{OBJECT, 50}, {OBJECT, 50}},
+    },
+    { // barre
+        .key = 0x6572726162,
+        .match = {{MOTION, 40}, {MOTION, 40}},
+    },
+    { // swing
+        .key = 0x676e697773,
+        .match = {{ACTION, 9}, {ACTION, 9}},
+    },
+    { // offic
+        .key = 0x636966666f,
+        .match = {{MOTION, 75}, {MOTION, 75}},
+    },
+    {0},
+    { // smash
+        .key = 0x6873616d73,
+        .match = {{ACTION, 32}, {ACTION, 32}},
+    },
+    {0},
+    {0},
+    { // appen
+        .key = 0x6e65707061,
+        .match = {{OBJECT, 46}, {OBJECT, 46}},
+    },
+    { // dig
+        .key = 0x676964,
+        .match = {{ACTION, 47}, {ACTION, 47}},
+    },
+    {0},
+    { // ?
+        .key = 0x3f,
+        .match = {{ACTION, 44}, {ACTION, 44}},
+    },
+    {0},
+    { // cobbl
+        .key = 0x6c62626f63,
+        .match = {{MOTION, 18}, {MOTION, 18}},
+    },
+    { // waste
+        .key = 0x6574736177,
+        .match = {{ACTION, 40}, {ACTION, 40}},
+    },
+    { // stala
+        .key = 0x616c617473,
+        .match = {{OBJECT, 26}, {OBJECT, 26}},
+    },
+    { // bear
+        .key = 0x72616562,
+        .match = {{OBJECT, 35}, {OBJECT, 35}},
+    },
+    { // xyzzy
+        .key = 0x797a7a7978,
+        .match = {{MOTION, 62}, {MOTION, 62}},
+    },
+    {0},
+    {0},
+    {0},
+    {0},
+    { // fuck
+        .key = 0x6b637566,
+        .match = {{ACTION, 50}, {ACTION, 50}},
+    },
+    { // lamp
+        .key = 0x706d616c,
+        .match = {{OBJECT, 2}, {OBJECT, 2}},
+    },
+    { // explo
+        .key = 0x6f6c707865,
+        .match = {{ACTION, 11}, {ACTION, 11}},
+    },
+    { // figur
+        .key = 0x7275676966,
+        .match = {{OBJECT, 27}, {OBJECT, 27}},
+    },
+    { // no
+        .key = 0x6f6e,
+        .match = {{ACTION, 45}, {ACTION, 45}},
+    },
+    { // key
+        .key = 0x79656b,
+        .match = {{OBJECT, 1}, {OBJECT, 1}},
+    },
+    {0},
+    { // thank
+        .key = 0x6b6e616874,
+        .match = {{ACTION, 42}, {ACTION, 42}},
+    },
+    { // lost
+        .key = 0x74736f6c,
+        .match = {{ACTION, 48}, {ACTION, 48}},
+    },
+    {0},
+    { // issue
+        .key = 0x6575737369,
+        .match = {{OBJECT, 16}, {OBJECT, 16}},
+    },
+    { // n
+        .key = 0x6e,
+        .match = {{MOTION, 45}, {MOTION, 45}},
+    },
+    {0},
+    {0},
+    { // acros
+        .key = 0x736f726361,
+        .match = {{MOTION, 42}, {MOTION, 42}},
+    },
+    {0},
+    {0},
+    { // mud
+        .key = 0x64756d,
+        .match = {{OBJECT, 47}, {OBJECT, 47}},
+    },
+    { // ebony
+        .key = 0x796e6f6265,
+        .match = {{OBJECT, 69}, {OBJECT, 69}},
+    },
+    { // fores
+        .key = 0x7365726f66,
+        .match = {{MOTION, 6}, {MOTION, 6}},
+    },
+    {0},
+    {0},
+    { // tame
+        .key = 0x656d6174,
+        .match = {{ACTION, 10}, {ACTION, 10}},
+    },
+    {0},
+    { // y2
+        .key = 0x3279,
+        .match = {{MOTION, 55}, {MOTION, 55}},
+    },
+    { // in
+        .key = 0x6e69,
+        .match = {{MOTION, 19}, {MOTION, 19}},
+    },
+    {0},
+    { // look
+        .key = 0x6b6f6f6c,
+        .match = {{MOTION, 57}, {MOTION, 57}},
+    },
+    {0},
+    {0},
+    { // nugge
+        .key = 0x656767756e,
+        .match = {{OBJECT, 50}, {OBJECT, 50}},
+    },
+    {0},
+    {0},
+    {0},
+    { // caver
+        .key = 0x7265766163,
+        .match = {{MOTION, 72}, {MOTION, 72}},
+    },
+    { // save
+        .key = 0x65766173,
+        .match = {{ACTION, 34}, {ACTION, 34}},
+    },
+    {0},
+    {0},
+    { // take
+        .key = 0x656b6174,
+        .match = {{ACTION, 1}, {ACTION, 1}},
+    },
+    { // dwarv
+        .key = 0x7672617764,
+        .match = {{OBJECT, 17}, {OBJECT, 17}},
+    },
+    {0},
+    { // shell
+        .key = 0x6c6c656873,
+        .match = {{MOTION, 73}, {MOTION, 73}},
+    },
+    {0},
+    { // plant
+        .key = 0x746e616c70,
+        .match = {{OBJECT, 24}, {OBJECT, 24}},
+    },
+    { // inven
+        .key = 0x6e65766e69,
+        .match = {{ACTION, 20}, {ACTION, 20}},
+    },
+    {0},
+    { // pour
+        .key = 0x72756f70,
+        .match = {{ACTION, 13}, {ACTION, 13}},
+    },
+    { // depre
+        .key = 0x6572706564,
+        .match = {{MOTION, 63}, {MOTION, 63}},
+    },
+    { // diamo
+        .key = 0x6f6d616964,
+        .match = {{OBJECT, 51}, {OBJECT, 51}},
+    },
+    { // ogre
+        .key = 0x6572676f,
+        .match = {{OBJECT, 41}, {OBJECT, 41}},
+    },
+    {0},
+    {0},
+    { // plugh
+        .key = 0x6867756c70,
+        .match = {{MOTION, 65}, {MOTION, 65}},
+    },
+    { // disca
+        .key = 0x6163736964,
+        .match = {{ACTION, 2}, {ACTION, 2}},
+    },
+    { // ascen
+        .key = 0x6e65637361,
+        .match = {{MOTION, 29}, {MOTION, 29}},
+    },
+    { // treas
+        .key = 0x7361657274,
+        .match = {{OBJECT, 55}, {OBJECT, 55}},
+    },
+    {0},
+    {0},
+    {0},
+    { // mumbl
+        .key = 0x6c626d756d,
+        .match = {{ACTION, 3}, {ACTION, 3}},
+    },
+    { // trave
+        .key = 0x6576617274,
+        .match = {{ACTION, 11}, {ACTION, 11}},
+    },
+    {0},
+    { // exit
+        .key = 0x74697865,
+        .match = {{MOTION, 11}, {MOTION, 11}},
+    },
+    { // cavit
+        .key = 0x7469766163,
+        .match = {{OBJECT, 43}, {OBJECT, 43}},
+    },
+    {0},
+    {0},
+    { // hole
+        .key = 0x656c6f68,
+        .match = {{MOTION, 52}, {MOTION, 52}},
+    },
+    { // vase
+        .key = 0x65736176,
+        .match = {{OBJECT, 58}, {OBJECT, 58}},
+    },
+    {0},
+    { // sapph
+        .key = 0x6870706173,
+        .match = {{OBJECT, 68}, {OBJECT, 68}},
+    },
+    {0},
+    {0},
+    {0},
+    { // abra
+        .key = 0x61726261,
+        .match = {{ACTION, 43}, {ACTION, 43}},
+    },
+    { // oil
+        .key = 0x6c696f,
+        .match = {{OBJECT, 22}, {OBJECT, 22}},
+    },
+    { // oyste
+        .key = 0x657473796f,
+        .match = {{OBJECT, 15}, {OBJECT, 15}},
+    },
+    { // troll
+        .key = 0x6c6c6f7274,
+        .match = {{OBJECT, 33}, {OBJECT, 33}},
+    },
+    {0},
+    {0},
+    {0},
+    { // swim
+        .key = 0x6d697773,
+        .match = {{ACTION, 53}, {ACTION, 53}},
+    },
+    { // desce
+        .key = 0x6563736564,
+        .match = {{MOTION, 30}, {MOTION, 30}},
+    },
+    { // onwar
+        .key = 0x7261776e6f,
+        .match = {{MOTION, 7}, {MOTION, 7}},
+    },
+    { // stop
+        .key = 0x706f7473,
+        .match = {{ACTION, 51}, {ACTION, 51}},
+    },
+    { // room
+        .key = 0x6d6f6f72,
+        .match = {{MOTION, 59}, {MOTION, 59}},
+    },
+    { // slay
+        .key = 0x79616c73,
+        .match = {{ACTION, 12}, {ACTION, 12}},
+    },
+    { // food
+        .key = 0x646f6f66,
+        .match = {{OBJECT, 19}, {OBJECT, 19}},
+    },
+    {0},
+    { // moss
+        .key = 0x73736f6d,
+        .match = {{OBJECT, 40}, {OBJECT, 40}},
+    },
+    {0},
+    { // follo
+        .key = 0x6f6c6c6f66,
+        .match = {{ACTION, 11}, {ACTION, 11}},
+    },
+    { // versi
+        .key = 0x6973726576,
+        .match = {{ACTION, 57}, {ACTION, 57}},
+    },
+    { // crawl
+        .key = 0x6c77617263,
+        .match = {{MOTION, 17}, {MOTION, 17}},
+    },
+    {0},
+    { // toss
+        .key = 0x73736f74,
+        .match = {{ACTION, 17}, {ACTION, 17}},
+    },
+    { // z'zzz
+        .key = 0x7a7a7a277a,
+        .match = {{ACTION, 38}, {ACTION, 38}},
+    },
+    {0},
+    { // egg
+        .key = 0x676765,
+        .match = {{OBJECT, 56}, {OBJECT, 56}},
+    },
+    {0},
+    {0},
+    { // break
+        .key = 0x6b61657262,
+        .match = {{ACTION, 32}, {ACTION, 32}},
+    },
+    { // fight
+        .key = 0x7468676966,
+        .match = {{ACTION, 12}, {ACTION, 12}},
+    },
+    { // e
+        .key = 0x65,
+        .match = {{MOTION, 43}, {MOTION, 43}},
+    },
+    { // downs
+        .key = 0x736e776f64,
+        .match = {{MOTION, 5}, {MOTION, 5}},
+    },
+    { // wall
+        .key = 0x6c6c6177,
+        .match = {{MOTION, 53}, {MOTION, 53}},
+    },
+    {0},
+    { // jewel
+        .key = 0x6c6577656a,
+        .match = {{OBJECT, 53}, {OBJECT, 53}},
+    },
+    {0},
+    { // opens
+        .key = 0x736e65706f,
+        .match = {{ACTION, 43}, {ACTION, 43}},
+    },
+    {0},
+    {0},
+    { // slit
+        .key = 0x74696c73,
+        .match = {{MOTION, 60}, {MOTION, 60}},
+    },
+    { // hill
+        .key = 0x6c6c6968,
+        .match = {{MOTION, 2}, {MOTION, 2}},
+    },
+    {0},
+    { // steal
+        .key = 0x6c61657473,
+        .match = {{ACTION, 1}, {ACTION, 1}},
+    },
+    { // silve
+        .key = 0x65766c6973,
+        .match = {{OBJECT, 52}, {OBJECT, 52}},
+    },
+    {0},
+    { // hit
+        .key = 0x746968,
+        .match = {{ACTION, 12}, {ACTION, 12}},
+    },
+    {0},
+    { // gully
+        .key = 0x796c6c7567,
+        .match = {{MOTION, 13}, {MOTION, 13}},
+    },
+    { // velve
+        .key = 0x65766c6576,
+        .match = {{OBJECT, 10}, {OBJECT, 10}},
+    },
+    { // blowu
+        .key = 0x75776f6c62,
+        .match = {{ACTION, 23}, {ACTION, 23}},
+    },
+    { // main
+        .key = 0x6e69616d,
+        .match = {{MOTION, 75}, {MOTION, 75}},
+    },
+    { // carry
+        .key = 0x7972726163,
+        .match = {{ACTION, 1}, {ACTION, 1}},
+    },
+    { // help
+        .key = 0x706c6568,
+        .match = {{ACTION, 44}, {ACTION, 44}},
+    },
+    {0},
+    {0},
+    { // extin
+        .key = 0x6e69747865,
+        .match = {{ACTION, 8}, {ACTION, 8}},
+    },
+    { // tree
+        .key = 0x65657274,
+        .match = {{ACTION, 46}, {ACTION, 46}},
+    },
+    { // blood
+        .key = 0x646f6f6c62,
+        .match = {{OBJECT, 44}, {OBJECT, 44}},
+    },
+    { // s
+        .key = 0x73,
+        .match = {{MOTION, 46}, {MOTION, 46}},
+    },
+    {0},
+    { // snarf
+        .key = 0x6672616e73,
+        .match = {{ACTION, 1}, {ACTION, 1}},
+    },
+    {0},
+    { // nest
+        .key = 0x7473656e,
+        .match = {{OBJECT, 56}, {OBJECT, 56}},
+    },
+    {0},
+    {0},
+    { // urn
+        .key = 0x6e7275,
+        .match = {{OBJECT, 42}, {OBJECT, 42}},
+    },
+    { // suspe
+        .key = 0x6570737573,
+        .match = {{ACTION, 34}, {ACTION, 34}},
+    },
+    { // trees
+        .key = 0x7365657274,
+        .match = {{ACTION, 46}, {ACTION, 46}},
+    },
+    { // lante
+        .key = 0x65746e616c,
+        .match = {{OBJECT, 2}, {OBJECT, 2}},
+    },
+    { // conti
+        .key = 0x69746e6f63,
+        .match = {{MOTION, 7}, {MOTION, 7}},
+    },
+    {0},
+    {0},
+    { // descr
+        .key = 0x7263736564,
+        .match = {{MOTION, 57}, {MOTION, 57}},
+    },
+    { // fie
+        .key = 0x656966,
+        .match = {{ACTION, 26}, {ACTION, 26}},
+    },
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    { // bars
+        .key = 0x73726162,
+        .match = {{OBJECT, 52}, {OBJECT, 52}},
+    },
+    { // chant
+        .key = 0x746e616863,
+        .match = {{ACTION, 3}, {ACTION, 3}},
+    },
+    { // close
+        .key = 0x65736f6c63,
+        .match = {{ACTION, 6}, {ACTION, 6}},
+    },
+    {0},
+    {0},
+    { // water
+        .key = 0x7265746177,
+        .match = {{OBJECT, 21}, {OBJECT, 21}},
+    },
+    { // fum
+        .key = 0x6d7566,
+        .match = {{ACTION, 29}, {ACTION, 29}},
+    },
+    { // captu
+        .key = 0x7574706163,
+        .match = {{ACTION, 1}, {ACTION, 1}},
+    },
+    {0},
+    {0},
+    { // x
+        .key = 0x78,
+        .match = {{MOTION, 57}, {NO_WORD_TYPE, 0}},
+    },
+    {0},
+    { // machi
+        .key = 0x696863616d,
+        .match = {{OBJECT, 38}, {OBJECT, 38}},
+    },
+    {0},
+    { // resum
+        .key = 0x6d75736572,
+        .match = {{ACTION, 35}, {ACTION, 35}},
+    },
+    { // upwar
+        .key = 0x7261777075,
+        .match = {{MOTION, 29}, {MOTION, 29}},
+    },
+    { // debri
+        .key = 0x6972626564,
+        .match = {{MOTION, 51}, {MOTION, 51}},
+    },
+    { // pit
+        .key = 0x746970,
+        .match = {{MOTION, 31}, {MOTION, 31}},
+    },
+    {0},
+    { // inwar
+        .key = 0x7261776e69,
+        .match = {{MOTION, 19}, {MOTION, 19}},
+    },
+    { // feed
+        .key = 0x64656566,
+        .match = {{ACTION, 21}, {ACTION, 21}},
+    },
+    { // cave
+        .key = 0x65766163,
+        .match = {{MOTION, 67}, {MOTION, 67}},
+    },
+    { // jar
+        .key = 0x72616a,
+        .match = {{OBJECT, 20}, {OBJECT, 20}},
+    },
+    {0},
+    { // d
+        .key = 0x64,
+        .match = {{MOTION, 30}, {MOTION, 30}},
+    },
+    { // sesam
+        .key = 0x6d61736573,
+        .match = {{ACTION, 43}, {ACTION, 43}},
+    },
+    { // l
+        .key = 0x6c,
+        .match = {{MOTION, 57}, {NO_WORD_TYPE, 0}},
+    },
+    {0},
+    {0},
+    { // chain
+        .key = 0x6e69616863,
+        .match = {{OBJECT, 64}, {OBJECT, 64}},
+    },
+    { // nw
+        .key = 0x776e,
+        .match = {{MOTION, 50}, {MOTION, 50}},
+    },
+    { // perus
+        .key = 0x7375726570,
+        .match = {{ACTION, 31}, {ACTION, 31}},
+    },
+    { // dump
+        .key = 0x706d7564,
+        .match = {{ACTION, 2}, {ACTION, 2}},
+    },
+    { // persi
+        .key = 0x6973726570,
+        .match = {{OBJECT, 62}, {OBJECT, 62}},
+    },
+    { // crack
+        .key = 0x6b63617263,
+        .match = {{MOTION, 33}, {MOTION, 33}},
+    },
+    { // neckl
+        .key = 0x6c6b63656e,
+        .match = {{OBJECT, 66}, {OBJECT, 66}},
+    },
+    {0},
+    {0},
+    {0},
+    {0},
+    {0},
+    { // slabr
+        .key = 0x7262616c73,
+        .match = {{MOTION, 61}, {MOTION, 61}},
+    },
+    { // go
+        .key = 0x6f67,
+        .match = {{ACTION, 11}, {ACTION, 11}},
+    },
+    { // light
+        .key = 0x746867696c,
+        .match = {{ACTION, 7}, {ACTION, 7}},
+    },
+    { // outdo
+        .key = 0x6f6474756f,
+        .match = {{MOTION, 32}, {MOTION, 32}},
+    },
+    { // strea
+        .key = 0x6165727473,
+        .match = {{MOTION, 14}, {MOTION, 14}},
+    },
+    { // null
+        .key = 0x6c6c756e,
+        .match = {{MOTION, 21}, {MOTION, 21}},
+    },
+    { // north
+        .key = 0x6874726f6e,
+        .match = {{MOTION, 45}, {MOTION, 45}},
+    },
+    { // turn
+        .key = 0x6e727574,
+        .match = {{ACTION, 11}, {ACTION, 11}},
+    },
+    { // nothi
+        .key = 0x6968746f6e,
+        .match = {{ACTION, 5}, {ACTION, 5}},
+    },
+    { // nowhe
+        .key = 0x6568776f6e,
+        .match = {{MOTION, 21}, {MOTION, 21}},
+    },
+    { // tunne
+        .key = 0x656e6e7574,
+        .match = {{MOTION, 23}, {MOTION, 23}},
+    },
+    {0},
+    { // hocus
+        .key = 0x7375636f68,
+        .match = {{ACTION, 43}, {ACTION, 43}},
+    },
+    {0},
+    { // east
+        .key = 0x74736165,
+        .match = {{MOTION, 43}, {MOTION, 43}},
+    },
+    {0},
+    { // rod
+        .key = 0x646f72,
+        .match = {{OBJECT, 5}, {OBJECT, 5}},
+    },
+    { // shatt
+        .key = 0x7474616873,
+        .match = {{ACTION, 32}, {ACTION, 32}},
+    },
+    {0},
+    { // passa
+        .key = 0x6173736170,
+        .match = {{MOTION, 23}, {MOTION, 23}},
+    },
+    {0},
+    {0},
+    {0},
+    { // door
+        .key = 0x726f6f64,
+        .match = {{OBJECT, 9}, {OBJECT, 9}},
+    },
+    {0},
+    {0},
+    { // enter
+        .key = 0x7265746e65,
+        .match = {{MOTION, 3}, {MOTION, 3}},
+    },
+    { // on
+        .key = 0x6e6f,
+        .match = {{ACTION, 7}, {ACTION, 7}},
+    },
+    { // slab
+        .key = 0x62616c73,
+        .match = {{MOTION, 61}, {MOTION, 61}},
+    },
+    {0},
+};
+
+const unsigned short vocab_displace[] = {
+    0, 1, 1, 3, 3, 6, 10, 24, 3, 29,
+    1, 2, 2, 2, 1, 7, 2, 3, 5, 4,
+    7, 1, 9, 3, 3, 8, 1, 2, 7, 3,
+    1, 6, 5, 1, 5, 0, 2, 13, 12, 1,
+    30, 3, 5, 4, 10, 9, 2, 24, 5, 11,
+    1, 18, 12, 21, 3, 4, 3, 1, 6, 3,
+    14, 4, 1, 9, 9, 17, 34, 1, 25, 2,
+    4, 5, 19, 2, 5, 48, 19, 8, 11, 4
+};
+
+/* end */
\ No newline at end of file
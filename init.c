@@ -11,16 +11,22 @@
 #include <stdio.h>
 #include <stdbool.h>
 #include <time.h>
+#include <string.h>
 
 #include "advent.h"
 
-struct settings_t settings = {
+static const struct settings_t default_settings = {
     .logfp = NULL,
     .oldstyle = false,
-    .prompt = true
+    .prompt = true,
+    .linebuffer = false,
+    .echo = true,
+    .outfd = STDOUT_FILENO,
+    .input = console_input,
+    .host = NULL
 };
 
-struct game_t game = {
+static const struct game_t initial_game = {
     .dloc[1] = LOC_KINGHALL,
     .dloc[2] = LOC_WESTBANK,
     .dloc[3] = LOC_Y2,
@@ -43,26 +49,111 @@ struct game_t game = {
     .foobar  = WORD_EMPTY,
 };
 
-long initialise(void)
+struct session_t* session_new(void)
+/* A fresh session with default settings, not yet initialised. */
 {
-    if (settings.oldstyle)
-        printf("Initialising...\n");
+    struct session_t* s = calloc(1, sizeof(struct session_t));
+    if (s == NULL)
+        return NULL;	// LCOV_EXCL_LINE
+    s->game = initial_game;
+    s->settings = default_settings;
+    /* Different for sessions made in the same second, and leaves the
+     * process-wide rand() state alone. */
+    s->seed = (int32_t)(((uint64_t)time(NULL) * UINT64_C(0x9e3779b97f4a7c15) ^ (uintptr_t)s) >> 33);
+    return s;
+}
 
-    srand(time(NULL));
-    long seedval = (long)rand();
-    set_seed(seedval);
+bool command_copy(command_t* to, char** to_line, const command_t* from, const char* from_line)
+/* Copy a command and the input line its words point into, so that the
+ * copy's words point into a line of its own, left in *to_line for the
+ * caller to free.  If that can't be allocated, *to is an empty command
+ * with no line, and the result is false. */
+{
+    *to = *from;
+    *to_line = NULL;
+    if (from_line == NULL)
+        return true;
+    *to_line = strdup(from_line);
+    if (*to_line == NULL) {
+        memset(to, '\0', sizeof(*to));	// LCOV_EXCL_LINE
+        return false;	// LCOV_EXCL_LINE
+    }
+    for (int i = 0; i < 2; i++) {
+        const char* raw = from->word[i].raw;
+        if (raw >= from_line && raw <= from_line + strlen(from_line))
+            to->word[i].raw = *to_line + (raw - from_line);
+    }
+    return true;
+}
 
-    for (int i = 1; i <= NOBJECTS; i++) {
-        game.place[i] = LOC_NOWHERE;
+struct session_t* session_clone(const struct session_t* s)
+/* A new session playing on from where s is, with the same settings
+ * except for the log, which stays with s.  Nothing said in s but not
+ * yet flushed is carried over. */
+{
+    struct session_t* clone = malloc(sizeof(struct session_t));
+    if (clone == NULL)
+        return NULL;	// LCOV_EXCL_LINE
+    *clone = *s;
+    clone->output.niov = 0;
+    clone->output.used = 0;
+    clone->playing = false;
+    clone->status = 0;
+    // Two sessions can't share one log FILE; the clone starts without one.
+    clone->settings.logfp = NULL;
+    memset(&clone->journal, '\0', sizeof(clone->journal));
+    if (!command_copy(&clone->command, &clone->command_line, &s->command, s->command_line)) {
+        free(clone);	// LCOV_EXCL_LINE
+        return NULL;	// LCOV_EXCL_LINE
     }
+    return clone;
+}
 
-    for (int i = 1; i <= NLOCATIONS; i++) {
-        if (!(locations[i].description.big == 0 ||
-              tkey[i] == 0)) {
-            int k = tkey[i];
-            if (T_TERMINATE(travel[k]))
-                conditions[i] |= (1 << COND_FORCED);
-        }
+void session_free(struct session_t* s)
+{
+    if (s == NULL)
+        return;
+    free(s->command_line);
+    journal_free(&s->journal);
+    free(s);
+}
+
+void session_end(struct session_t* session, int status)
+/* Finish the game being played and return status from play() or
+ * whichever of its kin is running it.  Outside them there is nothing
+ * to return to, so exit instead. */
+{
+    if (!session->playing) {
+        output_flush(session);
+        exit(status);
+    }
+    session->status = status;
+    longjmp(session->unwind, 1);
+}
+
+void derived_init(struct session_t* session)
+/* Rebuild everything the session keeps in step with the game. */
+{
+    hash_init(session);
+    score_init(session);
+    links_init(session);
+    index_init(session);
+    hints_init(session);
+    session->derived.threshold_next = 0;
+    session->derived.locale.valid = false;
+}
+
+long initialise(struct session_t* session)
+{
+    session->game = initial_game;
+    if (session->settings.oldstyle)
+        output_printf(session, "Initialising...\n");
+
+    long seedval = session->seed;
+    set_seed(session, seedval);
+
+    for (int i = 1; i <= NOBJECTS; i++) {
+        SETPLACE(i, LOC_NOWHERE);
     }
 
     /*  Set up the game.atloc and game.link arrays.
@@ -72,30 +163,29 @@ long initialise(void)
      *  Also, since two-placed objects are typically best described
      *  last, we'll drop them first. */
     for (int i = NOBJECTS; i >= 1; i--) {
-        if (objects[i].fixd > 0) {
-            drop(i + NOBJECTS, objects[i].fixd);
-            drop(i, objects[i].plac);
+        if (object_fixd[i] > 0) {
+            drop(session, i + NOBJECTS, object_fixd[i]);
+            drop(session, i, object_plac[i]);
         }
     }
 
     for (int i = 1; i <= NOBJECTS; i++) {
         int k = NOBJECTS + 1 - i;
-        game.fixed[k] = objects[k].fixd;
-        if (objects[k].plac != 0 && objects[k].fixd <= 0)
-            drop(k, objects[k].plac);
+        SETFIXED(k, object_fixd[k]);
+        if (object_plac[k] != 0 && object_fixd[k] <= 0)
+            drop(session, k, object_plac[k]);
     }
 
     /*  Treasure props are initially -1, and are set to 0 the first time
      *  they are described.  game.tally keeps track of how many are
      *  not yet found, so we know when to close the cave. */
-    for (int treasure = 1; treasure <= NOBJECTS; treasure++) {
-        if (objects[treasure].is_treasure) {
-            if (objects[treasure].inventory != 0)
-                game.prop[treasure] = STATE_NOTFOUND;
-            game.tally = game.tally - game.prop[treasure];
-        }
+    for (int t = 0; t < NTREASURES; t++) {
+        int treasure = treasures[t];
+        if (objects[treasure].inventory != 0)
+            SETPROP(treasure, STATE_NOTFOUND);
+        session->game.tally = session->game.tally - session->game.prop[treasure];
     }
-    game.conds = setbit(11);
+    session->game.conds = setbit(11);
 
     return seedval;
 }
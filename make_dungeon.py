@@ -20,6 +20,8 @@ C_TEMPLATE_PATH = "templates/dungeon.c.tpl"
 
 DONOTEDIT_COMMENT = "/* Generated from adventure.yaml - do not hand-hack! */\n\n"
 
+TOKLEN = 5	# must match advent.h
+
 statedefines = ""
 
 def make_c_string(string):
@@ -33,6 +35,98 @@ def make_c_string(string):
     string = '"' + string + '"'
     return string
 
+# The dungeon's text, op lists and lists of either live in three
+# pools, and the tables refer into them by offset rather than by
+# pointer so that the generated data needs no load-time relocations.
+# Offset or index 0 is reserved everywhere to mean "none".
+string_pool = ["\\0"]
+string_offsets = {}
+string_size = 1
+ops_pool = ["{MSG_END, 0}"]
+ops_indices = {}
+list_pool = [0]
+
+def runtime_text(string):
+    "The text as the C compiler will see it, backslash escapes interpreted."
+    return string.encode("ascii").decode("unicode_escape")
+
+def get_string(string):
+    """Intern a string in the pool and return its offset as C text."""
+    global string_size
+    if string == None:
+        return "0"
+    if string not in string_offsets:
+        string_offsets[string] = string_size
+        string_pool.append(make_c_string(string)[1:-1] + "\\0")
+        string_size += len(runtime_text(string)) + 1
+    return str(string_offsets[string])
+
+def get_list(values):
+    """Append a list of offsets to the list pool and return its index."""
+    if not values:
+        return "0"
+    index = len(list_pool)
+    list_pool.extend(values)
+    return str(index)
+
+def get_string_pool():
+    out = ""
+    for chunk in string_pool:
+        out += '    "' + chunk + '"\n'
+    out = out[:-1] # trim trailing newline
+    return out
+
+def get_ops_pool():
+    out = ""
+    for ops in ops_pool:
+        out += "    " + ops + ",\n"
+    out = out[:-1] # trim trailing newline
+    return out
+
+def compile_message(string):
+    """Split a message into the op list the renderer walks.
+
+    Each op covers len bytes of the message text: a literal span, one
+    of the %d/%s/%S/%V specifiers, or a "floor" that becomes "ground"
+    outdoors.  Unknown specifiers are skipped, as the old byte-at-a-time
+    renderer did.  Null and empty messages print nothing and get no ops.
+    """
+    if not string:
+        return "0"
+    if string in ops_indices:
+        return str(ops_indices[string])
+    source = string
+    # Lengths are of the text as the C compiler will see it, after any
+    # backslash escapes written in the YAML have been interpreted.
+    string = runtime_text(string)
+    specifiers = {"d": "MSG_INT", "s": "MSG_STR", "S": "MSG_PLURAL", "V": "MSG_VERSION"}
+    ops = []
+    i = literal = 0
+    def flush(end):
+        if end > literal:
+            ops.append(("MSG_TEXT", end - literal))
+    while i < len(string):
+        if string[i] == '%':
+            flush(i)
+            spec = string[i+1:i+2]
+            ops.append((specifiers.get(spec, "MSG_SKIP"), 1 + len(spec)))
+            i += 1 + len(spec)
+            literal = i
+        elif string.startswith("floor", i) and string[i+5:i+6] in ("", " ", "."):
+            flush(i)
+            ops.append(("MSG_FLOOR", 5))
+            i += 5
+            literal = i
+        else:
+            i += 1
+    flush(i)
+    for (_, n) in ops:
+        assert n < 65536
+    ops.append(("MSG_END", 0))
+    ops_indices[source] = len(ops_pool)
+    ops_pool.extend("{%s, %d}" % op for op in ops)
+    return str(ops_indices[source])
+
 def get_refs(l):
     reflist = [x[0] for x in l]
     ref_str = ""
@@ -46,10 +140,7 @@ def get_string_group(strings):
             .strs = {},
             .n = {},
         }}"""
-    if strings == []:
-        strs = "NULL"
-    else:
-        strs = "(const char* []) {" + ", ".join([make_c_string(s) for s in strings]) + "}"
+    strs = get_list([int(get_string(s)) for s in strings])
     n = len(strings)
     sg_str = template.format(strs, n)
     return sg_str
@@ -59,10 +150,19 @@ def get_arbitrary_messages(arb):
 """
     arb_str = ""
     for item in arb:
-        arb_str += template.format(make_c_string(item[1]))
+        arb_str += template.format(get_string(item[1]))
     arb_str = arb_str[:-1] # trim trailing newline
     return arb_str
 
+def get_arbitrary_message_ops(arb):
+    template = """    {},
+"""
+    ops_str = ""
+    for item in arb:
+        ops_str += template.format(compile_message(item[1]))
+    ops_str = ops_str[:-1] # trim trailing newline
+    return ops_str
+
 def get_class_messages(cls):
     template = """    {{
         .threshold = {},
@@ -72,7 +172,7 @@ def get_class_messages(cls):
     cls_str = ""
     for item in cls:
         threshold = item["threshold"]
-        message = make_c_string(item["message"])
+        message = get_string(item["message"])
         cls_str += template.format(threshold, message)
     cls_str = cls_str[:-1] # trim trailing newline
     return cls_str
@@ -84,11 +184,13 @@ def get_turn_thresholds(trn):
         .message = {},
     }},
 """
+    # Emitted in turn order, so closecheck() need only watch the next
+    # one due; the sort is stable, keeping message order within a turn.
     trn_str = ""
-    for item in trn:
+    for item in sorted(trn, key=lambda item: item["threshold"]):
         threshold = item["threshold"]
         point_loss = item["point_loss"]
-        message = make_c_string(item["message"])
+        message = get_string(item["message"])
         trn_str += template.format(threshold, point_loss, message)
     trn_str = trn_str[:-1] # trim trailing newline
     return trn_str
@@ -98,42 +200,55 @@ def get_locations(loc):
         .description = {{
             .small = {},
             .big = {},
+            .small_ops = {},
+            .big_ops = {},
         }},
-        .sound = {},
-        .loud = {},
     }},
 """
     loc_str = ""
     for (i, item) in enumerate(loc):
-        short_d = make_c_string(item[1]["description"]["short"])
-        long_d = make_c_string(item[1]["description"]["long"])
-        sound = item[1].get("sound", "SILENT")
-        loud = "true" if item[1].get("loud") else "false"
-        loc_str += template.format(i, item[0], short_d, long_d, sound, loud)
+        short_d = get_string(item[1]["description"]["short"])
+        long_d = get_string(item[1]["description"]["long"])
+        short_ops = compile_message(item[1]["description"]["short"])
+        long_ops = compile_message(item[1]["description"]["long"])
+        loc_str += template.format(i, item[0], short_d, long_d, short_ops, long_ops)
     loc_str = loc_str[:-1] # trim trailing newline
     return loc_str
 
+def get_location_sounds(loc):
+    sound_str = ""
+    loud_str = ""
+    for (name, attr) in loc:
+        sound_str += "    %s,\t// %s\n" % (attr.get("sound", "SILENT"), name)
+        loud_str += "    %s,\t// %s\n" % ("true" if attr.get("loud") else "false", name)
+    return (sound_str, loud_str)
+
+def get_placement(attr):
+    "Where an object starts out: its place and its fixed place."
+    locs = attr.get("locations", ["LOC_NOWHERE", "LOC_NOWHERE"])
+    immovable = attr.get("immovable", False)
+    try:
+        if type(locs) == str:
+            locs = [locs, -1 if immovable else 0]
+    except IndexError:
+        sys.stderr.write("dungeon: unknown object location in %s\n" % locs)
+        sys.exit(1)
+    return locs
+
 def get_objects(obj):
     template = """    {{ // {}: {}
         .words = {},
         .inventory = {},
-        .plac = {},
-        .fixd = {},
-        .is_treasure = {},
-        .descriptions = (const char* []) {{
-{}
-        }},
-        .sounds = (const char* []) {{
-{}
-        }},
-        .texts = (const char* []) {{
-{}
-        }},
-        .changes = (const char* []) {{
-{}
-        }},
+        .descriptions = {},
+        .description_ops = {},
+        .sounds = {},
+        .texts = {},
+        .changes = {},
     }},
 """
+    def get_messages(msgs):
+        # A missing list reads as a list holding one null message.
+        return get_list([int(get_string(m)) for m in (msgs or [None])])
     obj_str = ""
     for (i, item) in enumerate(obj):
         attr = item[1]
@@ -141,57 +256,56 @@ def get_objects(obj):
             words_str = get_string_group(attr["words"])
         except KeyError:
             words_str = get_string_group([])
-        i_msg = make_c_string(attr["inventory"])
-        descriptions_str = ""
-        if attr["descriptions"] == None:
-            descriptions_str = " " * 12 + "NULL,"
-        else:
+        i_msg = get_string(attr["inventory"])
+        descriptions_str = get_messages(attr["descriptions"])
+        description_ops_str = get_list([int(compile_message(m)) for m in (attr["descriptions"] or [None])])
+        if attr["descriptions"] != None:
             labels = []
-            for l_msg in attr["descriptions"]:
-                descriptions_str += " " * 12 + make_c_string(l_msg) + ",\n"
             for label in attr.get("states", []):
                 labels.append(label)
-            descriptions_str = descriptions_str[:-1] # trim trailing newline
             if labels:
                 global statedefines
                 statedefines += "/* States for %s */\n" % item[0]
                 for (j, label) in enumerate(labels):
                     statedefines += "#define %s\t%d\n" % (label, j)
                 statedefines += "\n"
-        sounds_str = ""
-        if attr.get("sounds") == None:
-            sounds_str = " " * 12 + "NULL,"
-        else:
-             for l_msg in attr["sounds"]:
-                 sounds_str += " " * 12 + make_c_string(l_msg) + ",\n"
-             sounds_str = sounds_str[:-1] # trim trailing newline
-        texts_str = ""
-        if attr.get("texts") == None:
-            texts_str = " " * 12 + "NULL,"
-        else:
-             for l_msg in attr["texts"]:
-                 texts_str += " " * 12 + make_c_string(l_msg) + ",\n"
-             texts_str = texts_str[:-1] # trim trailing newline
-        changes_str = ""
-        if attr.get("changes") == None:
-            changes_str = " " * 12 + "NULL,"
-        else:
-             for l_msg in attr["changes"]:
-                 changes_str += " " * 12 + make_c_string(l_msg) + ",\n"
-             changes_str = changes_str[:-1] # trim trailing newline
-        locs = attr.get("locations", ["LOC_NOWHERE", "LOC_NOWHERE"])
-        immovable = attr.get("immovable", False)
-        try:
-            if type(locs) == str:
-                locs = [locs, -1 if immovable else 0]
-        except IndexError:
-            sys.stderr.write("dungeon: unknown object location in %s\n" % locs)
-            sys.exit(1)
-        treasure = "true" if attr.get("treasure") else "false"
-        obj_str += template.format(i, item[0], words_str, i_msg, locs[0], locs[1], treasure, descriptions_str, sounds_str, texts_str, changes_str)
+        sounds_str = get_messages(attr.get("sounds"))
+        texts_str = get_messages(attr.get("texts"))
+        changes_str = get_messages(attr.get("changes"))
+        obj_str += template.format(i, item[0], words_str, i_msg, descriptions_str, description_ops_str, sounds_str, texts_str, changes_str)
     obj_str = obj_str[:-1] # trim trailing newline
     return obj_str
 
+def get_object_placements(obj):
+    plac_str = ""
+    fixd_str = ""
+    treasure_str = ""
+    for (name, attr) in obj:
+        locs = get_placement(attr)
+        plac_str += "    %s,\t// %s\n" % (locs[0], name)
+        fixd_str += "    %s,\t// %s\n" % (locs[1], name)
+        treasure_str += "    %s,\t// %s\n" % ("true" if attr.get("treasure") else "false", name)
+    return (plac_str, fixd_str, treasure_str)
+
+def get_treasures(obj):
+    # The treasures in object order, and as an object bitset OBJWORDS
+    # words long.  Also what each object is worth when deposited in the
+    # building: 12 points for treasures before the chest, 14 for the
+    # chest, 16 for those after it and 0 for anything else.
+    chest = [name for (name, attr) in obj].index("CHEST")
+    treasure_str = ""
+    deposit_str = ""
+    words = [0] * ((len(obj) + 63) // 64)
+    for (i, (name, attr)) in enumerate(obj):
+        points = 0
+        if attr.get("treasure"):
+            points = 12 if i < chest else 14 if i == chest else 16
+            treasure_str += "    %s,\n" % name
+            words[i // 64] |= 1 << (i % 64)
+        deposit_str += "    %d,\t// %s\n" % (points, name)
+    set_str = ", ".join("UINT64_C(0x%016x)" % w for w in words)
+    return (treasure_str, set_str, deposit_str)
+
 def get_obituaries(obit):
     template = """    {{
         .query = {},
@@ -200,8 +314,8 @@ def get_obituaries(obit):
 """
     obit_str = ""
     for o in obit:
-        query = make_c_string(o["query"])
-        yes = make_c_string(o["yes_response"])
+        query = get_string(o["query"])
+        yes = get_string(o["yes_response"])
         obit_str += template.format(query, yes)
     obit_str = obit_str[:-1] # trim trailing newline
     return obit_str
@@ -221,21 +335,39 @@ def get_hints(hnt):
         number = item["number"]
         penalty = item["penalty"]
         turns = item["turns"]
-        question = make_c_string(item["question"])
-        hint = make_c_string(item["hint"])
+        # checkhints() skips unhinted hints whose counter is idle and
+        # that don't apply here, so none may come due at zero turns.
+        assert turns > 0
+        question = get_string(item["question"])
+        hint = get_string(item["hint"])
         hnt_str += template.format(number, penalty, turns, question, hint)
     hnt_str = hnt_str[:-1] # trim trailing newline
     return hnt_str
 
-def get_condbits(locations):
-    cnd_str = ""
+def get_location_hints(locations, hnt):
+    # Which hints can come due at each location, one bit per hint in
+    # hint order; the same facts as the COND_H bits, but packed.
+    names = [member["hint"]["name"] for member in hnt]
+    assert len(names) <= 32
+    hint_str = ""
     for (name, loc) in locations:
+        mask = 0
+        for h in loc.get("hints") or []:
+            mask |= 1 << names.index(h["name"])
+        hint_str += "    0x%04x,\t// %s\n" % (mask, name)
+    return hint_str
+
+def get_condbits(locations, travel, tkey):
+    cnd_str = ""
+    for (i, (name, loc)) in enumerate(locations):
         conditions = loc["conditions"]
         hints = loc.get("hints") or []
         flaglist = []
         for flag in conditions:
             if conditions[flag]:
                 flaglist.append(flag)
+        if isforced(travel, tkey, i):
+            flaglist.append("FORCED")
         line = "|".join([("(1<<COND_%s)" % f) for f in flaglist])
         trail = "|".join([("(1<<COND_H%s)" % f['name']) for f in hints])
         if trail:
@@ -260,11 +392,6 @@ def get_motions(motions):
         else:
             words_str = get_string_group(contents["words"])
         mot_str += template.format(words_str)
-        global ignore
-        if contents.get("oldstyle", True) == False:
-            for word in contents["words"]:
-                if len(word) == 1:
-                    ignore += word.upper()
     return mot_str
 
 def get_actions(actions):
@@ -283,10 +410,7 @@ def get_actions(actions):
         else:
             words_str = get_string_group(contents["words"])
 
-        if contents["message"] == None:
-            message = "NULL"
-        else:
-            message = make_c_string(contents["message"])
+        message = get_string(contents["message"])
 
         if contents.get("noaction") == None:
             noaction = "false"
@@ -294,13 +418,88 @@ def get_actions(actions):
             noaction = "true"
 
         act_str += template.format(words_str, message, noaction)
-        global ignore
+    act_str = act_str[:-1] # trim trailing newline
+    return act_str
+
+def vocab_key(word):
+    "Pack the case-folded significant prefix of a word, as tokenize() does."
+    key = 0
+    for (i, c) in enumerate(word[:TOKLEN].lower()):
+        key |= ord(c) << (8 * i)
+    return key
+
+def vocab_hash(key, seed):
+    "Must stay in sync with vocab_hash() in misc.c."
+    key = ((key ^ seed) * 0x9E3779B97F4A7C15) & 0xFFFFFFFFFFFFFFFF
+    return key ^ (key >> 32)
+
+def buildvocab(motions, objects, actions):
+    # Compile the three vocabulary lists into a perfect-hash index keyed
+    # on the folded first TOKLEN characters of a word.  The lookup rules
+    # get_vocab_metadata() used to apply by scanning are baked in here:
+    # motions shadow objects shadow actions, the lowest-numbered entry
+    # of each wins, and in oldstyle mode single-letter motion and action
+    # words whose group is flagged "oldstyle: false" are not recognized.
+    # Each slot therefore carries two resolutions, newstyle and oldstyle.
+    ignore = ""
+    for (name, contents) in motions + actions:
         if contents.get("oldstyle", True) == False:
             for word in contents["words"]:
                 if len(word) == 1:
                     ignore += word.upper()
-    act_str = act_str[:-1] # trim trailing newline
-    return act_str
+    resolved = {}
+    for (wtype, vocab) in (("MOTION", motions), ("OBJECT", objects), ("ACTION", actions)):
+        for (i, (name, contents)) in enumerate(vocab):
+            for word in contents.get("words") or []:
+                key = vocab_key(word)
+                matches = resolved.setdefault(key, [word[:TOKLEN], None, None])
+                if matches[1] is None:
+                    matches[1] = (wtype, i)
+                if matches[2] is None and (wtype == "OBJECT" or len(word) > 1 or word.upper() not in ignore):
+                    matches[2] = (wtype, i)
+    # Hash-and-displace: each key goes to bucket vocab_hash(key, 0), and
+    # every bucket gets the smallest displacement that scatters its keys
+    # into free slots.  Fullest buckets are placed first.
+    nslots = 1
+    while nslots < len(resolved) * 3 // 2:
+        nslots *= 2
+    nbuckets = max(1, len(resolved) // 4)
+    buckets = [[] for _ in range(nbuckets)]
+    for key in resolved:
+        buckets[vocab_hash(key, 0) % nbuckets].append(key)
+    displace = [0] * nbuckets
+    slots = [None] * nslots
+    for b in sorted(range(nbuckets), key=lambda b: -len(buckets[b])):
+        if not buckets[b]:
+            continue
+        for d in range(1, 65536):
+            placed = set(vocab_hash(key, d) % nslots for key in buckets[b])
+            if len(placed) == len(buckets[b]) and all(slots[j] is None for j in placed):
+                break
+        else:
+            sys.stderr.write("dungeon: cannot build vocabulary hash\n")
+            sys.exit(1)
+        displace[b] = d
+        for key in buckets[b]:
+            slots[vocab_hash(key, d) % nslots] = key
+    return (resolved, slots, displace)
+
+def get_vocab_slots(resolved, slots):
+    template = """    {{ // {}
+        .key = {},
+        .match = {{{{{}, {}}}, {{{}, {}}}}},
+    }},
+"""
+    out = ""
+    for key in slots:
+        if key is None:
+            out += "    {0},\n"
+            continue
+        (word, newstyle, oldstyle) = resolved[key]
+        oldstyle = oldstyle or ("NO_WORD_TYPE", 0)
+        out += template.format(word, hex(key), newstyle[0], newstyle[1], oldstyle[0], oldstyle[1])
+    out = out[:-1] # trim trailing newline
+    return out
 
 def bigdump(arr):
     out = ""
@@ -503,6 +702,114 @@ def buildtravel(locs, objs):
         travel[-1][-1] = "true"
     return (travel, tkey)
 
+def buildtravelindex(travel, tkey):
+    # For each location and motion, the entry playermove() would stop
+    # at when scanning that location's travel rules: the first one for
+    # the motion or the first unconditional (T_TERMINATE) one, whichever
+    # comes first.  Stored as 1 + offset from tkey so that it fits in a
+    # byte, with 0 meaning the motion goes nowhere from there.
+    assert len(tkey) == len(db["locations"])
+    index = []
+    for start in tkey:
+        row = [0] * len(motionnames)
+        if start != 0:
+            end = start
+            while travel[end][-1] != "true":
+                end += 1
+            for (m, name) in enumerate(motionnames):
+                for e in range(start, end + 1):
+                    motion = travel[e][2]
+                    if type(motion) == str:
+                        motion = motionnames.index(motion)
+                    if motion == 1 or motion == m:
+                        row[m] = e - start + 1
+                        break
+        assert max(row) < 256
+        index.append(row)
+    return index
+
+def get_travel_index(index):
+    out = ""
+    for (i, row) in enumerate(index):
+        out += "    {{{}}}, // {}\n".format(", ".join(str(n) for n in row), db["locations"][i][0])
+    out = out[:-1] # trim trailing newline
+    return out
+
+def isforced(travel, tkey, loc):
+    "Is loc a forced-motion location, one whose first rule has no verb?"
+    return (db["locations"][loc][1]["description"]["long"] is not None
+            and tkey[loc] != 0 and travel[tkey[loc]][2] in (1, motionnames[1]))
+
+def buildforced(travel, tkey):
+    # Where each forced-motion location sends the player when its first
+    # travel rule is an unconditional goto, so playermove() needn't be
+    # consulted; -1 everywhere else.  Chains of these could in principle
+    # be followed to the end here, but every hop has to be described
+    # and has to pass the cave-closing check as it happens, so each
+    # entry is a single hop and do_command() follows the chain.
+    forced = []
+    for (loc, start) in enumerate(tkey):
+        dest = -1
+        if isforced(travel, tkey, loc):
+            rule = travel[start]
+            if rule[3] == "cond_goto" and rule[4] == 0 and rule[6] == "dest_goto":
+                dest = locnames.index(rule[7])
+        forced.append(dest)
+    return forced
+
+def builddwarfmoves(travel, tkey):
+    # For each location, the destinations a wandering dwarf (and
+    # separately the pirate) may take from it, in travel-table order:
+    # plain gotos into the deep cave, not back to the same place, not
+    # into forced-motion locations, not forbidden to dwarves, and for
+    # the pirate not marked NOARRR.  Runs of the same destination are
+    # collapsed, since dwarfmove() would skip the repeats anyway.  What
+    # remains for dwarfmove() is excluding the dwarf's previous spot.
+    locs = db["locations"]
+    def cond(loc, flag):
+        return locs[loc][1]["conditions"].get(flag, False)
+    def forced(loc):
+        return isforced(travel, tkey, loc)
+    def indeep(loc):
+        return loc >= locnames.index("LOC_MISTHALL") and not (cond(loc, "ABOVE") or cond(loc, "FOREST"))
+    moves = []
+    for (loc, start) in enumerate(tkey):
+        dwarves = []
+        pirate = []
+        newloc = "LOC_NOWHERE"
+        e = start
+        while start != 0:
+            newloc = travel[e][7]
+            if travel[e][6] == "dest_goto" and travel[e][8] == "false":
+                dest = locnames.index(newloc)
+                if indeep(dest) and dest != loc and not forced(dest):
+                    if not dwarves or dwarves[-1] != newloc:
+                        dwarves.append(newloc)
+                    if not cond(dest, "NOARRR") and (not pirate or pirate[-1] != newloc):
+                        pirate.append(newloc)
+            if travel[e][-1] == "true":
+                break
+            e += 1
+        assert len(dwarves) < 20 and len(pirate) < 20	# must fit tk[] in dwarfmove()
+        moves.append((locnames[loc], dwarves, pirate, newloc))
+    return moves
+
+def get_dwarf_moves(moves):
+    template = """    {{ // {}
+        .dwarves = {},
+        .pirate = {},
+        .newloc = {},
+    }},
+"""
+    out = ""
+    for (name, dwarves, pirate, newloc) in moves:
+        out += template.format(name,
+                               get_list([locnames.index(d) for d in dwarves] + [0]),
+                               get_list([locnames.index(d) for d in pirate] + [0]),
+                               newloc)
+    out = out[:-1] # trim trailing newline
+    return out
+
 def get_travel(travel):
     template = """    {{ // from {}: {}
         .motion = {},
@@ -511,13 +818,28 @@ def get_travel(travel):
         .condarg2 = {},
         .desttype = {},
         .destval = {},
-        .nodwarves = {},
-        .stop = {},
+        .flags = {},
     }},
 """
+    def number(value, names):
+        return names.index(value) if type(value) == str else int(value)
     out = ""
-    for entry in travel:
-        out += template.format(*entry)
+    for (loc, name, motion, condtype, condarg1, condarg2,
+         desttype, destval, nodwarves, stop) in travel:
+        # Make sure everything fits the packed travelop_t
+        assert number(motion, motionnames) < 256
+        assert number(condarg1, objnames) < 256
+        assert 0 <= int(condarg2) < 256
+        destnames = msgnames if desttype == "dest_speak" else locnames
+        assert number(destval, destnames) < 65536
+        flags = []
+        if nodwarves == "true":
+            flags.append("TF_NODWARVES")
+        if stop == "true":
+            flags.append("TF_STOP")
+        out += template.format(loc, name, motion, condtype, condarg1,
+                               int(condarg2), desttype, destval,
+                               " | ".join(flags) or "0")
     out = out[:-1] # trim trailing newline
     return out
 
@@ -532,7 +854,12 @@ if __name__ == "__main__":
 
     (travel, tkey) = buildtravel(db["locations"],
                                  db["objects"])
-    ignore = ""
+    travelindex = buildtravelindex(travel, tkey)
+    dwarfmoves = builddwarfmoves(travel, tkey)
+    forced = buildforced(travel, tkey)
+    (vocab, vocab_slots, vocab_displace) = buildvocab(db["motions"],
+                                                      db["objects"],
+                                                      db["actions"])
     try:
         with open(H_TEMPLATE_PATH, "r") as htf:
             # read in dungeon.h template
@@ -544,21 +871,43 @@ if __name__ == "__main__":
         print('ERROR: reading template failed ({})'.format(e.strerror))
         exit(-1)
 
+    placements = get_object_placements(db["objects"])
+    sounds = get_location_sounds(db["locations"])
+    treasures = get_treasures(db["objects"])
+
     c = c_template.format(
         h_file             = H_NAME,
         arbitrary_messages = get_arbitrary_messages(db["arbitrary_messages"]),
+        arbitrary_message_ops = get_arbitrary_message_ops(db["arbitrary_messages"]),
         classes            = get_class_messages(db["classes"]),
         turn_thresholds    = get_turn_thresholds(db["turn_thresholds"]),
         locations          = get_locations(db["locations"]),
         objects            = get_objects(db["objects"]),
+        object_plac        = placements[0],
+        object_fixd        = placements[1],
+        object_treasure    = placements[2],
+        location_sound     = sounds[0],
+        location_loud      = sounds[1],
+        treasures          = treasures[0],
+        treasure_set       = treasures[1],
+        deposit_points     = treasures[2],
         obituaries         = get_obituaries(db["obituaries"]),
         hints              = get_hints(db["hints"]),
-        conditions         = get_condbits(db["locations"]),
+        conditions         = get_condbits(db["locations"], travel, tkey),
+        location_hints     = get_location_hints(db["locations"], db["hints"]),
         motions            = get_motions(db["motions"]),
         actions            = get_actions(db["actions"]),
         tkeys              = bigdump(tkey),
         travel             = get_travel(travel), 
-        ignore             = ignore
+        travel_index       = get_travel_index(travelindex),
+        dwarf_moves        = get_dwarf_moves(dwarfmoves),
+        forced_dest        = bigdump(forced),
+        vocab_slots        = get_vocab_slots(vocab, vocab_slots),
+        vocab_displace     = bigdump(vocab_displace),
+        # The pools must come last, after everything that adds to them.
+        dungeon_strings    = get_string_pool(),
+        message_ops        = get_ops_pool(),
+        dungeon_lists      = bigdump(list_pool),
     )
 
     # 0-origin index of birds's last song.  Bird should
@@ -568,6 +917,7 @@ if __name__ == "__main__":
     h = h_template.format(
         num_locations      = len(db["locations"])-1,
         num_objects        = len(db["objects"])-1,
+        num_treasures      = len([o for o in db["objects"] if o[1].get("treasure")]),
         num_hints          = len(db["hints"]),
         num_classes        = len(db["classes"])-1,
         num_deaths         = len(db["obituaries"]),
@@ -576,6 +926,8 @@ if __name__ == "__main__":
         num_actions        = len(db["actions"]),
         num_travel         = len(travel),
         num_keys           = len(tkey),
+        num_vocab_slots    = len(vocab_slots),
+        num_vocab_buckets  = len(vocab_displace),
         bird_endstate      = deathbird,
         arbitrary_messages = get_refs(db["arbitrary_messages"]),
         locations          = get_refs(db["locations"]),
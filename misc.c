@@ -15,131 +15,294 @@
 #include <ctype.h>
 #include <editline/readline.h>
 #include <inttypes.h>
+#include <errno.h>
+#include <sys/uio.h>
 
 #include "advent.h"
 #include "dungeon.h"
 
-static void* xcalloc(size_t size)
+/*  Output sink.  Everything the game says between two prompts is
+ *  gathered here and written with one writev() when it next wants
+ *  input, so a busy turn costs a single system call.  Message text
+ *  from the dungeon tables has static storage and is queued in place;
+ *  anything transient, and literals too short to be worth an iovec of
+ *  their own, are copied into the scratch buffer, where neighbours
+ *  share one.  With settings.linebuffer set, as it is on a terminal,
+ *  each message goes out as soon as it is complete. */
+
+void output_flush(struct session_t* session)
 {
-    void* ptr = calloc(size, 1);
-    if (ptr == NULL) {
-        // LCOV_EXCL_START
-        // exclude from coverage analysis because we can't simulate an out of memory error in testing
-        fprintf(stderr, "Out of memory!\n");
-        exit(EXIT_FAILURE);
-        // LCOV_EXCL_STOP
+    struct output_t* out = &session->output;
+    struct iovec* iov = out->iov;
+    int niov = out->niov;
+    while (niov > 0) {
+        ssize_t n = writev(session->settings.outfd, iov, niov);
+        if (n < 0) {
+            if (errno == EINTR)
+                continue;
+            break;	// LCOV_EXCL_LINE - nowhere left to report it
+        }
+        // Step past whatever a short write did get out.
+        while (niov > 0 && (size_t)n >= iov->iov_len) {
+            n -= iov->iov_len;
+            ++iov;
+            --niov;
+        }
+        if (niov > 0) {
+            iov->iov_base = (char*)iov->iov_base + n;
+            iov->iov_len -= n;
+        }
+    }
+    out->niov = 0;
+    out->used = 0;
+}
+
+static void output_static(struct session_t* session, const char* text, size_t len)
+/* Queue text with static storage without copying it. */
+{
+    struct output_t* out = &session->output;
+    if (len == 0)
+        return;
+    if (out->niov == OUTPUT_IOVECS)
+        output_flush(session);
+    // writev() never writes through iov_base; launder away the const.
+    out->iov[out->niov].iov_base = (void*)(uintptr_t)text;
+    out->iov[out->niov].iov_len = len;
+    out->niov++;
+}
+
+static void output_reserve(struct session_t* session)
+/* Make sure there is scratch space and an iovec to describe it. */
+{
+    struct output_t* out = &session->output;
+    if (out->used == OUTPUT_SCRATCH || out->niov == OUTPUT_IOVECS)
+        output_flush(session);
+}
+
+static void output_commit(struct session_t* session, size_t len)
+/* Queue the next len bytes of scratch, extending the last iovec if
+ * it already ends there. */
+{
+    struct output_t* out = &session->output;
+    char* text = out->scratch + out->used;
+    struct iovec* last = out->niov > 0 ? &out->iov[out->niov - 1] : NULL;
+    if (last != NULL && (char*)last->iov_base + last->iov_len == text)
+        last->iov_len += len;
+    else
+        output_static(session, text, len);
+    out->used += len;
+}
+
+static void output_copy(struct session_t* session, const char* text, size_t len)
+/* Queue transient text by copying it into scratch. */
+{
+    struct output_t* out = &session->output;
+    while (len > 0) {
+        output_reserve(session);
+        size_t n = OUTPUT_SCRATCH - out->used;
+        if (n > len)
+            n = len;
+        memcpy(out->scratch + out->used, text, n);
+        output_commit(session, n);
+        text += n;
+        len -= n;
     }
-    return (ptr);
+}
+
+static void output_vprintf(struct session_t* session, const char* fmt, va_list ap)
+{
+    struct output_t* out = &session->output;
+    va_list aq;
+    va_copy(aq, ap);
+    output_reserve(session);
+    size_t room = OUTPUT_SCRATCH - out->used;
+    int n = vsnprintf(out->scratch + out->used, room, fmt, ap);
+    if (n >= 0 && (size_t)n >= room) {
+        output_flush(session);
+        if (n < OUTPUT_SCRATCH)
+            vsnprintf(out->scratch, OUTPUT_SCRATCH, fmt, aq);
+        else {
+            /* Too big for scratch at all; format it on the heap and
+             * let output_copy() feed it through in pieces. */
+            char* big = malloc(n + 1);
+            if (big == NULL) {
+                // LCOV_EXCL_START
+                fprintf(stderr, "advent: out of memory\n");
+                exit(EXIT_FAILURE);
+                // LCOV_EXCL_STOP
+            }
+            vsnprintf(big, n + 1, fmt, aq);
+            output_copy(session, big, n);
+            free(big);
+            n = 0;
+        }
+    }
+    va_end(aq);
+    if (n > 0)
+        output_commit(session, n);
+}
+
+void output_printf(struct session_t* session, const char* fmt, ...)
+{
+    va_list ap;
+    va_start(ap, fmt);
+    output_vprintf(session, fmt, ap);
+    va_end(ap);
+}
+
+static void output_endline(struct session_t* session)
+{
+    output_copy(session, "\n", 1);
+    if (session->settings.linebuffer)
+        output_flush(session);
 }
 
 /*  I/O routines (speak, pspeak, rspeak, sspeak, get_input, yes) */
 
-static void vspeak(const char* msg, bool blank, va_list ap)
+static void vspeak(struct session_t* session, const char* msg, bool blank, va_list ap)
 {
     // Do nothing if we got a null pointer.
     if (msg == NULL)
         return;
 
     // Do nothing if we got an empty string.
-    if (strlen(msg) == 0)
+    if (msg[0] == '\0')
         return;
 
     if (blank == true)
-        printf("\n");
+        output_copy(session, "\n", 1);
 
     int msglen = strlen(msg);
 
-    // Rendered string
-    ssize_t size = 2000; /* msglen > 50 ? msglen*2 : 100; */
-    char* rendered = xcalloc(size);
-    char* renderp = rendered;
-
-    // Handle format specifiers (including the custom %S) by
-    // adjusting the parameter accordingly, and replacing the
-    // specifier with %s.
+    // Runs of literal text are queued whole; format specifiers
+    // (including the custom %S) and the floor/ground substitution are
+    // expanded where they occur.
     bool pluralize = false;
+    int span = 0;
     for (int i = 0; i < msglen; i++) {
         if (msg[i] != '%') {
             /* Ugh.  Least obtrusive way to deal with artifacts "on the floor"
              * being dropped outside of both cave and building. */
-            if (strncmp(msg + i, "floor", 5) == 0 && strchr(" .", msg[i + 5]) && !INSIDE(game.loc)) {
-                strcpy(renderp, "ground");
-                renderp += 6;
+            if (strncmp(msg + i, "floor", 5) == 0 && strchr(" .", msg[i + 5]) && !LOCALE(inside)) {
+                output_static(session, msg + span, i - span);
+                output_copy(session, "ground", 6);
                 i += 4;
-                size -= 5;
-            } else {
-                *renderp++ = msg[i];
-                size--;
-            }
-        } else {
-            i++;
-            // Integer specifier.
-            if (msg[i] == 'd') {
-                int32_t arg = va_arg(ap, int32_t);
-                int ret = snprintf(renderp, size, "%" PRId32, arg);
-                if (ret < size) {
-                    renderp += ret;
-                    size -= ret;
-                }
-                pluralize = (arg != 1);
-            }
-
-            // Unmodified string specifier.
-            if (msg[i] == 's') {
-                char *arg = va_arg(ap, char *);
-                strncat(renderp, arg, size - 1);
-                size_t len = strlen(renderp);
-                renderp += len;
-                size -= len;
+                span = i + 1;
             }
+            continue;
+        }
+        output_static(session, msg + span, i - span);
+        i++;
+        // Integer specifier.
+        if (msg[i] == 'd') {
+            int32_t arg = va_arg(ap, int32_t);
+            output_printf(session, "%" PRId32, arg);
+            pluralize = (arg != 1);
+        }
 
-            // Singular/plural specifier.
-            if (msg[i] == 'S') {
-                // look at the *previous* numeric parameter
-                if (pluralize) {
-                    *renderp++ = 's';
-                    size--;
-                }
-            }
+        // Unmodified string specifier.
+        if (msg[i] == 's') {
+            char *arg = va_arg(ap, char *);
+            output_copy(session, arg, strlen(arg));
+        }
 
-            // LCOV_EXCL_START - doesn't occur in test suite.
-            /* Version specifier */
-            if (msg[i] == 'V') {
-                strcpy(renderp, VERSION);
-                size_t len = strlen(VERSION);
-                renderp += len;
-                size -= len;
-            }
-            // LCOV_EXCL_STOP
+        // Singular/plural specifier.
+        if (msg[i] == 'S') {
+            // look at the *previous* numeric parameter
+            if (pluralize)
+                output_copy(session, "s", 1);
         }
+
+        // LCOV_EXCL_START - doesn't occur in test suite.
+        /* Version specifier */
+        if (msg[i] == 'V')
+            output_static(session, VERSION, strlen(VERSION));
+        // LCOV_EXCL_STOP
+        span = i + 1;
     }
-    *renderp = 0;
+    if (span < msglen)
+        output_static(session, msg + span, msglen - span);
+    output_endline(session);
+}
 
-    // Print the message.
-    printf("%s\n", rendered);
+static void render(struct session_t* session, const char* msg, const msgop_t* ops, bool blank, va_list ap)
+/* Print a message the dungeon compiler has already split into ops. */
+{
+    // Null and empty messages were compiled to no ops at all.
+    if (ops == NULL)
+        return;
+
+    if (blank == true)
+        output_copy(session, "\n", 1);
 
-    free(rendered);
+    bool pluralize = false;
+    for (; ops->kind != MSG_END; msg += ops->len, ops++) {
+        switch (ops->kind) {
+        case MSG_TEXT:
+            output_static(session, msg, ops->len);
+            break;
+        case MSG_INT: {
+            int32_t arg = va_arg(ap, int32_t);
+            output_printf(session, "%" PRId32, arg);
+            pluralize = (arg != 1);
+            break;
+        }
+        case MSG_STR: {
+            char *arg = va_arg(ap, char *);
+            output_copy(session, arg, strlen(arg));
+            break;
+        }
+        case MSG_PLURAL:
+            // look at the *previous* numeric parameter
+            if (pluralize)
+                output_copy(session, "s", 1);
+            break;
+        // LCOV_EXCL_START - doesn't occur in test suite.
+        case MSG_VERSION:
+            output_static(session, VERSION, strlen(VERSION));
+            break;
+        // LCOV_EXCL_STOP
+        case MSG_FLOOR:
+            /* Ugh.  Least obtrusive way to deal with artifacts "on the floor"
+             * being dropped outside of both cave and building. */
+            if (LOCALE(inside))
+                output_copy(session, "floor", 5);
+            else
+                output_copy(session, "ground", 6);
+            break;
+        }
+    }
+    output_endline(session);
 }
 
-void speak(const char* msg, ...)
+void speak(struct session_t* session, string_t msg, ...)
 {
     va_list ap;
     va_start(ap, msg);
-    vspeak(msg, true, ap);
+    vspeak(session, STRING(msg), true, ap);
     va_end(ap);
 }
 
-void sspeak(const int msg, ...)
+void cspeak(struct session_t* session, string_t msg, msgops_t ops, ...)
+/* Like speak(), for a message that comes with its compiled ops. */
+{
+    va_list ap;
+    va_start(ap, ops);
+    render(session, STRING(msg), MSGOPS(ops), true, ap);
+    va_end(ap);
+}
+
+void sspeak(struct session_t* session, const int msg, ...)
 {
     va_list ap;
     va_start(ap, msg);
-    fputc('\n', stdout);
-    vprintf(arbitrary_messages[msg], ap);
-    fputc('\n', stdout);
+    output_copy(session, "\n", 1);
+    output_vprintf(session, STRING(arbitrary_messages[msg]), ap);
+    output_endline(session);
     va_end(ap);
 }
 
-void pspeak(vocab_t msg, enum speaktype mode, int skip, bool blank, ...)
+void pspeak(struct session_t* session, vocab_t msg, enum speaktype mode, int skip, bool blank, ...)
 /* Find the skip+1st message from msg and print it.  Modes are:
  * feel = for inventory, what you can touch
  * look = the full description for the state the object is in
@@ -150,77 +313,65 @@ void pspeak(vocab_t msg, enum speaktype mode, int skip, bool blank, ...)
     va_start(ap, blank);
     switch (mode) {
     case touch:
-        vspeak(objects[msg].inventory, blank, ap);
+        vspeak(session, STRING(objects[msg].inventory), blank, ap);
         break;
     case look:
-        vspeak(objects[msg].descriptions[skip], blank, ap);
+        render(session, STRING(LIST(objects[msg].descriptions, skip)),
+               MSGOPS(LIST(objects[msg].description_ops, skip)), blank, ap);
         break;
     case hear:
-        vspeak(objects[msg].sounds[skip], blank, ap);
+        vspeak(session, STRING(LIST(objects[msg].sounds, skip)), blank, ap);
         break;
     case study:
-        vspeak(objects[msg].texts[skip], blank, ap);
+        vspeak(session, STRING(LIST(objects[msg].texts, skip)), blank, ap);
         break;
     case change:
-        vspeak(objects[msg].changes[skip], blank, ap);
+        vspeak(session, STRING(LIST(objects[msg].changes, skip)), blank, ap);
         break;
     }
     va_end(ap);
 }
 
-void rspeak(vocab_t i, ...)
+void rspeak(struct session_t* session, vocab_t i, ...)
 /* Print the i-th "random" message (section 6 of database). */
 {
     va_list ap;
     va_start(ap, i);
-    vspeak(arbitrary_messages[i], true, ap);
+    render(session, STRING(arbitrary_messages[i]), MSGOPS(arbitrary_message_ops[i]), true, ap);
     va_end(ap);
 }
 
 void echo_input(FILE* destination, const char* input_prompt, const char* input)
 {
-    size_t len = strlen(input_prompt) + strlen(input) + 1;
-    char* prompt_and_input = (char*) xcalloc(len);
-    strcpy(prompt_and_input, input_prompt);
-    strcat(prompt_and_input, input);
-    fprintf(destination, "%s\n", prompt_and_input);
-    free(prompt_and_input);
+    fprintf(destination, "%s%s\n", input_prompt, input);
 }
 
-static int word_count(char* str)
+char* console_input(struct session_t* session, const char* prompt)
+/* The default input routine: read from standard input through
+ * readline().  History is only any use to someone editing at a
+ * terminal, and it costs an allocation per line. */
 {
-    char delims[] = " \t";
-    int count = 0;
-    int inblanks = true;
-
-    for (char *s = str; *s; s++)
-        if (inblanks) {
-            if (strchr(delims, *s) == 0) {
-                ++count;
-                inblanks = false;
-            }
-        } else {
-            if (strchr(delims, *s) != 0) {
-                inblanks = true;
-            }
-        }
-
-    return (count);
+    (void)session;
+    char* line = readline(prompt);
+    if (line != NULL && isatty(STDIN_FILENO))
+        add_history(line);
+    return line;
 }
 
-static char* get_input(void)
+static char* get_input(struct session_t* session)
 {
     // Set up the prompt
     char input_prompt[] = "> ";
-    if (!settings.prompt)
+    if (!session->settings.prompt)
         input_prompt[0] = '\0';
 
-    // Print a blank line
-    printf("\n");
+    // Print a blank line, then let everything out before waiting
+    output_copy(session, "\n", 1);
+    output_flush(session);
 
     char* input;
     while (true) {
-        input = readline(input_prompt);
+        input = session->settings.input(session, input_prompt);
 
         if (input == NULL) // Got EOF; return with it.
             return (input);
@@ -235,117 +386,96 @@ static char* get_input(void)
     // Strip trailing newlines from the input
     input[strcspn(input, "\n")] = 0;
 
-    add_history(input);
-
-    if (!isatty(0))
-        echo_input(stdout, input_prompt, input);
+    if (session->settings.echo)
+        output_printf(session, "%s%s\n", input_prompt, input);
 
-    if (settings.logfp)
-        echo_input(settings.logfp, "", input);
+    if (session->settings.logfp)
+        echo_input(session->settings.logfp, "", input);
 
     return (input);
 }
 
-bool silent_yes(void)
+static char reply_letter(const char* reply)
+/* The lowercased first letter of the first word of a yes/no reply;
+ * "y", "yes" and "yeah" all count as yes, and so on. */
+{
+    while (isspace((unsigned char)*reply))
+        ++reply;
+    return tolower((unsigned char)*reply);
+}
+
+bool silent_yes(struct session_t* session)
 {
     bool outcome = false;
 
     for (;;) {
-        char* reply = get_input();
+        char* reply = get_input(session);
         if (reply == NULL) {
             // LCOV_EXCL_START
             // Should be unreachable. Reply should never be NULL
             free(reply);
-            exit(EXIT_SUCCESS);
+            session_end(session, EXIT_SUCCESS);
             // LCOV_EXCL_STOP
         }
-        if (strlen(reply) == 0) {
+        if (reply[0] == '\0') {
             free(reply);
-            rspeak(PLEASE_ANSWER);
+            rspeak(session, PLEASE_ANSWER);
             continue;
         }
 
-        char* firstword = (char*) xcalloc(strlen(reply) + 1);
-        sscanf(reply, "%s", firstword);
-
+        char answer = reply_letter(reply);
         free(reply);
 
-        for (int i = 0; i < (int)strlen(firstword); ++i)
-            firstword[i] = tolower(firstword[i]);
-
-        int yes = strncmp("yes", firstword, sizeof("yes") - 1);
-        int y = strncmp("y", firstword, sizeof("y") - 1);
-        int no = strncmp("no", firstword, sizeof("no") - 1);
-        int n = strncmp("n", firstword, sizeof("n") - 1);
-
-        free(firstword);
-
-        if (yes == 0 ||
-            y == 0) {
+        if (answer == 'y') {
             outcome = true;
             break;
-        } else if (no == 0 ||
-                   n == 0) {
+        } else if (answer == 'n') {
             outcome = false;
             break;
         } else
-            rspeak(PLEASE_ANSWER);
+            rspeak(session, PLEASE_ANSWER);
     }
     return (outcome);
 }
 
 
-bool yes(const char* question, const char* yes_response, const char* no_response)
+bool yes(struct session_t* session, string_t question, string_t yes_response, string_t no_response)
 /*  Print message X, wait for yes/no answer.  If yes, print Y and return true;
  *  if no, print Z and return false. */
 {
     bool outcome = false;
 
     for (;;) {
-        speak(question);
+        speak(session, question);
 
-        char* reply = get_input();
+        char* reply = get_input(session);
         if (reply == NULL) {
             // LCOV_EXCL_START
             // Should be unreachable. Reply should never be NULL
             free(reply);
-            exit(EXIT_SUCCESS);
+            session_end(session, EXIT_SUCCESS);
             // LCOV_EXCL_STOP
         }
 
-        if (strlen(reply) == 0) {
+        if (reply[0] == '\0') {
             free(reply);
-            rspeak(PLEASE_ANSWER);
+            rspeak(session, PLEASE_ANSWER);
             continue;
         }
 
-        char* firstword = (char*) xcalloc(strlen(reply) + 1);
-        sscanf(reply, "%s", firstword);
-
+        char answer = reply_letter(reply);
         free(reply);
 
-        for (int i = 0; i < (int)strlen(firstword); ++i)
-            firstword[i] = tolower(firstword[i]);
-
-        int yes = strncmp("yes", firstword, sizeof("yes") - 1);
-        int y = strncmp("y", firstword, sizeof("y") - 1);
-        int no = strncmp("no", firstword, sizeof("no") - 1);
-        int n = strncmp("n", firstword, sizeof("n") - 1);
-
-        free(firstword);
-
-        if (yes == 0 ||
-            y == 0) {
-            speak(yes_response);
+        if (answer == 'y') {
+            speak(session, yes_response);
             outcome = true;
             break;
-        } else if (no == 0 ||
-                   n == 0) {
-            speak(no_response);
+        } else if (answer == 'n') {
+            speak(session, no_response);
             outcome = false;
             break;
         } else
-            rspeak(PLEASE_ANSWER);
+            rspeak(session, PLEASE_ANSWER);
 
     }
 
@@ -354,47 +484,24 @@ bool yes(const char* question, const char* yes_response, const char* no_response
 
 /*  Data structure  routines */
 
-static int get_motion_vocab_id(const char* word)
-// Return the first motion number that has 'word' as one of its words.
+static uint64_t vocab_hash(uint64_t key, uint64_t seed)
+/* Must stay in sync with vocab_hash() in make_dungeon.py. */
 {
-    for (int i = 0; i < NMOTIONS; ++i) {
-        for (int j = 0; j < motions[i].words.n; ++j) {
-            if (strncasecmp(word, motions[i].words.strs[j], TOKLEN) == 0 && (strlen(word) > 1 ||
-                    strchr(ignore, word[0]) == NULL ||
-                    !settings.oldstyle))
-                return (i);
-        }
-    }
-    // If execution reaches here, we didn't find the word.
-    return (WORD_NOT_FOUND);
-}
-
-static int get_object_vocab_id(const char* word)
-// Return the first object number that has 'word' as one of its words.
-{
-    for (int i = 0; i < NOBJECTS + 1; ++i) { // FIXME: the + 1 should go when 1-indexing for objects is removed
-        for (int j = 0; j < objects[i].words.n; ++j) {
-            if (strncasecmp(word, objects[i].words.strs[j], TOKLEN) == 0)
-                return (i);
-        }
-    }
-    // If execution reaches here, we didn't find the word.
-    return (WORD_NOT_FOUND);
+    key = (key ^ seed) * 0x9E3779B97F4A7C15ULL;
+    return key ^ (key >> 32);
 }
 
-static int get_action_vocab_id(const char* word)
-// Return the first motion number that has 'word' as one of its words.
+static const vocab_match_t* get_vocab_match(struct session_t* session, uint64_t key)
+/* Look up the meaning of a word key in the generated vocabulary index.
+ * Motions, objects and actions are all in one table; precedence among
+ * them and the oldstyle single-letter rule were resolved when the
+ * table was built. */
 {
-    for (int i = 0; i < NACTIONS; ++i) {
-        for (int j = 0; j < actions[i].words.n; ++j) {
-            if (strncasecmp(word, actions[i].words.strs[j], TOKLEN) == 0 && (strlen(word) > 1 ||
-                    strchr(ignore, word[0]) == NULL ||
-                    !settings.oldstyle))
-                return (i);
-        }
-    }
-    // If execution reaches here, we didn't find the word.
-    return (WORD_NOT_FOUND);
+    int bucket = vocab_hash(key, 0) % NVOCABBUCKETS;
+    const vocab_entry_t* slot = &vocabulary[vocab_hash(key, vocab_displace[bucket]) % NVOCABSLOTS];
+    if (slot->key != key)
+        return NULL;
+    return &slot->match[session->settings.oldstyle ? 1 : 0];
 }
 
 static bool is_valid_int(const char *str)
@@ -421,40 +528,24 @@ static bool is_valid_int(const char *str)
     return true;
 }
 
-static void get_vocab_metadata(command_word_t* word)
+static void get_vocab_metadata(struct session_t* session, command_word_t* word, uint64_t key)
 {
     /* Check for an empty string */
-    if (strncmp(word->raw, "", sizeof("")) == 0) {
+    if (word->raw[0] == '\0') {
         word->id = WORD_EMPTY;
         word->type = NO_WORD_TYPE;
         return;
     }
 
-    vocab_t ref_num;
-
-    ref_num = get_motion_vocab_id(word->raw);
-    if (ref_num != WORD_NOT_FOUND) {
-        word->id = ref_num;
-        word->type = MOTION;
-        return;
-    }
-
-    ref_num = get_object_vocab_id(word->raw);
-    if (ref_num != WORD_NOT_FOUND) {
-        word->id = ref_num;
-        word->type = OBJECT;
-        return;
-    }
-
-    ref_num = get_action_vocab_id(word->raw);
-    if (ref_num != WORD_NOT_FOUND) {
-        word->id = ref_num;
-        word->type = ACTION;
+    const vocab_match_t* match = get_vocab_match(session, key);
+    if (match != NULL && match->type != NO_WORD_TYPE) {
+        word->id = match->id;
+        word->type = match->type;
         return;
     }
 
     // Check for the reservoir magic word.
-    if (strcasecmp(word->raw, game.zzword) == 0) {
+    if (strcasecmp(word->raw, session->game.zzword) == 0) {
         word->id = PART;
         word->type = ACTION;
         return;
@@ -472,83 +563,115 @@ static void get_vocab_metadata(command_word_t* word)
     return;
 }
 
-static void tokenize(char* raw, command_t *cmd)
-{
-    memset(cmd, '\0', sizeof(command_t));
-
-    /* Bound prefix on the %s would be needed to prevent buffer
-     * overflow.  but we shortstop this more simply by making each
-     * raw-input buffer as long as the entire input buffer. */
-    sscanf(raw, "%s%s", cmd->word[0].raw, cmd->word[1].raw);
-
-    /* (ESR) In oldstyle mode, simulate the uppercasing and truncating
-     * effect on raw tokens of packing them into sixbit characters, 5
-     * to a 32-bit word.  This is something the FORTRAN version did
-     * becuse archaic FORTRAN had no string types.  Don Wood's
-     * mechanical translation of 2.5 to C retained the packing and
-     * thus this misfeature.
-     *
-     * It's philosophically questionable whether this is the right
-     * thing to do even in oldstyle mode.  On one hand, the text
-     * mangling was not authorial intent, but a result of limitations
-     * in their tools. On the other, not simulating this misbehavior
-     * goes against the goal of making oldstyle as accurate as
-     * possible an emulation of the original UI.
-     */
-    if (settings.oldstyle) {
-        cmd->word[0].raw[TOKLEN + TOKLEN] = cmd->word[1].raw[TOKLEN + TOKLEN] = '\0';
-        for (size_t i = 0; i < strlen(cmd->word[0].raw); i++)
-            cmd->word[0].raw[i] = toupper(cmd->word[0].raw[i]);
-        for (size_t i = 0; i < strlen(cmd->word[1].raw); i++)
-            cmd->word[1].raw[i] = toupper(cmd->word[1].raw[i]);
+static int scan_words(struct session_t* session, char* line, char* words[2], uint64_t keys[2])
+/* Split an input line in a single pass.  The first two words are
+ * NUL-terminated in place and pointed to by words[], keys[] gets their
+ * vocabulary keys (the case-folded first TOKLEN characters, packed as
+ * make_dungeon.py packs them), and the return value is the number of
+ * words on the line.  Missing words come back empty with key 0.
+ *
+ * (ESR) In oldstyle mode, simulate the uppercasing and truncating
+ * effect on raw tokens of packing them into sixbit characters, 5
+ * to a 32-bit word.  This is something the FORTRAN version did
+ * becuse archaic FORTRAN had no string types.  Don Wood's
+ * mechanical translation of 2.5 to C retained the packing and
+ * thus this misfeature.
+ *
+ * It's philosophically questionable whether this is the right
+ * thing to do even in oldstyle mode.  On one hand, the text
+ * mangling was not authorial intent, but a result of limitations
+ * in their tools. On the other, not simulating this misbehavior
+ * goes against the goal of making oldstyle as accurate as
+ * possible an emulation of the original UI.
+ */
+{
+    int count = 0;
+    char* s = line;
+
+    for (;;) {
+        while (isspace((unsigned char)*s))
+            ++s;
+        if (*s == '\0')
+            break;
+        if (count >= 2) {
+            while (*s != '\0' && !isspace((unsigned char)*s))
+                ++s;
+            ++count;
+            continue;
+        }
+        char* word = s;
+        uint64_t key = 0;
+        for (size_t i = 0; *s != '\0' && !isspace((unsigned char)*s); ++s, ++i) {
+            if (i < TOKLEN)
+                key |= (uint64_t)(unsigned char)tolower((unsigned char)*s) << (8 * i);
+            if (session->settings.oldstyle)
+                *s = toupper((unsigned char)*s);
+        }
+        if (session->settings.oldstyle && s - word > TOKLEN + TOKLEN)
+            word[TOKLEN + TOKLEN] = '\0';
+        if (*s != '\0')
+            *s++ = '\0';
+        words[count] = word;
+        keys[count] = key;
+        ++count;
+    }
+    for (int i = count; i < 2; i++) {
+        words[i] = s;
+        keys[i] = 0;
     }
 
-    /* populate command with parsed vocabulary metadata */
-    get_vocab_metadata(&(cmd->word[0]));
-    get_vocab_metadata(&(cmd->word[1]));
+    return count;
 }
 
-bool get_command_input(command_t *command)
+/* The most recent command line; command words point into it. */
+bool get_command_input(struct session_t* session, command_t *command)
 /* Get user input on stdin, parse and map to command */
 {
-    char inputbuf[LINESIZE];
     char* input;
+    char* words[2];
+    uint64_t keys[2];
 
+    free(session->command_line);
+    session->command_line = NULL;
     for (;;) {
-        input = get_input();
+        input = get_input(session);
         if (input == NULL)
             return false;
-        if (word_count(input) > 2) {
-            rspeak(TWO_WORDS);
+        if (scan_words(session, input, words, keys) > 2) {
+            rspeak(session, TWO_WORDS);
             free(input);
             continue;
         }
-        if (strcmp(input, "") != 0)
+        if (input[0] != '\0')
             break;
         free(input);
     }
 
-    strncpy(inputbuf, input, LINESIZE - 1);
-    free(input);
-
-    tokenize(inputbuf, command);
+    command->part = unknown;
+    command->verb = 0;
+    command->obj = NO_OBJECT;
+    for (int i = 0; i < 2; i++) {
+        command->word[i].raw = words[i];
+        get_vocab_metadata(session, &command->word[i], keys[i]);
+    }
+    session->command_line = input;
 
     return true;
 }
 
-void juggle(obj_t object)
+void juggle(struct session_t* session, obj_t object)
 /*  Juggle an object by picking it up and putting it down again, the purpose
  *  being to get the object to the front of the chain of things at its loc. */
 {
     loc_t i, j;
 
-    i = game.place[object];
-    j = game.fixed[object];
-    move(object, i);
-    move(object + NOBJECTS, j);
+    i = session->game.place[object];
+    j = session->game.fixed[object];
+    move(session, object, i);
+    move(session, object + NOBJECTS, j);
 }
 
-void move(obj_t object, loc_t where)
+void move(struct session_t* session, obj_t object, loc_t where)
 /*  Place any object anywhere by picking it up and dropping it.  May
  *  already be toting, in which case the carry is a no-op.  Mustn't
  *  pick up objects which are not at any loc, since carry wants to
@@ -557,57 +680,57 @@ void move(obj_t object, loc_t where)
     loc_t from;
 
     if (object > NOBJECTS)
-        from = game.fixed[object - NOBJECTS];
+        from = session->game.fixed[object - NOBJECTS];
     else
-        from = game.place[object];
+        from = session->game.place[object];
     /* (ESR) Used to check for !SPECIAL(from). I *think* that was wrong... */
     if (from != LOC_NOWHERE && from != CARRIED)
-        carry(object, from);
-    drop(object, where);
+        carry(session, object, from);
+    drop(session, object, where);
 }
 
-loc_t put(obj_t object, loc_t where, long pval)
+loc_t put(struct session_t* session, obj_t object, loc_t where, long pval)
 /*  put() is the same as move(), except it returns a value used to set up the
  *  negated game.prop values for the repository objects. */
 {
-    move(object, where);
+    move(session, object, where);
     return STASHED(pval);
 }
 
-void carry(obj_t object, loc_t where)
+void carry(struct session_t* session, obj_t object, loc_t where)
 /*  Start toting an object, removing it from the list of things at its former
  *  location.  Incr holdng unless it was already being toted.  If object>NOBJECTS
- *  (moving "fixed" second loc), don't change game.place or game.holdng. */
+ *  (moving "fixed" second loc), don't change game.place or game.holdng.
+ *  session->derived.prev[] says what links to the object, so it comes
+ *  off the list without a walk along it. */
 {
-    long temp;
+    obj_t *prev = session->derived.prev;
+    obj_t next = session->game.link[object];
 
     if (object <= NOBJECTS) {
-        if (game.place[object] == CARRIED)
+        if (session->game.place[object] == CARRIED)
             return;
-        game.place[object] = CARRIED;
+        SETPLACE(object, CARRIED);
 	
 	if (object!= BIRD)
-	    ++game.holdng;
-    }
-    if (game.atloc[where] == object) {
-        game.atloc[where] = game.link[object];
-        return;
-    }
-    temp = game.atloc[where];
-    while (game.link[temp] != object) {
-        temp = game.link[temp];
+	    ++session->game.holdng;
     }
-    game.link[temp] = game.link[object];
+    if (session->game.atloc[where] == object)
+        SETATLOC(where, next);
+    else
+        SETLINK(prev[object], next);
+    if (next != NO_OBJECT)
+        prev[next] = prev[object];
 }
 
-void drop(obj_t object, loc_t where)
+void drop(struct session_t* session, obj_t object, loc_t where)
 /*  Place an object at a given loc, prefixing it onto the game.atloc list.  Decr
  *  game.holdng if the object was being toted. */
 {
     if (object > NOBJECTS)
-        game.fixed[object - NOBJECTS] = where;
+        SETFIXED(object - NOBJECTS, where);
     else {
-        if (game.place[object] == CARRIED)
+        if (session->game.place[object] == CARRIED)
 	    if (object != BIRD)
 		/* The bird has to be weightless.  This ugly hack (and the
 		 * corresponding code in the drop function) brought to you
@@ -615,17 +738,43 @@ void drop(obj_t object, loc_t where)
 		 * to either 'take bird' or 'take cage' and have the right thing
 		 * happen.
 		 */
-		--game.holdng;
-        game.place[object] = where;
+		--session->game.holdng;
+        SETPLACE(object, where);
     }
     if (where == LOC_NOWHERE ||
         where == CARRIED)
         return;
-    game.link[object] = game.atloc[where];
-    game.atloc[where] = object;
+    obj_t next = session->game.atloc[where];
+    SETLINK(object, next);
+    SETATLOC(where, object);
+    session->derived.prev[object] = NO_OBJECT;
+    if (next != NO_OBJECT)
+        session->derived.prev[next] = object;
 }
 
-int atdwrf(loc_t where)
+void links_at(struct session_t* session, loc_t where)
+/*  Work out session->derived.prev[] for the objects at one location
+ *  from its game.atloc and game.link list. */
+{
+    if (where < 1 || where > NLOCATIONS)
+        return;
+    obj_t before = NO_OBJECT;
+    for (obj_t obj = session->game.atloc[where]; obj != NO_OBJECT; obj = session->game.link[obj]) {
+        session->derived.prev[obj] = before;
+        before = obj;
+    }
+}
+
+void links_init(struct session_t* session)
+/*  Work out session->derived.prev[] everywhere, as after initialization
+ *  or a restore.  Going the other way needs nothing: game.atloc and
+ *  game.link are always kept current. */
+{
+    for (loc_t loc = 1; loc <= NLOCATIONS; loc++)
+        links_at(session, loc);
+}
+
+int atdwrf(struct session_t* session, loc_t where)
 /*  Return the index of first dwarf at the given location, zero if no dwarf is
  *  there (or if dwarves not active yet), -1 if all dwarves are dead.  Ignore
  *  the pirate (6th dwarf). */
@@ -633,18 +782,186 @@ int atdwrf(loc_t where)
     int at;
 
     at = 0;
-    if (game.dflag < 2)
+    if (session->game.dflag < 2)
         return at;
     at = -1;
     for (long i = 1; i <= NDWARVES - 1; i++) {
-        if (game.dloc[i] == where)
+        if (session->game.dloc[i] == where)
             return i;
-        if (game.dloc[i] != 0)
+        if (session->game.dloc[i] != 0)
             at = 0;
     }
     return at;
 }
 
+/*  Game-state hashing.  The large arrays of game_t (abbrev, atloc,
+ *  fixed, link, place, prop) are hashed Zobrist-style: every cell
+ *  contributes a key derived from its array, index and value, and the
+ *  keys are XORed together into session->derived.hash.  Writing a cell through
+ *  the SET*() macros swaps its old key for its new one, so the hash is
+ *  never more than one call out of date.  The scalars and the small
+ *  per-dwarf and per-hint arrays are cheap enough to fold in when the
+ *  hash is asked for. */
+
+static uint64_t hash_mix(uint64_t z)
+/* The splitmix64 finalizer; any good 64-bit mixer would do. */
+{
+    z += UINT64_C(0x9e3779b97f4a7c15);
+    z = (z ^ (z >> 30)) * UINT64_C(0xbf58476d1ce4e5b9);
+    z = (z ^ (z >> 27)) * UINT64_C(0x94d049bb133111eb);
+    return z ^ (z >> 31);
+}
+
+static uint64_t hash_key(int field, long index, long value)
+/* The key for one cell of one array. */
+{
+    return hash_mix(((uint64_t)field << 56) ^ ((uint64_t)index << 32) ^ (uint32_t)value);
+}
+
+static void reindex(struct session_t* session, enum hashfield field, obj_t obj, loc_t old)
+/* Bring the carried and present sets up to date after obj's place or
+ * fixed location has changed from old. */
+{
+    loc_t place = session->game.place[obj], fixed = session->game.fixed[obj];
+    if (field == HASH_PLACE) {
+        if (old == CARRIED)
+            BIT_CLEAR(CARRIED_SET, obj);
+        if (place == CARRIED)
+            BIT_SET(CARRIED_SET, obj);
+    }
+    if (old > 0 && old != place && old != fixed)
+        BIT_CLEAR(PRESENT_SET(old), obj);
+    if (place > 0)
+        BIT_SET(PRESENT_SET(place), obj);
+    if (fixed > 0)
+        BIT_SET(PRESENT_SET(fixed), obj);
+}
+
+void hashed_set(struct session_t* session, enum hashfield field, long* array, long index, long value)
+/* Set array[index] to value, keeping session->derived.hash, the
+ * object sets and the running score current. */
+{
+    long old = array[index];
+    session->derived.hash ^= hash_key(field, index, old) ^ hash_key(field, index, value);
+    if (session->journal.enabled && !session->journal.replaying)
+        journal_record(session, &array[index], old, value);
+    array[index] = value;
+    if (field == HASH_PLACE || field == HASH_FIXED)
+        reindex(session, field, index, old);
+    if (field == HASH_PLACE || field == HASH_PROP)
+        rescore(session, index);
+    if (index == LAMP && (field == HASH_PLACE || field == HASH_FIXED || field == HASH_PROP))
+        session->derived.locale.valid = false;
+}
+
+void index_init(struct session_t* session)
+/* Build the carried and present sets from scratch. */
+{
+    memset(session->derived.carried, '\0', sizeof(session->derived.carried));
+    memset(session->derived.present, '\0', sizeof(session->derived.present));
+    for (obj_t obj = 1; obj <= NOBJECTS; obj++)
+        reindex(session, HASH_PLACE, obj, LOC_NOWHERE);
+}
+
+void locale_refill(struct session_t* session)
+/* Work out the facts about the player's location afresh; locale()'s
+ * slow path. */
+{
+    struct locale_t* here = &session->derived.locale;
+    here->valid = true;
+    here->loc = session->game.loc;
+    here->dark = !CNDBIT(session->game.loc, COND_LIT) && (session->game.prop[LAMP] == LAMP_DARK || !HERE(LAMP));
+    here->outside = OUTSID(session->game.loc);
+    here->inside = INSIDE(session->game.loc);
+    here->deep = INDEEP(session->game.loc);
+    here->forced = FORCED(session->game.loc);
+    here->liquid = LIQLOC(session->game.loc);
+}
+
+void hints_init(struct session_t* session)
+/* Find the hints whose counters checkhints() has to keep ticking. */
+{
+    session->derived.hints_counting = 0;
+    for (int hint = 0; hint < NHINTS; hint++)
+        if (session->game.hintlc[hint] != 0)
+            session->derived.hints_counting |= 1u << hint;
+}
+
+obj_t next_object(const uint64_t* set, obj_t after)
+/* The lowest-numbered object in set after the given one, or NO_OBJECT.
+ * Start from NO_OBJECT to get the first. */
+{
+    obj_t obj = after + 1;
+    for (long w = obj / 64; w < OBJWORDS; w++) {
+        uint64_t bits = set[w];
+        if (w == obj / 64)
+            bits &= ~UINT64_C(0) << (obj % 64);
+        if (bits != 0)
+            return w * 64 + __builtin_ctzll(bits);
+    }
+    return NO_OBJECT;
+}
+
+static uint64_t hash_array(enum hashfield field, const long* array, long n)
+{
+    uint64_t hash = 0;
+    for (long i = 0; i < n; i++)
+        hash ^= hash_key(field, i, array[i]);
+    return hash;
+}
+
+static uint64_t hash_arrays(struct session_t* session)
+/* The hash of the large arrays, computed from scratch. */
+{
+    return hash_array(HASH_ABBREV, session->game.abbrev, NLOCATIONS + 1)
+           ^ hash_array(HASH_ATLOC, session->game.atloc, NLOCATIONS + 1)
+           ^ hash_array(HASH_FIXED, session->game.fixed, NOBJECTS + 1)
+           ^ hash_array(HASH_LINK, session->game.link, NOBJECTS * 2 + 1)
+           ^ hash_array(HASH_PLACE, session->game.place, NOBJECTS + 1)
+           ^ hash_array(HASH_PROP, session->game.prop, NOBJECTS + 1);
+}
+
+void hash_init(struct session_t* session)
+/* Start the hash over from the whole game state, as after
+ * initialization or a restore. */
+{
+    session->derived.hash = hash_arrays(session);
+}
+
+uint64_t game_hash(struct session_t* session, bool stable)
+/* Hash the whole game state.  If stable is set, leave out the turn
+ * counter and the random-number state, so that two games that reach
+ * the same position by different routes hash alike. */
+{
+    const long scalars[] = {
+        session->game.abbnum, session->game.bonus, session->game.chloc, session->game.chloc2,
+        session->game.clock1, session->game.clock2, session->game.clshnt, session->game.closed,
+        session->game.closng, session->game.lmwarn, session->game.novice, session->game.panic,
+        session->game.wzdark, session->game.blooded, session->game.conds, session->game.detail,
+        session->game.dflag, session->game.dkill, session->game.dtotal, session->game.foobar,
+        session->game.holdng, session->game.igo, session->game.iwest, session->game.knfloc,
+        session->game.limit, session->game.loc, session->game.newloc, session->game.numdie,
+        session->game.oldloc, session->game.oldlc2, session->game.oldobj, session->game.saved,
+        session->game.tally, session->game.thresh, session->game.trndex, session->game.trnluz,
+        stable ? 0 : session->game.turns,
+        stable ? 0 : session->game.lcg_x,
+    };
+    uint64_t hash = session->derived.hash;
+#ifdef HASH_CHECK
+    if (hash != hash_arrays(session))
+        BUG(RUNNING_HASH_DIVERGED_FROM_RESCAN); // LCOV_EXCL_LINE
+#endif
+    hash ^= hash_array(HASH_SCALARS, scalars, sizeof(scalars) / sizeof(scalars[0]));
+    hash ^= hash_array(HASH_DSEEN, session->game.dseen, NDWARVES + 1);
+    hash ^= hash_array(HASH_DLOC, session->game.dloc, NDWARVES + 1);
+    hash ^= hash_array(HASH_ODLOC, session->game.odloc, NDWARVES + 1);
+    hash ^= hash_array(HASH_HINTED, session->game.hinted, NHINTS);
+    hash ^= hash_array(HASH_HINTLC, session->game.hintlc, NHINTS);
+    for (int i = 0; i < TOKLEN; i++)
+        hash ^= hash_key(HASH_ZZWORD, i, session->game.zzword[i]);
+    return hash;
+}
+
 /*  Utility routines (setbit, tstbit, set_seed, get_next_lcg_value,
  *  randrange) */
 
@@ -660,50 +977,51 @@ bool tstbit(long mask, int bit)
     return (mask & (1 << bit)) != 0;
 }
 
-void set_seed(int32_t seedval)
+void set_seed(struct session_t* session, int32_t seedval)
 /* Set the LCG seed */
 {
-    game.lcg_x = seedval % LCG_M;
-    if (game.lcg_x < 0) {
-        game.lcg_x = LCG_M + game.lcg_x;
+    session->game.lcg_x = seedval % LCG_M;
+    if (session->game.lcg_x < 0) {
+        session->game.lcg_x = LCG_M + session->game.lcg_x;
     }
     // once seed is set, we need to generate the Z`ZZZ word
     for (int i = 0; i < 5; ++i) {
-        game.zzword[i] = 'A' + randrange(26);
+        session->game.zzword[i] = 'A' + randrange(session, 26);
     }
-    game.zzword[1] = '\''; // force second char to apostrophe
-    game.zzword[5] = '\0';
+    session->game.zzword[1] = '\''; // force second char to apostrophe
+    session->game.zzword[5] = '\0';
 }
 
-static int32_t get_next_lcg_value(void)
+static int32_t get_next_lcg_value(struct session_t* session)
 /* Return the LCG's current value, and then iterate it. */
 {
-    int32_t old_x = game.lcg_x;
-    game.lcg_x = (LCG_A * game.lcg_x + LCG_C) % LCG_M;
+    int32_t old_x = session->game.lcg_x;
+    session->game.lcg_x = (LCG_A * session->game.lcg_x + LCG_C) % LCG_M;
     return old_x;
 }
 
-int32_t randrange(int32_t range)
+int32_t randrange(struct session_t* session, int32_t range)
 /* Return a random integer from [0, range). */
 {
-    return range * get_next_lcg_value() / LCG_M;
+    return range * get_next_lcg_value(session) / LCG_M;
 }
 
 // LCOV_EXCL_START
-void bug(enum bugtype num, const char *error_string)
+void bug(struct session_t* session, enum bugtype num, const char *error_string)
 {
+    output_flush(session);
     fprintf(stderr, "Fatal error %d, %s.\n", num, error_string);
-    exit(EXIT_FAILURE);
+    session_end(session, EXIT_FAILURE);
 }
 // LCOV_EXCL_STOP
 
 /* end */
 
-void state_change(obj_t obj, int state)
+void state_change(struct session_t* session, obj_t obj, int state)
 /* Object must have a change-message list for this to be useful; only some do */
 {
-    game.prop[obj] = state;
-    pspeak(obj, change, state, true);
+    SETPROP(obj, state);
+    pspeak(session, obj, change, state, true);
 }
 
 /* end */
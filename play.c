@@ -0,0 +1,1255 @@
+/*
+ * There used to be a note that said this:
+ *
+ * The author - Don Woods - apologises for the style of the code; it
+ * is a result of running the original Fortran IV source through a
+ * home-brew Fortran-to-C converter.
+ *
+ * Now that the code has been restructured into something much closer
+ * to idiomatic C, the following is more appropriate:
+ *
+ * ESR apologizes for the remaing gotos (now confined to one function
+ * in this file - there used to be over 350 of them, *everywhere*).
+ * Applying the Structured Program Theorem can be hard.
+ *
+ * This file holds the game loop and the entry points a host drives it
+ * through; main.c is only the command-line front end.
+ *
+ * Copyright (c) 1977, 2005 by Will Crowther and Don Woods
+ * Copyright (c) 2017 by Eric S. Raymond
+ * SPDX-License-Identifier: BSD-2-clause
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <ctype.h>
+#include "advent.h"
+#include "dungeon.h"
+
+static bool do_command(struct session_t*);
+
+/* What setjmp() returns when play_step() stops at a prompt; session_end()
+ * makes it 1. */
+#define PAUSED	2
+
+static bool run(struct session_t* session, int commands)
+/* Obey commands in session until the game ends, or until the given
+ * number have been obeyed and another is wanted if that isn't
+ * negative.  True unless the game ended. */
+{
+    if (session->over)
+        return false;
+    int how = setjmp(session->unwind);
+    if (how != 0) {
+        session->playing = false;
+        if (how != PAUSED) {
+            session->over = true;
+            session->waiting = false;
+        }
+        output_flush(session);
+        return !session->over;
+    }
+    session->playing = true;
+    session->budget = commands;
+
+    /* interpret commands until EOF or interrupt */
+    for (;;) {
+#ifdef SCORE_CHECK
+        (void)score(session, quitgame);
+#endif
+#ifdef HASH_CHECK
+        (void)game_hash(session, false);
+#endif
+        if (!do_command(session))
+            break;
+    }
+    /* show score and exit */
+    terminate(session, quitgame);
+}
+
+bool play_begin(struct session_t* session, FILE* rfp)
+/* Set up a new game in session, resuming from rfp if that isn't NULL,
+ * and stop when the first command is wanted.  Whatever it played before
+ * is thrown away, settings apart.  False if the game ended first. */
+{
+    if (setjmp(session->unwind) != 0) {
+        session->playing = false;
+        session->over = true;
+        output_flush(session);
+        return false;
+    }
+    session->playing = true;
+    session->over = false;
+    session->waiting = false;
+
+    /*  Initialize game variables, forgetting any earlier game */
+    journal_stop(session);
+    memset(&session->derived, '\0', sizeof(session->derived));
+    memset(&session->command, '\0', sizeof(session->command));
+    long seedval = initialise(session);
+    derived_init(session);
+
+    if (!rfp) {
+        session->game.novice = yes(session, arbitrary_messages[WELCOME_YOU], arbitrary_messages[CAVE_NEARBY], arbitrary_messages[NO_MESSAGE]);
+        if (session->game.novice)
+            session->game.limit = NOVICELIMIT;
+        rescore_flags(session);
+    } else {
+        restore(session, rfp);
+    }
+
+    if (session->settings.logfp)
+        fprintf(session->settings.logfp, "seed %ld\n", seedval);
+
+    session->playing = false;
+    return run(session, 0);
+}
+
+bool play_step(struct session_t* s)
+/* Obey one command in s and stop when the next is wanted.  True while
+ * the game goes on; once it has ended, s->status holds the exit status
+ * and only play_begin() can start another. */
+{
+    return run(s, 1);
+}
+
+int play_on(struct session_t* s)
+/* Carry on with the game in s from wherever it stands, be that just
+ * begun, stopped by play_step(), cloned or put back from a snapshot,
+ * through to its end, and return the exit status. */
+{
+    run(s, -1);
+    return s->status;
+}
+
+int play(struct session_t* s, FILE* rfp)
+/* Play a new game in s through to its end, resuming from rfp if that
+ * isn't NULL, and return the exit status.  Winning, dying, quitting,
+ * suspending and internal errors all come back here rather than ending
+ * the process, so a host can go straight on to the next game. */
+{
+    if (play_begin(s, rfp))
+        play_on(s);
+    return s->status;
+}
+
+/*  Check if this loc is eligible for any hints.  If been here long
+ *  enough, display.  Ignore "HINTS" < 4 (special stuff, see database
+ *  notes).
+ *  Only hints that apply here, or whose counters are still running
+ *  from an earlier visit, need looking at: every other hint would just
+ *  have its idle counter zeroed again.  A hint's predicate is only
+ *  tried once its counter has run out. */
+static void checkhints(struct session_t* session)
+{
+    if (conditions[session->game.loc] >= session->game.conds) {
+        uint32_t here = location_hints[session->game.loc];
+        uint32_t live = here | session->derived.hints_counting;
+        for (; live != 0; live &= live - 1) {
+            int hint = __builtin_ctz(live);
+            if (session->game.hinted[hint])
+                continue;
+            if (!(here & (1u << hint))) {
+                /* Left the region; hints[].turns > 0, so it can't fire */
+                session->game.hintlc[hint] = 0;
+                session->derived.hints_counting &= ~(1u << hint);
+                continue;
+            }
+            ++session->game.hintlc[hint];
+            session->derived.hints_counting |= 1u << hint;
+            /*  Come here if he's been long enough at required loc(s) for some
+             *  unused hint. */
+            if (session->game.hintlc[hint] >= hints[hint].turns) {
+                int i;
+
+                switch (hint) {
+                case 0:
+                    /* cave */
+                    if (session->game.prop[GRATE] == GRATE_CLOSED && !HERE(KEYS))
+                        break;
+                    session->game.hintlc[hint] = 0;
+                    return;
+                case 1:	/* bird */
+                    if (session->game.place[BIRD] == session->game.loc && TOTING(ROD) && session->game.oldobj == BIRD)
+                        break;
+                    return;
+                case 2:	/* snake */
+                    if (HERE(SNAKE) && !HERE(BIRD))
+                        break;
+                    session->game.hintlc[hint] = 0;
+                    return;
+                case 3:	/* maze */
+                    if (session->game.atloc[session->game.loc] == NO_OBJECT &&
+                        session->game.atloc[session->game.oldloc] == NO_OBJECT &&
+                        session->game.atloc[session->game.oldlc2] == NO_OBJECT &&
+                        session->game.holdng > 1)
+                        break;
+                    session->game.hintlc[hint] = 0;
+                    return;
+                case 4:	/* dark */
+                    if (session->game.prop[EMERALD] != STATE_NOTFOUND && session->game.prop[PYRAMID] == STATE_NOTFOUND)
+                        break;
+                    session->game.hintlc[hint] = 0;
+                    return;
+                case 5:	/* witt */
+                    break;
+                case 6:	/* urn */
+                    if (session->game.dflag == 0)
+                        break;
+                    session->game.hintlc[hint] = 0;
+                    return;
+                case 7:	/* woods */
+                    if (session->game.atloc[session->game.loc] == NO_OBJECT &&
+                        session->game.atloc[session->game.oldloc] == NO_OBJECT &&
+                        session->game.atloc[session->game.oldlc2] == NO_OBJECT)
+                        break;
+                    return;
+                case 8:	/* ogre */
+                    i = atdwrf(session, session->game.loc);
+                    if (i < 0) {
+                        session->game.hintlc[hint] = 0;
+                        return;
+                    }
+                    if (HERE(OGRE) && i == 0)
+                        break;
+                    return;
+                case 9:	/* jade */
+                    if (session->game.tally == 1 && session->game.prop[JADE] < 0)
+                        break;
+                    session->game.hintlc[hint] = 0;
+                    return;
+                default: // LCOV_EXCL_LINE
+                    BUG(HINT_NUMBER_EXCEEDS_GOTO_LIST); // LCOV_EXCL_LINE
+                }
+
+                /* Fall through to hint display */
+                session->game.hintlc[hint] = 0;
+                if (!yes(session, hints[hint].question, arbitrary_messages[NO_MESSAGE], arbitrary_messages[OK_MAN]))
+                    return;
+                rspeak(session, HINT_COST, hints[hint].penalty, hints[hint].penalty);
+                session->game.hinted[hint] = yes(session, arbitrary_messages[WANT_HINT], hints[hint].hint, arbitrary_messages[OK_MAN]);
+                rescore_flags(session);
+                if (session->game.hinted[hint] && session->game.limit > WARNTIME)
+                    session->game.limit += WARNTIME * hints[hint].penalty;
+            }
+        }
+    }
+}
+
+static bool spotted_by_pirate(struct session_t* session, int i)
+{
+    if (i != PIRATE)
+        return false;
+
+    /*  The pirate's spotted him.  Pirate leaves him alone once we've
+     *  found chest.  K counts if a treasure is here.  If not, and
+     *  tally=1 for an unseen chest, let the pirate be spotted.  Note
+     *  that game.place[CHEST] = LOC_NOWHERE might mean that he's thrown
+     *  it to the troll, but in that case he's seen the chest
+     *  (game.prop[CHEST] == STATE_FOUND). */
+    if (session->game.loc == session->game.chloc ||
+        session->game.prop[CHEST] != STATE_NOTFOUND)
+        return true;
+    int snarfed = 0;
+    bool movechest = false, robplayer = false;
+    /* The treasures HERE() */
+    uint64_t here[OBJWORDS];
+    for (int w = 0; w < OBJWORDS; w++)
+        here[w] = treasure_set[w] & (CARRIED_SET[w] | PRESENT_SET(session->game.loc)[w]);
+    for (obj_t treasure = next_object(here, NO_OBJECT); treasure != NO_OBJECT; treasure = next_object(here, treasure)) {
+        /*  Pirate won't take pyramid from plover room or dark
+         *  room (too easy!). */
+        if (treasure == PYRAMID && (session->game.loc == object_plac[PYRAMID] ||
+                                    session->game.loc == object_plac[EMERALD])) {
+            continue;
+        }
+        ++snarfed;
+        if (TOTING(treasure)) {
+            movechest = true;
+            robplayer = true;
+        }
+    }
+    /* Force chest placement before player finds last treasure */
+    if (session->game.tally == 1 && snarfed == 0 && session->game.place[CHEST] == LOC_NOWHERE && HERE(LAMP) && session->game.prop[LAMP] == LAMP_BRIGHT) {
+        rspeak(session, PIRATE_SPOTTED);
+        movechest = true;
+    }
+    /* Do things in this order (chest move before robbery) so chest is listed
+     * last at the maze location. */
+    if (movechest) {
+        move(session, CHEST, session->game.chloc);
+        move(session, MESSAG, session->game.chloc2);
+        session->game.dloc[PIRATE] = session->game.chloc;
+        session->game.odloc[PIRATE] = session->game.chloc;
+        session->game.dseen[PIRATE] = false;
+    } else {
+        /* You might get a hint of the pirate's presence even if the
+         * chest doesn't move... */
+        if (session->game.odloc[PIRATE] != session->game.dloc[PIRATE] && PCT(20))
+            rspeak(session, PIRATE_RUSTLES);
+    }
+    if (robplayer) {
+        rspeak(session, PIRATE_POUNCES);
+        for (obj_t treasure = next_object(here, NO_OBJECT); treasure != NO_OBJECT; treasure = next_object(here, treasure)) {
+            if (!(treasure == PYRAMID && (session->game.loc == object_plac[PYRAMID] ||
+                                          session->game.loc == object_plac[EMERALD]))) {
+                if (AT(treasure) && session->game.fixed[treasure] == IS_FREE)
+                    carry(session, treasure, session->game.loc);
+                if (TOTING(treasure))
+                    drop(session, treasure, session->game.chloc);
+            }
+        }
+    }
+
+    return true;
+}
+
+static bool dwarfmove(struct session_t* session)
+/* Dwarves move.  Return true if player survives, false if he dies. */
+{
+    int stick, attack;
+    loc_t tk[21];
+
+    /*  Dwarf stuff.  See earlier comments for description of
+     *  variables.  Remember sixth dwarf is pirate and is thus
+     *  very different except for motion rules. */
+
+    /*  First off, don't let the dwarves follow him into a pit or a
+     *  wall.  Activate the whole mess the first time he gets as far
+     *  as the Hall of Mists (what INDEEP() tests).  If game.newloc
+     *  is forbidden to pirate (in particular, if it's beyond the
+     *  troll bridge), bypass dwarf stuff.  That way pirate can't
+     *  steal return toll, and dwarves can't meet the bear.  Also
+     *  means dwarves won't follow him into dead end in maze, but
+     *  c'est la vie.  They'll wait for him outside the dead end. */
+    if (session->game.loc == LOC_NOWHERE ||
+        LOCALE(forced) ||
+        CNDBIT(session->game.newloc, COND_NOARRR))
+        return true;
+
+    /* Dwarf activity level ratchets up */
+    if (session->game.dflag == 0) {
+        if (LOCALE(deep)) {
+            session->game.dflag = 1;
+            rescore_flags(session);
+        }
+        return true;
+    }
+
+    /*  When we encounter the first dwarf, we kill 0, 1, or 2 of
+     *  the 5 dwarves.  If any of the survivors is at game.loc,
+     *  replace him with the alternate. */
+    if (session->game.dflag == 1) {
+        if (!LOCALE(deep) ||
+            (PCT(95) && (!CNDBIT(session->game.loc, COND_NOBACK) ||
+                         PCT(85))))
+            return true;
+        session->game.dflag = 2;
+        for (int i = 1; i <= 2; i++) {
+            int j = 1 + randrange(session, NDWARVES - 1);
+            if (PCT(50))
+                session->game.dloc[j] = 0;
+        }
+
+        /* Alternate initial loc for dwarf, in case one of them
+        *  starts out on top of the adventurer. */
+        for (int i = 1; i <= NDWARVES - 1; i++) {
+            if (session->game.dloc[i] == session->game.loc)
+                session->game.dloc[i] = DALTLC; //
+            session->game.odloc[i] = session->game.dloc[i];
+        }
+        rspeak(session, DWARF_RAN);
+        drop(session, AXE, session->game.loc);
+        return true;
+    }
+
+    /*  Things are in full swing.  Move each dwarf at random,
+     *  except if he's seen us he sticks with us.  Dwarves stay
+     *  deep inside.  If wandering at random, they don't back up
+     *  unless there's no alternative.  If they don't have to
+     *  move, they attack.  And, of course, dead dwarves don't do
+     *  much of anything. */
+    session->game.dtotal = 0;
+    attack = 0;
+    stick = 0;
+    for (int i = 1; i <= NDWARVES; i++) {
+        if (session->game.dloc[i] == 0)
+            continue;
+        /*  Fill tk array with all the places this dwarf might go.
+         *  The dungeon compiler has already weeded out everywhere
+         *  he can't; all that's left is not backing up. */
+        unsigned int j = 1;
+        const dwarfmoves_t* moves = &dwarf_moves[session->game.dloc[i]];
+        const uint32_t* dest = &LIST((i == PIRATE) ? moves->pirate : moves->dwarves, 0);
+        for (; *dest != LOC_NOWHERE; dest++) {
+            if (*dest == session->game.odloc[i])
+                continue;
+            else if (j > 1 && *dest == tk[j - 1])
+                continue;
+            tk[j++] = *dest;
+        }
+        if (tkey[session->game.dloc[i]] != 0)
+            session->game.newloc = moves->newloc;
+        tk[j] = session->game.odloc[i];
+        if (j >= 2)
+            --j;
+        j = 1 + randrange(session, j);
+        session->game.odloc[i] = session->game.dloc[i];
+        session->game.dloc[i] = tk[j];
+        session->game.dseen[i] = (session->game.dseen[i] && LOCALE(deep)) ||
+                        (session->game.dloc[i] == session->game.loc ||
+                         session->game.odloc[i] == session->game.loc);
+        if (!session->game.dseen[i])
+            continue;
+        session->game.dloc[i] = session->game.loc;
+        if (spotted_by_pirate(session, i))
+            continue;
+        /* This threatening little dwarf is in the room with him! */
+        ++session->game.dtotal;
+        if (session->game.odloc[i] == session->game.dloc[i]) {
+            ++attack;
+            if (session->game.knfloc >= 0)
+                session->game.knfloc = session->game.loc;
+            if (randrange(session, 1000) < 95 * (session->game.dflag - 2))
+                ++stick;
+        }
+    }
+
+    /*  Now we know what's happening.  Let's tell the poor sucker about it. */
+    if (session->game.dtotal == 0)
+        return true;
+    rspeak(session, session->game.dtotal == 1 ? DWARF_SINGLE : DWARF_PACK, session->game.dtotal);
+    if (attack == 0)
+        return true;
+    if (session->game.dflag == 2)
+        session->game.dflag = 3;
+    if (attack > 1) {
+        rspeak(session, THROWN_KNIVES, attack);
+        rspeak(session, stick > 1 ? MULTIPLE_HITS : (stick == 1 ? ONE_HIT : NONE_HIT), stick);
+    } else {
+        rspeak(session, KNIFE_THROWN);
+        rspeak(session, stick ? GETS_YOU : MISSES_YOU);
+    }
+    if (stick == 0)
+        return true;
+    session->game.oldlc2 = session->game.loc;
+    return false;
+}
+
+/*  "You're dead, Jim."
+ *
+ *  If the current loc is zero, it means the clown got himself killed.
+ *  We'll allow this maxdie times.  NDEATHS is automatically set based
+ *  on the number of snide messages available.  Each death results in
+ *  a message (obituaries[n]) which offers reincarnation; if accepted,
+ *  this results in message obituaries[0], obituaries[2], etc.  The
+ *  last time, if he wants another chance, he gets a snide remark as
+ *  we exit.  When reincarnated, all objects being carried get dropped
+ *  at game.oldlc2 (presumably the last place prior to being killed)
+ *  without change of props.  The loop runs backwards to assure that
+ *  the bird is dropped before the cage.  (This kluge could be changed
+ *  once we're sure all references to bird and cage are done by
+ *  keywords.)  The lamp is a special case (it wouldn't do to leave it
+ *  in the cave). It is turned off and left outside the building (only
+ *  if he was carrying it, of course).  He himself is left inside the
+ *  building (and heaven help him if he tries to xyzzy back into the
+ *  cave without the lamp!).  game.oldloc is zapped so he can't just
+ *  "retreat". */
+
+static void croak(struct session_t* session)
+/*  Okay, he's dead.  Let's get on with it. */
+{
+    if (session->game.numdie < 0)
+        session->game.numdie = 0;
+    string_t query = obituaries[session->game.numdie].query;
+    string_t yes_response = obituaries[session->game.numdie].yes_response;
+    ++session->game.numdie;
+    rescore_flags(session);
+    if (session->game.closng) {
+        /*  He died during closing time.  No resurrection.  Tally up a
+         *  death and exit. */
+        rspeak(session, DEATH_CLOSING);
+        terminate(session, endgame);
+    } else if ( !yes(session, query, yes_response, arbitrary_messages[OK_MAN])
+                || session->game.numdie == NDEATHS)
+        terminate(session, endgame);
+    else {
+        SETPLACE(WATER, LOC_NOWHERE);
+        SETPLACE(OIL, LOC_NOWHERE);
+        if (TOTING(LAMP))
+            SETPROP(LAMP, LAMP_DARK);
+        for (int j = 1; j <= NOBJECTS; j++) {
+            int i = NOBJECTS + 1 - j;
+            if (TOTING(i)) {
+                /* Always leave lamp where it's accessible aboveground */
+                drop(session, i, (i == LAMP) ? LOC_START : session->game.oldlc2);
+            }
+        }
+        session->game.oldloc = session->game.loc = session->game.newloc = LOC_BUILDING;
+    }
+}
+
+static bool traveleq(int a, int b)
+/* Are two travel entries equal for purposes of skip after failed condition? */
+{
+    return (T_CONDTYPE(travel[a]) == T_CONDTYPE(travel[b]))
+           && (T_CONDARG1(travel[a]) == T_CONDARG1(travel[b]))
+           && (T_CONDARG2(travel[a]) == T_CONDARG2(travel[b]))
+           && (T_DESTTYPE(travel[a]) == T_DESTTYPE(travel[b]))
+           && (T_DESTVAL(travel[a]) == T_DESTVAL(travel[b]));
+}
+
+/*  Given the current location in "game.loc", and a motion verb number in
+ *  "motion", put the new location in "game.newloc".  The current loc is saved
+ *  in "game.oldloc" in case he wants to retreat.  The current
+ *  game.oldloc is saved in game.oldlc2, in case he dies.  (if he
+ *  does, game.newloc will be limbo, and game.oldloc will be what killed
+ *  him, so we need game.oldlc2, which is the last place he was
+ *  safe.) */
+
+static void playermove(struct session_t* session,  int motion)
+{
+    int scratchloc, travel_entry = tkey[session->game.loc];
+    session->game.newloc = session->game.loc;
+    if (travel_entry == 0)
+        BUG(LOCATION_HAS_NO_TRAVEL_ENTRIES); // LCOV_EXCL_LINE
+    if (motion == NUL)
+        return;
+    else if (motion == BACK) {
+        /*  Handle "go back".  Look for verb which goes from game.loc to
+         *  game.oldloc, or to game.oldlc2 If game.oldloc has forced-motion.
+         *  te_tmp saves entry -> forced loc -> previous loc. */
+        motion = session->game.oldloc;
+        if (FORCED(motion))
+            motion = session->game.oldlc2;
+        session->game.oldlc2 = session->game.oldloc;
+        session->game.oldloc = session->game.loc;
+        if (CNDBIT(session->game.loc, COND_NOBACK)) {
+            rspeak(session, TWIST_TURN);
+            return;
+        }
+        if (motion == session->game.loc) {
+            rspeak(session, FORGOT_PATH);
+            return;
+        }
+
+        int te_tmp = 0;
+        for (;;) {
+            enum desttype_t desttype = T_DESTTYPE(travel[travel_entry]);
+            scratchloc = T_DESTVAL(travel[travel_entry]);
+            if (desttype != dest_goto || scratchloc != motion) {
+                if (desttype == dest_goto) {
+                    if (FORCED(scratchloc) && T_DESTVAL(travel[tkey[scratchloc]]) == motion)
+                        te_tmp = travel_entry;
+                }
+                if (!T_STOP(travel[travel_entry])) {
+                    ++travel_entry;	/* go to next travel entry for this location */
+                    continue;
+                }
+                /* we've reached the end of travel entries for game.loc */
+                travel_entry = te_tmp;
+                if (travel_entry == 0) {
+                    rspeak(session, NOT_CONNECTED);
+                    return;
+                }
+            }
+
+            motion = T_MOTION(travel[travel_entry]);
+            travel_entry = tkey[session->game.loc];
+            break; /* fall through to ordinary travel */
+        }
+    } else if (motion == LOOK) {
+        /*  Look.  Can't give more detail.  Pretend it wasn't dark
+         *  (though it may now be dark) so he won't fall into a
+         *  pit while staring into the gloom. */
+        if (session->game.detail < 3)
+            rspeak(session, NO_MORE_DETAIL);
+        ++session->game.detail;
+        session->game.wzdark = false;
+        SETABBREV(session->game.loc, 0);
+        return;
+    } else if (motion == CAVE) {
+        /*  Cave.  Different messages depending on whether above ground. */
+        rspeak(session, (LOCALE(outside) && session->game.loc != LOC_GRATE) ? FOLLOW_STREAM : NEED_DETAIL);
+        return;
+    } else {
+        /* none of the specials */
+        session->game.oldlc2 = session->game.oldloc;
+        session->game.oldloc = session->game.loc;
+    }
+
+    /* Look for a way to fulfil the motion verb passed in - travel_entry indexes
+     * the beginning of the motion entries for here (game.loc), and
+     * travel_index says how far along them the motion starts. */
+    if (travel_index[session->game.loc][motion] == 0) {
+        /*  Couldn't find an entry matching the motion word passed
+         *  in.  Various messages depending on word given. */
+        switch (motion) {
+        case EAST:
+        case WEST:
+        case SOUTH:
+        case NORTH:
+        case NE:
+        case NW:
+        case SW:
+        case SE:
+        case UP:
+        case DOWN:
+            rspeak(session, BAD_DIRECTION);
+            break;
+        case FORWARD:
+        case LEFT:
+        case RIGHT:
+            rspeak(session, UNSURE_FACING);
+            break;
+        case OUTSIDE:
+        case INSIDE:
+            rspeak(session, NO_INOUT_HERE);
+            break;
+        case XYZZY:
+        case PLUGH:
+            rspeak(session, NOTHING_HAPPENS);
+            break;
+        case CRAWL:
+            rspeak(session, WHICH_WAY);
+            break;
+        default:
+            rspeak(session, CANT_APPLY);
+        }
+        return;
+    }
+    travel_entry += travel_index[session->game.loc][motion] - 1;
+
+    /* (ESR) We've found a destination that goes with the motion verb.
+     * Next we need to check any conditional(s) on this destination, and
+     * possibly on following entries. */
+    do {
+        for (;;) { /* L12 loop */
+            for (;;) {
+                enum condtype_t condtype = T_CONDTYPE(travel[travel_entry]);
+                long condarg1 = T_CONDARG1(travel[travel_entry]);
+                long condarg2 = T_CONDARG2(travel[travel_entry]);
+                if (condtype < cond_not) {
+                    /* YAML N and [pct N] conditionals */
+                    if (condtype == cond_goto || condtype == cond_pct) {
+                        if (condarg1 == 0 ||
+                            PCT(condarg1))
+                            break;
+                        /* else fall through */
+                    }
+                    /* YAML [with OBJ] clause */
+                    else if (TOTING(condarg1) ||
+                             (condtype == cond_with && AT(condarg1)))
+                        break;
+                    /* else fall through to check [not OBJ STATE] */
+                } else if (session->game.prop[condarg1] != condarg2)
+                    break;
+
+                /* We arrive here on conditional failure.
+                 * Skip to next non-matching destination */
+                int te_tmp = travel_entry;
+                do {
+                    if (T_STOP(travel[te_tmp]))
+                        BUG(CONDITIONAL_TRAVEL_ENTRY_WITH_NO_ALTERATION); // LCOV_EXCL_LINE
+                    ++te_tmp;
+                } while
+                (traveleq(travel_entry, te_tmp));
+                travel_entry = te_tmp;
+            }
+
+            /* Found an eligible rule, now execute it */
+            enum desttype_t desttype = T_DESTTYPE(travel[travel_entry]);
+            session->game.newloc = T_DESTVAL(travel[travel_entry]);
+            if (desttype == dest_goto)
+                return;
+
+            if (desttype == dest_speak) {
+                /* Execute a speak rule */
+                rspeak(session, session->game.newloc);
+                session->game.newloc = session->game.loc;
+                return;
+            } else {
+                switch (session->game.newloc) {
+                case 1:
+                    /* Special travel 1.  Plover-alcove passage.  Can carry only
+                     * emerald.  Note: travel table must include "useless"
+                     * entries going through passage, which can never be used
+                     * for actual motion, but can be spotted by "go back". */
+                    session->game.newloc = (session->game.loc == LOC_PLOVER)
+                                  ? LOC_ALCOVE
+                                  : LOC_PLOVER;
+                    if (session->game.holdng > 1 ||
+                        (session->game.holdng == 1 && !TOTING(EMERALD))) {
+                        session->game.newloc = session->game.loc;
+                        rspeak(session, MUST_DROP);
+                    }
+                    return;
+                case 2:
+                    /* Special travel 2.  Plover transport.  Drop the
+                     * emerald (only use special travel if toting
+                     * it), so he's forced to use the plover-passage
+                     * to get it out.  Having dropped it, go back and
+                     * pretend he wasn't carrying it after all. */
+                    drop(session, EMERALD, session->game.loc);
+                    {
+                        int te_tmp = travel_entry;
+                        do {
+                            if (T_STOP(travel[te_tmp]))
+                                BUG(CONDITIONAL_TRAVEL_ENTRY_WITH_NO_ALTERATION); // LCOV_EXCL_LINE
+                            ++te_tmp;
+                        } while
+                        (traveleq(travel_entry, te_tmp));
+                        travel_entry = te_tmp;
+                    }
+                    continue; /* goto L12 */
+                case 3:
+                    /* Special travel 3.  Troll bridge.  Must be done
+                     * only as special motion so that dwarves won't
+                     * wander across and encounter the bear.  (They
+                     * won't follow the player there because that
+                     * region is forbidden to the pirate.)  If
+                     * game.prop[TROLL]=TROLL_PAIDONCE, he's crossed
+                     * since paying, so step out and block him.
+                     * (standard travel entries check for
+                     * game.prop[TROLL]=TROLL_UNPAID.)  Special stuff
+                     * for bear. */
+                    if (session->game.prop[TROLL] == TROLL_PAIDONCE) {
+                        pspeak(session, TROLL, look, TROLL_PAIDONCE, true);
+                        SETPROP(TROLL, TROLL_UNPAID);
+                        move(session, TROLL2, LOC_NOWHERE);
+                        move(session, TROLL2 + NOBJECTS, IS_FREE);
+                        move(session, TROLL, object_plac[TROLL]);
+                        move(session, TROLL + NOBJECTS, object_fixd[TROLL]);
+                        juggle(session, CHASM);
+                        session->game.newloc = session->game.loc;
+                        return;
+                    } else {
+                        session->game.newloc = object_plac[TROLL] + object_fixd[TROLL] - session->game.loc;
+                        if (session->game.prop[TROLL] == TROLL_UNPAID)
+                            SETPROP(TROLL, TROLL_PAIDONCE);
+                        if (!TOTING(BEAR))
+                            return;
+                        state_change(session, CHASM, BRIDGE_WRECKED);
+                        SETPROP(TROLL, TROLL_GONE);
+                        drop(session, BEAR, session->game.newloc);
+                        SETFIXED(BEAR, IS_FIXED);
+                        SETPROP(BEAR, BEAR_DEAD);
+                        session->game.oldlc2 = session->game.newloc;
+                        croak(session);
+                        return;
+                    }
+                default: // LCOV_EXCL_LINE
+                    BUG(SPECIAL_TRAVEL_500_GT_L_GT_300_EXCEEDS_GOTO_LIST); // LCOV_EXCL_LINE
+                }
+            }
+            break; /* Leave L12 loop */
+        }
+    } while
+    (false);
+}
+
+static bool closecheck(struct session_t* session)
+/*  Handle the closing of the cave.  The cave closes "clock1" turns
+ *  after the last treasure has been located (including the pirate's
+ *  chest, which may of course never show up).  Note that the
+ *  treasures need not have been taken yet, just located.  Hence
+ *  clock1 must be large enough to get out of the cave (it only ticks
+ *  while inside the cave).  When it hits zero, we branch to 10000 to
+ *  start closing the cave, and then sit back and wait for him to try
+ *  to get out.  If he doesn't within clock2 turns, we close the cave;
+ *  if he does try, we assume he panics, and give him a few additional
+ *  turns to get frantic before we close.  When clock2 hits zero, we
+ *  transport him into the final puzzle.  Note that the puzzle depends
+ *  upon all sorts of random things.  For instance, there must be no
+ *  water or oil, since there are beanstalks which we don't want to be
+ *  able to water, since the code can't handle it.  Also, we can have
+ *  no keys, since there is a grate (having moved the fixed object!)
+ *  there separating him from all the treasures.  Most of these
+ *  problems arise from the use of negative prop numbers to suppress
+ *  the object descriptions until he's actually moved the objects. */
+{
+    /* If a turn threshold has been met, apply penalties and tell
+     * the player about it.  The thresholds are in turn order, so only
+     * those at the cursor can be due.  The cursor first follows
+     * game.turns to wherever it is now, since seed, cheat, restore
+     * and undo all move it by more than a turn. */
+    int* next = &session->derived.threshold_next;
+    while (*next > 0 && turn_thresholds[*next - 1].threshold + 1 >= session->game.turns)
+        --*next;
+    while (*next < NTHRESHOLDS && turn_thresholds[*next].threshold + 1 < session->game.turns)
+        ++*next;
+    for (; *next < NTHRESHOLDS && turn_thresholds[*next].threshold + 1 == session->game.turns; ++*next) {
+        session->game.trnluz += turn_thresholds[*next].point_loss;
+        rescore_flags(session);
+        speak(session, turn_thresholds[*next].message);
+    }
+
+    /*  Don't tick game.clock1 unless well into cave (and not at Y2). */
+    if (session->game.tally == 0 && LOCALE(deep) && session->game.loc != LOC_Y2)
+        --session->game.clock1;
+
+    /*  When the first warning comes, we lock the grate, destroy
+     *  the bridge, kill all the dwarves (and the pirate), remove
+     *  the troll and bear (unless dead), and set "closng" to
+     *  true.  Leave the dragon; too much trouble to move it.
+     *  from now until clock2 runs out, he cannot unlock the
+     *  grate, move to any location outside the cave, or create
+     *  the bridge.  Nor can he be resurrected if he dies.  Note
+     *  that the snake is already gone, since he got to the
+     *  treasure accessible only via the hall of the mountain
+     *  king. Also, he's been in giant room (to get eggs), so we
+     *  can refer to it.  Also also, he's gotten the pearl, so we
+     *  know the bivalve is an oyster.  *And*, the dwarves must
+     *  have been activated, since we've found chest. */
+    if (session->game.clock1 == 0) {
+        SETPROP(GRATE, GRATE_CLOSED);
+        SETPROP(FISSURE, UNBRIDGED);
+        for (int i = 1; i <= NDWARVES; i++) {
+            session->game.dseen[i] = false;
+            session->game.dloc[i] = LOC_NOWHERE;
+        }
+        move(session, TROLL, LOC_NOWHERE);
+        move(session, TROLL + NOBJECTS, IS_FREE);
+        move(session, TROLL2, object_plac[TROLL]);
+        move(session, TROLL2 + NOBJECTS, object_fixd[TROLL]);
+        juggle(session, CHASM);
+        if (session->game.prop[BEAR] != BEAR_DEAD)
+            DESTROY(BEAR);
+        SETPROP(CHAIN, CHAIN_HEAP);
+        SETFIXED(CHAIN, IS_FREE);
+        SETPROP(AXE, AXE_HERE);
+        SETFIXED(AXE, IS_FREE);
+        rspeak(session, CAVE_CLOSING);
+        session->game.clock1 = -1;
+        session->game.closng = true;
+        rescore_flags(session);
+        return true;
+    } else if (session->game.clock1 < 0)
+        --session->game.clock2;
+    if (session->game.clock2 == 0) {
+        /*  Once he's panicked, and clock2 has run out, we come here
+         *  to set up the storage room.  The room has two locs,
+         *  hardwired as LOC_NE and LOC_SW.  At the ne end, we
+         *  place empty bottles, a nursery of plants, a bed of
+         *  oysters, a pile of lamps, rods with stars, sleeping
+         *  dwarves, and him.  At the sw end we place grate over
+         *  treasures, snake pit, covey of caged birds, more rods, and
+         *  pillows.  A mirror stretches across one wall.  Many of the
+         *  objects come from known locations and/or states (e.g. the
+         *  snake is known to have been destroyed and needn't be
+         *  carried away from its old "place"), making the various
+         *  objects be handled differently.  We also drop all other
+         *  objects he might be carrying (lest he have some which
+         *  could cause trouble, such as the keys).  We describe the
+         *  flash of light and trundle back. */
+        SETPROP(BOTTLE, put(session, BOTTLE, LOC_NE, EMPTY_BOTTLE));
+        SETPROP(PLANT, put(session, PLANT, LOC_NE, PLANT_THIRSTY));
+        SETPROP(OYSTER, put(session, OYSTER, LOC_NE, STATE_FOUND));
+        SETPROP(LAMP, put(session, LAMP, LOC_NE, LAMP_DARK));
+        SETPROP(ROD, put(session, ROD, LOC_NE, STATE_FOUND));
+        SETPROP(DWARF, put(session, DWARF, LOC_NE, 0));
+        session->game.loc = LOC_NE;
+        session->game.oldloc = LOC_NE;
+        session->game.newloc = LOC_NE;
+        /*  Leave the grate with normal (non-negative) property.
+         *  Reuse sign. */
+        put(session, GRATE, LOC_SW, 0);
+        put(session, SIGN, LOC_SW, 0);
+        SETPROP(SIGN, ENDGAME_SIGN);
+        SETPROP(SNAKE, put(session, SNAKE, LOC_SW, SNAKE_CHASED));
+        SETPROP(BIRD, put(session, BIRD, LOC_SW, BIRD_CAGED));
+        SETPROP(CAGE, put(session, CAGE, LOC_SW, STATE_FOUND));
+        SETPROP(ROD2, put(session, ROD2, LOC_SW, STATE_FOUND));
+        SETPROP(PILLOW, put(session, PILLOW, LOC_SW, STATE_FOUND));
+
+        SETPROP(MIRROR, put(session, MIRROR, LOC_NE, STATE_FOUND));
+        SETFIXED(MIRROR, LOC_SW);
+
+        for (obj_t i = next_object(CARRIED_SET, NO_OBJECT); i != NO_OBJECT; i = next_object(CARRIED_SET, i))
+            DESTROY(i);
+
+        rspeak(session, CAVE_CLOSED);
+        session->game.closed = true;
+        rescore_flags(session);
+        return true;
+    }
+
+    return false;
+}
+
+static void lampcheck(struct session_t* session)
+/* Check game limit and lamp timers */
+{
+    if (session->game.prop[LAMP] == LAMP_BRIGHT)
+        --session->game.limit;
+
+    /*  Another way we can force an end to things is by having the
+     *  lamp give out.  When it gets close, we come here to warn him.
+     *  First following arm checks if the lamp and fresh batteries are
+     *  here, in which case we replace the batteries and continue.
+     *  Second is for other cases of lamp dying.  Even after it goes
+     *  out, he can explore outside for a while if desired. */
+    if (session->game.limit <= WARNTIME) {
+        if (HERE(BATTERY) && session->game.prop[BATTERY] == FRESH_BATTERIES && HERE(LAMP)) {
+            rspeak(session, REPLACE_BATTERIES);
+            SETPROP(BATTERY, DEAD_BATTERIES);
+#ifdef __unused__
+            /* This code from the original game seems to have been faulty.
+             * No tests ever passed the guard, and with the guard removed
+             * the game hangs when the lamp limit is reached.
+             */
+            if (TOTING(BATTERY))
+                drop(session, BATTERY, session->game.loc);
+#endif
+            session->game.limit += BATTERYLIFE;
+            session->game.lmwarn = false;
+        } else if (!session->game.lmwarn && HERE(LAMP)) {
+            session->game.lmwarn = true;
+            if (session->game.prop[BATTERY] == DEAD_BATTERIES)
+                rspeak(session, MISSING_BATTERIES);
+            else if (session->game.place[BATTERY] == LOC_NOWHERE)
+                rspeak(session, LAMP_DIM);
+            else
+                rspeak(session, GET_BATTERIES);
+        }
+    }
+    if (session->game.limit == 0) {
+        session->game.limit = -1;
+        SETPROP(LAMP, LAMP_DARK);
+        if (HERE(LAMP))
+            rspeak(session, LAMP_OUT);
+    }
+}
+
+static void listobjects(struct session_t* session)
+/*  Print out descriptions of objects at this location.  If
+ *  not closing and property value is negative, tally off
+ *  another treasure.  Rug is special case; once seen, its
+ *  game.prop is RUG_DRAGON (dragon on it) till dragon is killed.
+ *  Similarly for chain; game.prop is initially CHAINING_BEAR (locked to
+ *  bear).  These hacks are because game.prop=0 is needed to
+ *  get full score. */
+{
+    if (!DARK(session->game.loc)) {
+        SETABBREV(session->game.loc, session->game.abbrev[session->game.loc] + 1);
+        for (int i = session->game.atloc[session->game.loc]; i != 0; i = session->game.link[i]) {
+            obj_t obj = i;
+            if (obj > NOBJECTS)
+                obj = obj - NOBJECTS;
+            if (obj == STEPS && TOTING(NUGGET))
+                continue;
+            if (session->game.prop[obj] < 0) {
+                if (session->game.closed)
+                    continue;
+                SETPROP(obj, STATE_FOUND);
+                if (obj == RUG)
+                    SETPROP(RUG, RUG_DRAGON);
+                if (obj == CHAIN)
+                    SETPROP(CHAIN, CHAINING_BEAR);
+                --session->game.tally;
+                /*  Note: There used to be a test here to see whether the
+                 *  player had blown it so badly that he could never ever see
+                 *  the remaining treasures, and if so the lamp was zapped to
+                 *  35 turns.  But the tests were too simple-minded; things
+                 *  like killing the bird before the snake was gone (can never
+                 *  see jewelry), and doing it "right" was hopeless.  E.G.,
+                 *  could cross troll bridge several times, using up all
+                 *  available treasures, breaking vase, using coins to buy
+                 *  batteries, etc., and eventually never be able to get
+                 *  across again.  If bottle were left on far side, could then
+                 *  never get eggs or trident, and the effects propagate.  So
+                 *  the whole thing was flushed.  anyone who makes such a
+                 *  gross blunder isn't likely to find everything else anyway
+                 *  (so goes the rationalisation). */
+            }
+            int kk = session->game.prop[obj];
+            if (obj == STEPS)
+                kk = (session->game.loc == session->game.fixed[STEPS])
+                     ? STEPS_UP
+                     : STEPS_DOWN;
+            pspeak(session, obj, look, kk, true);
+        }
+    }
+}
+
+static bool do_command(struct session_t* session)
+/* Get and execute a command */
+{
+    /*  Pick up at the prompt if that's where we stopped last time. */
+    if (session->waiting)
+        goto Lprompt;
+
+    /*  Can't leave cave once it's closing (except by main office). */
+    if (OUTSID(session->game.newloc) && session->game.newloc != 0 && session->game.closng) {
+        rspeak(session, EXIT_CLOSED);
+        session->game.newloc = session->game.loc;
+        if (!session->game.panic)
+            session->game.clock2 = PANICTIME;
+        session->game.panic = true;
+    }
+
+    /*  See if a dwarf has seen him and has come from where he
+     *  wants to go.  If so, the dwarf's blocking his way.  If
+     *  coming from place forbidden to pirate (dwarves rooted in
+     *  place) let him get out (and attacked). */
+    if (session->game.newloc != session->game.loc && !LOCALE(forced) && !CNDBIT(session->game.loc, COND_NOARRR)) {
+        for (size_t i = 1; i <= NDWARVES - 1; i++) {
+            if (session->game.odloc[i] == session->game.newloc && session->game.dseen[i]) {
+                session->game.newloc = session->game.loc;
+                rspeak(session, DWARF_BLOCK);
+                break;
+            }
+        }
+    }
+    session->game.loc = session->game.newloc;
+
+    if (!dwarfmove(session))
+        croak(session);
+
+    /*  Describe the current location and (maybe) get next command. */
+
+    for (;;) {
+        if (session->game.loc == 0)
+            croak(session);
+        string_t msg;
+        msgops_t ops;
+        msg = locations[session->game.loc].description.small;
+        ops = locations[session->game.loc].description.small_ops;
+        if (MOD(session->game.abbrev[session->game.loc], session->game.abbnum) == 0 ||
+            msg == 0) {
+            msg = locations[session->game.loc].description.big;
+            ops = locations[session->game.loc].description.big_ops;
+        }
+        if (!LOCALE(forced) && DARK(session->game.loc)) {
+            /*  The easiest way to get killed is to fall into a pit in
+             *  pitch darkness. */
+            if (session->game.wzdark && PCT(35)) {
+                rspeak(session, PIT_FALL);
+                session->game.oldlc2 = session->game.loc;
+                croak(session);
+                continue;	/* back to top of main interpreter loop */
+            }
+            msg = arbitrary_messages[PITCH_DARK];
+            ops = arbitrary_message_ops[PITCH_DARK];
+        }
+        if (TOTING(BEAR))
+            rspeak(session, TAME_BEAR);
+        cspeak(session, msg, ops);
+        if (LOCALE(forced)) {
+            if (forced_dest[session->game.loc] >= 0) {
+                /* What playermove(HERE) would do, worked out in advance */
+                session->game.oldlc2 = session->game.oldloc;
+                session->game.oldloc = session->game.loc;
+                session->game.newloc = forced_dest[session->game.loc];
+            } else
+                playermove(session, HERE);
+            return true;
+        }
+        if (session->game.loc == LOC_Y2 && PCT(25) && !session->game.closng)
+            rspeak(session, SAYS_PLUGH);
+
+        listobjects(session);
+
+Lclearobj:
+        session->game.oldobj = session->command.obj;
+
+        checkhints(session);
+
+        /*  If closing time, check for any objects being toted with
+         *  game.prop < 0 and stash them.  This way objects won't be
+         *  described until they've been picked up and put down
+         *  separate from their respective piles. */
+        if (session->game.closed) {
+            if (session->game.prop[OYSTER] < 0 && TOTING(OYSTER))
+                pspeak(session, OYSTER, look, 1, true);
+            for (obj_t i = next_object(CARRIED_SET, NO_OBJECT); i != NO_OBJECT; i = next_object(CARRIED_SET, i)) {
+                if (session->game.prop[i] < 0) {
+                    SETPROP(i, STASHED(i));
+                }
+            }
+        }
+        session->game.wzdark = DARK(session->game.loc);
+        if (session->game.knfloc > 0 && session->game.knfloc != session->game.loc)
+            session->game.knfloc = 0;
+
+Lprompt:
+        /* Stop here if as many commands as were asked for are done */
+        if (session->budget == 0) {
+            session->waiting = true;
+            longjmp(session->unwind, PAUSED);
+        }
+        if (session->budget > 0)
+            --session->budget;
+        session->waiting = false;
+
+        /* Preserve state from last command for reuse when required */
+        command_t preserve = session->command;
+
+        /* Each command is a turn as far as undo is concerned, even
+         * those do_command() obeys without returning. */
+        if (session->journal.enabled)
+            journal_mark(session);
+
+        // Get command input from user
+        if (!get_command_input(session, &session->command))
+            return false;
+
+#ifdef GDEBUG
+        /* Needs to stay synced with enum word_type_t */
+        const char *types[] = {"NO_WORD_TYPE", "MOTION", "OBJECT", "ACTION", "NUMERIC"};
+        /* needs to stay synced with enum speechpart */
+        const char *roles[] = {"unknown", "intransitive", "transitive"};
+        output_printf(session, "Preserve: role = %s type1 = %s, id1 = %ld, type2 = %s, id2 = %ld\n",
+               roles[preserve.part],
+               types[preserve.word[0].type],
+               preserve.word[0].id,
+               types[preserve.word[1].type],
+               preserve.word[1].id);
+        output_printf(session, "Command: role = %s type1 = %s, id1 = %ld, type2 = %s, id2 = %ld\n",
+               roles[session->command.part],
+               types[session->command.word[0].type],
+               session->command.word[0].id,
+               types[session->command.word[1].type],
+               session->command.word[1].id);
+#endif
+
+        /* Handle of objectless action followed by actionless object */
+        if (preserve.word[0].type == ACTION && preserve.word[1].type == NO_WORD_TYPE && session->command.word[1].id == 0)
+            session->command.verb = preserve.verb;
+
+#ifdef BROKEN
+        /* Handling of actionless object followed by objectless action */
+        if (preserve.word[0].type == OBJECT && preserve.word[1].type == NO_WORD_TYPE && session->command.word[1].id == 0 && session->command.word[0].id == CARRY)
+            session->command.obj = preserve.obj;
+#endif /* BROKEN */
+	
+        ++session->game.turns;
+
+        if (closecheck(session)) {
+            if (session->game.closed)
+                return true;
+        } else
+            lampcheck(session);
+
+        if (session->command.word[0].type == MOTION && session->command.word[0].id == ENTER
+            && (session->command.word[1].id == STREAM || session->command.word[1].id == WATER)) {
+            if (LOCALE(liquid) == WATER)
+                rspeak(session, FEET_WET);
+            else
+                rspeak(session, WHERE_QUERY);
+
+            goto Lclearobj;
+        }
+
+        if (session->command.word[0].type == OBJECT) {
+            if (session->command.word[0].id == GRATE) {
+                session->command.word[0].type = MOTION;
+                if (session->game.loc == LOC_START ||
+                    session->game.loc == LOC_VALLEY ||
+                    session->game.loc == LOC_SLIT) {
+                    session->command.word[0].id = DEPRESSION;
+                }
+                if (session->game.loc == LOC_COBBLE ||
+                    session->game.loc == LOC_DEBRIS ||
+                    session->game.loc == LOC_AWKWARD ||
+                    session->game.loc == LOC_BIRD ||
+                    session->game.loc == LOC_PITTOP) {
+                    session->command.word[0].id = ENTRANCE;
+                }
+            }
+            if ((session->command.word[0].id == WATER || session->command.word[0].id == OIL) && (session->command.word[1].id == PLANT || session->command.word[1].id == DOOR)) {
+                if (AT(session->command.word[1].id)) {
+                    session->command.word[1] = session->command.word[0];
+                    session->command.word[0].id = POUR;
+                    session->command.word[0].type = ACTION;
+                    session->command.word[0].raw = "pour";
+                }
+            }
+            if (session->command.word[0].id == CAGE && session->command.word[1].id == BIRD && HERE(CAGE) && HERE(BIRD)) {
+                session->command.word[0].id = CARRY;
+                session->command.word[0].type = ACTION;
+            }
+
+            /* From OV to VO form */
+            if (session->command.word[0].type == OBJECT && session->command.word[1].type == ACTION) {
+                command_word_t stage = session->command.word[0];
+                session->command.word[0] = session->command.word[1];
+                session->command.word[1] = stage;
+            }
+        }
+
+Lookup:
+        if (strncasecmp(session->command.word[0].raw, "west", sizeof("west")) == 0) {
+            if (++session->game.iwest == 10)
+                rspeak(session, W_IS_WEST);
+        }
+        if (strncasecmp(session->command.word[0].raw, "go", sizeof("go")) == 0 && session->command.word[1].id != WORD_EMPTY) {
+            if (++session->game.igo == 10)
+                rspeak(session, GO_UNNEEDED);
+        }
+        if (session->command.word[0].id == WORD_NOT_FOUND) {
+            /* Gee, I don't understand. */
+            sspeak(session, DONT_KNOW, session->command.word[0].raw);
+            goto Lclearobj;
+        }
+        switch (session->command.word[0].type) {
+        case NO_WORD_TYPE: // FIXME: treating NO_WORD_TYPE as a motion word is confusing
+        case MOTION:
+            playermove(session, session->command.word[0].id);
+            return true;
+        case OBJECT:
+            session->command.part = unknown;
+            session->command.obj = session->command.word[0].id;
+            break;
+        case ACTION:
+            if (session->command.word[1].type == NUMERIC)
+                session->command.part = transitive;
+            else
+                session->command.part = intransitive;
+            session->command.verb = session->command.word[0].id;
+            break;
+        case NUMERIC: // LCOV_EXCL_LINE
+        default: // LCOV_EXCL_LINE
+            BUG(VOCABULARY_TYPE_N_OVER_1000_NOT_BETWEEN_0_AND_3); // LCOV_EXCL_LINE
+        }
+        switch (action(session, session->command)) {
+        case GO_TERMINATE:
+            return true;
+        case GO_MOVE:
+            playermove(session, NUL);
+            return true;
+        case GO_TOP:
+            continue;	/* back to top of main interpreter loop */
+        case GO_WORD2:
+#ifdef GDEBUG
+            output_printf(session, "Word shift\n");
+#endif /* GDEBUG */
+            /* Get second word for analysis. */
+            session->command.word[0] = session->command.word[1];
+            session->command.word[1] = empty_command_word;
+            goto Lookup;
+        case GO_UNKNOWN: {
+            /*  Random intransitive verbs come here.  Clear obj just in case
+             *  (see attack()). */
+            char verb[LINESIZE];
+            snprintf(verb, sizeof(verb), "%s", session->command.word[0].raw);
+            verb[0] = toupper(verb[0]);
+            sspeak(session, DO_WHAT, verb);
+            session->command.obj = 0;
+        }
+        // Fallthrough
+        case GO_CLEAROBJ:
+            goto Lclearobj;
+        case GO_DWARFWAKE:
+            /*  Oh dear, he's disturbed the dwarves. */
+            rspeak(session, DWARVES_AWAKEN);
+            terminate(session, endgame);
+        default: // LCOV_EXCL_LINE
+            BUG(ACTION_RETURNED_PHASE_CODE_BEYOND_END_OF_SWITCH); // LCOV_EXCL_LINE
+        }
+    }
+}
+
+/* end */
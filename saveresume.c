@@ -10,8 +10,8 @@
  */
 
 #include <stdlib.h>
+#include <stddef.h>
 #include <string.h>
-#include <editline/readline.h>
 #include <time.h>
 #include <inttypes.h>
 
@@ -30,26 +30,27 @@ struct save_t {
     int64_t savetime;
     int32_t mode;		/* not used, must be present for version detection */
     int32_t version;
-    struct game_t game;
+    struct game_t state;
 };
-struct save_t save;
 
 #define IGNORE(r) do{if (r){}}while(0)
 
-int savefile(FILE *fp, int32_t version)
+int savefile(struct session_t* session, FILE *fp, int32_t version)
 /* Save game to file. No input or output from user. */
 {
+    struct save_t save;
+    memset(&save, '\0', sizeof(save));
     save.savetime = time(NULL);
     save.mode = -1;
     save.version = (version == 0) ? VRSION : version;
 
-    save.game = game;
+    save.state = session->game;
     IGNORE(fwrite(&save, sizeof(struct save_t), 1, fp));
     return (0);
 }
 
 /* Suspend and resume */
-int suspend(void)
+int suspend(struct session_t* session)
 {
     /*  Suspend.  Offer to save things in a file, but charging
      *  some points (so can't win by using saved games to retry
@@ -61,28 +62,30 @@ int suspend(void)
 #endif
     FILE *fp = NULL;
 
-    rspeak(SUSPEND_WARNING);
-    if (!yes(arbitrary_messages[THIS_ACCEPTABLE], arbitrary_messages[OK_MAN], arbitrary_messages[OK_MAN]))
+    rspeak(session, SUSPEND_WARNING);
+    if (!yes(session, arbitrary_messages[THIS_ACCEPTABLE], arbitrary_messages[OK_MAN], arbitrary_messages[OK_MAN]))
         return GO_CLEAROBJ;
-    game.saved = game.saved + 5;
+    session->game.saved = session->game.saved + 5;
+    rescore_flags(session);
 
     while (fp == NULL) {
-        char* name = readline("\nFile name: ");
+        output_flush(session);
+        char* name = session->settings.input(session, "\nFile name: ");
         if (name == NULL)
             return GO_TOP;
         fp = fopen(name, WRITE_MODE);
         if (fp == NULL)
-            printf("Can't open file %s, try again.\n", name);
+            output_printf(session, "Can't open file %s, try again.\n", name);
         free(name);
     }
 
-    savefile(fp, VRSION);
+    savefile(session, fp, VRSION);
     fclose(fp);
-    rspeak(RESUME_HELP);
-    exit(EXIT_SUCCESS);
+    rspeak(session, RESUME_HELP);
+    session_end(session, EXIT_SUCCESS);
 }
 
-int resume(void)
+int resume(struct session_t* session)
 {
     /*  Resume.  Read a suspended game back from a file.
      *  If ADVENT_NOSAVE is defined, do nothing instead. */
@@ -92,29 +95,30 @@ int resume(void)
 #endif
     FILE *fp = NULL;
 
-    if (game.loc != 1 ||
-        game.abbrev[1] != 1) {
-        rspeak(RESUME_ABANDON);
-        if (!yes(arbitrary_messages[THIS_ACCEPTABLE], arbitrary_messages[OK_MAN], arbitrary_messages[OK_MAN]))
+    if (session->game.loc != 1 ||
+        session->game.abbrev[1] != 1) {
+        rspeak(session, RESUME_ABANDON);
+        if (!yes(session, arbitrary_messages[THIS_ACCEPTABLE], arbitrary_messages[OK_MAN], arbitrary_messages[OK_MAN]))
             return GO_CLEAROBJ;
     }
 
     while (fp == NULL) {
-        char* name = readline("\nFile name: ");
+        output_flush(session);
+        char* name = session->settings.input(session, "\nFile name: ");
         if (name == NULL)
             return GO_TOP;
         fp = fopen(name, READ_MODE);
         if (fp == NULL)
-            printf("Can't open file %s, try again.\n", name);
+            output_printf(session, "Can't open file %s, try again.\n", name);
         free(name);
     }
 
-    return restore(fp);
+    return restore(session, fp);
 }
 
 bool is_valid(struct game_t*);
 
-int restore(FILE* fp)
+int restore(struct session_t* session, FILE* fp)
 {
     /*  Read and restore game state from file, assuming
      *  sane initial state.
@@ -123,16 +127,328 @@ int restore(FILE* fp)
     return GO_UNKNOWN;
 #endif
 
+    struct save_t save;
+    memset(&save, '\0', sizeof(save));
     IGNORE(fread(&save, sizeof(struct save_t), 1, fp));
     fclose(fp);
     if (save.version != VRSION) {
-        rspeak(VERSION_SKEW, save.version / 10, MOD(save.version, 10), VRSION / 10, MOD(VRSION, 10));
-    } else if (is_valid(&save.game)) {
-        game = save.game;
+        rspeak(session, VERSION_SKEW, save.version / 10, MOD(save.version, 10), VRSION / 10, MOD(VRSION, 10));
+    } else if (is_valid(&save.state)) {
+        session->game = save.state;
+        derived_init(session);
+        if (session->journal.enabled)
+            journal_start(session);
     }
     return GO_TOP;
 }
 
+/* In-memory snapshots, for tools that branch a game many times over */
+
+void snapshot_take(struct session_t* session, struct snapshot_t* snap)
+/* Copy the game in progress into caller-owned memory, which must not
+ * hold a snapshot not yet freed. */
+{
+    snap->state = session->game;
+    snap->derived = session->derived;
+    (void)command_copy(&snap->command, &snap->command_line,
+                       &session->command, session->command_line);
+}
+
+void snapshot_restore(struct session_t* session, const struct snapshot_t* snap)
+/* Put the game back as it was when snap was taken. */
+{
+    session->game = snap->state;
+    session->derived = snap->derived;
+    free(session->command_line);
+    (void)command_copy(&session->command, &session->command_line,
+                       &snap->command, snap->command_line);
+    if (session->journal.enabled)
+        journal_start(session);
+}
+
+void snapshot_free(struct snapshot_t* snap)
+/* Release what a snapshot owns; the memory it sits in is the caller's. */
+{
+    free(snap->command_line);
+    snap->command_line = NULL;
+}
+
+/*  Undo and redo.  The journal keeps, for each turn, only the words of
+ *  game_t that the turn changed, so stepping back costs in proportion
+ *  to what happened rather than to the size of the game.  The large
+ *  arrays are logged as they are written; the rest of game_t is small
+ *  and is compared against a shadow copy when each turn ends. */
+
+#define WORD(field)	(offsetof(struct game_t, field) / sizeof(long))
+#define NWORDS(field)	(sizeof(((struct game_t*)0)->field) / sizeof(long))
+
+/* The parts of game_t not written through hashed_set(), in words */
+static const struct {
+    size_t from, to;
+} unlogged[] = {
+    {0, WORD(abbrev)},
+    {WORD(dseen), WORD(fixed)},
+    {WORD(hinted), WORD(prop)},
+    {WORD(prop) + NWORDS(prop), sizeof(struct game_t) / sizeof(long)},
+};
+
+/* The parts that are, with what hashed_set() needs to write them */
+static const struct {
+    enum hashfield field;
+    size_t from, to;
+} logged[] = {
+    {HASH_ABBREV, WORD(abbrev), WORD(abbrev) + NWORDS(abbrev)},
+    {HASH_ATLOC, WORD(atloc), WORD(atloc) + NWORDS(atloc)},
+    {HASH_FIXED, WORD(fixed), WORD(fixed) + NWORDS(fixed)},
+    {HASH_LINK, WORD(link), WORD(link) + NWORDS(link)},
+    {HASH_PLACE, WORD(place), WORD(place) + NWORDS(place)},
+    {HASH_PROP, WORD(prop), WORD(prop) + NWORDS(prop)},
+};
+
+/* What the tables above take for granted about the layout of game_t */
+_Static_assert(sizeof(struct game_t) % sizeof(long) == 0,
+               "game_t must be a whole number of words");
+_Static_assert(offsetof(struct game_t, abbnum) == sizeof(long),
+               "lcg_x and its padding must fill the first word");
+_Static_assert(offsetof(struct game_t, abbrev) % sizeof(long) == 0,
+               "zzword must be padded out to a word boundary");
+_Static_assert(WORD(abbrev) + NWORDS(abbrev) == WORD(atloc)
+               && WORD(atloc) + NWORDS(atloc) == WORD(dseen),
+               "abbrev and atloc must be adjacent and followed by dseen");
+_Static_assert(WORD(fixed) + NWORDS(fixed) == WORD(link)
+               && WORD(link) + NWORDS(link) == WORD(place)
+               && WORD(place) + NWORDS(place) == WORD(hinted),
+               "fixed, link and place must be adjacent and followed by hinted");
+_Static_assert(WORD(hinted) < WORD(prop)
+               && WORD(prop) + NWORDS(prop) <= sizeof(struct game_t) / sizeof(long),
+               "prop must come after hinted");
+_Static_assert(sizeof(long) == sizeof(loc_t) && sizeof(long) == sizeof(obj_t),
+               "logged arrays must have one word per element");
+
+#define NELEMS(a)	(sizeof(a) / sizeof((a)[0]))
+
+static long get_word(struct session_t* session, size_t word)
+{
+    long value;
+    memcpy(&value, (char*)&session->game + word * sizeof(long), sizeof(long));
+    return value;
+}
+
+static void put_word(struct session_t* session, size_t word, long value)
+/* Write one word of game_t back, keeping the derived state in step. */
+{
+    for (size_t i = 0; i < NELEMS(logged); i++) {
+        if (word >= logged[i].from && word < logged[i].to) {
+            long* array = (long*)&session->game + logged[i].from;
+            long index = word - logged[i].from;
+            hashed_set(session, logged[i].field, array, index, value);
+            return;
+        }
+    }
+    memcpy((char*)&session->game + word * sizeof(long), &value, sizeof(long));
+}
+
+static void relink(struct session_t* session, size_t from, size_t to)
+/* After replaying entries [from, to), redo session->derived.prev[] for
+ * every location whose list they could have changed: those whose heads
+ * changed, those objects moved from or to, and those where an object
+ * whose link changed now lies. */
+{
+    for (size_t e = from; e < to; e++) {
+        const struct journal_entry_t* entry = &session->journal.entries[e];
+        size_t word = entry->word;
+        if (word >= WORD(atloc) && word < WORD(atloc) + NWORDS(atloc))
+            links_at(session, word - WORD(atloc));
+        else if ((word >= WORD(place) && word < WORD(place) + NWORDS(place))
+                 || (word >= WORD(fixed) && word < WORD(fixed) + NWORDS(fixed))) {
+            links_at(session, entry->before);
+            links_at(session, entry->after);
+        } else if (word >= WORD(link) && word < WORD(link) + NWORDS(link)) {
+            obj_t obj = word - WORD(link);
+            links_at(session, obj > NOBJECTS ? session->game.fixed[obj - NOBJECTS] : session->game.place[obj]);
+        }
+    }
+}
+
+static void sync_shadow(struct session_t* session)
+{
+    size_t k = 0;
+    for (size_t i = 0; i < NELEMS(unlogged); i++)
+        for (size_t w = unlogged[i].from; w < unlogged[i].to; w++)
+            session->journal.shadow[k++] = get_word(session, w);
+}
+
+void journal_free(struct journal_t* j)
+/* Release everything j holds and leave it empty and disabled. */
+{
+    for (size_t t = 0; t < j->nturns; t++)
+        free(j->turns[t].command_line);
+    free(j->start.command_line);
+    free(j->entries);
+    free(j->turns);
+    free(j->shadow);
+    memset(j, '\0', sizeof(*j));
+}
+
+void journal_stop(struct session_t* session)
+/* Stop keeping undo history and forget what there is. */
+{
+    journal_free(&session->journal);
+}
+
+static void keep_command(struct session_t* session, struct journal_turn_t* turn)
+/* Note the command in hand as the one at turn's end. */
+{
+    free(turn->command_line);
+    (void)command_copy(&turn->command, &turn->command_line,
+                       &session->command, session->command_line);
+}
+
+static void back_to(struct session_t* session, const struct journal_turn_t* turn)
+/* Put back the command that was in hand at turn's end. */
+{
+    free(session->command_line);
+    (void)command_copy(&session->command, &session->command_line,
+                       &turn->command, turn->command_line);
+}
+
+void journal_start(struct session_t* session)
+/* Start keeping undo history, from the game as it now stands. */
+{
+    size_t nshadow = 0;
+    for (size_t i = 0; i < NELEMS(unlogged); i++)
+        nshadow += unlogged[i].to - unlogged[i].from;
+
+    journal_stop(session);
+    session->journal.shadow = calloc(nshadow, sizeof(long));
+    if (session->journal.shadow == NULL)
+        return;	// LCOV_EXCL_LINE
+    session->journal.enabled = true;
+    keep_command(session, &session->journal.start);
+    sync_shadow(session);
+}
+
+static void journal_push(struct session_t* session, size_t word, long before, long after)
+{
+    struct journal_t* j = &session->journal;
+    if (j->undone > 0) {
+        /* Something new happened after an undo; the redo history goes */
+        while (j->undone > 0) {
+            free(j->turns[--j->nturns].command_line);
+            j->undone--;
+        }
+        j->nentries = (j->nturns > 0) ? j->turns[j->nturns - 1].end : 0;
+    }
+    if (j->nentries == j->maxentries) {
+        size_t max = j->maxentries ? j->maxentries * 2 : 256;
+        struct journal_entry_t* entries = realloc(j->entries, max * sizeof(*entries));
+        if (entries == NULL) {
+            journal_stop(session);	// LCOV_EXCL_LINE
+            return;	// LCOV_EXCL_LINE
+        }
+        j->entries = entries;
+        j->maxentries = max;
+    }
+    j->entries[j->nentries].word = word;
+    j->entries[j->nentries].before = before;
+    j->entries[j->nentries].after = after;
+    j->nentries++;
+}
+
+void journal_record(struct session_t* session, const long* cell, long before, long after)
+/* Log a write to one of the large arrays, called by hashed_set(). */
+{
+    journal_push(session, cell - (const long*)&session->game, before, after);
+}
+
+void journal_mark(struct session_t* session)
+/* End the turn: log whatever else has changed, and close the turn off. */
+{
+    struct journal_t* j = &session->journal;
+    size_t k = 0;
+    for (size_t i = 0; i < NELEMS(unlogged); i++) {
+        for (size_t w = unlogged[i].from; w < unlogged[i].to; w++, k++) {
+            long now = get_word(session, w);
+            if (now != j->shadow[k]) {
+                journal_push(session, w, j->shadow[k], now);
+                if (!j->enabled)
+                    return;	// LCOV_EXCL_LINE
+                j->shadow[k] = now;
+            }
+        }
+    }
+    if (j->undone > 0)
+        return;
+    struct journal_turn_t* last = (j->nturns > 0) ? &j->turns[j->nturns - 1] : &j->start;
+    if (j->nentries == last->end) {
+        /* Nothing changed, but the command in hand may have */
+        keep_command(session, last);
+        return;
+    }
+    if (j->nturns == j->maxturns) {
+        size_t max = j->maxturns ? j->maxturns * 2 : 64;
+        struct journal_turn_t* turns = realloc(j->turns, max * sizeof(*turns));
+        if (turns == NULL) {
+            journal_stop(session);	// LCOV_EXCL_LINE
+            return;	// LCOV_EXCL_LINE
+        }
+        j->turns = turns;
+        j->maxturns = max;
+    }
+    j->turns[j->nturns].end = j->nentries;
+    j->turns[j->nturns].command_line = NULL;
+    keep_command(session, &j->turns[j->nturns++]);
+}
+
+bool journal_undo(struct session_t* session)
+/* Take back the last turn.  False if there is nothing to take back. */
+{
+    struct journal_t* j = &session->journal;
+    if (!j->enabled)
+        return false;
+    journal_mark(session);
+    size_t turn = j->nturns - j->undone;
+    if (!j->enabled || turn == 0)
+        return false;
+    const struct journal_turn_t* prev = (turn > 1) ? &j->turns[turn - 2] : &j->start;
+    size_t from = prev->end;
+    j->replaying = true;
+    for (size_t e = j->turns[turn - 1].end; e > from; e--)
+        put_word(session, j->entries[e - 1].word, j->entries[e - 1].before);
+    j->replaying = false;
+    relink(session, from, j->turns[turn - 1].end);
+    back_to(session, prev);
+    j->undone++;
+    rescore_flags(session);
+    hints_init(session);
+    sync_shadow(session);
+    return true;
+}
+
+bool journal_redo(struct session_t* session)
+/* Replay a turn taken back by journal_undo().  False if there is none. */
+{
+    struct journal_t* j = &session->journal;
+    if (!j->enabled)
+        return false;
+    journal_mark(session);
+    if (!j->enabled || j->undone == 0)
+        return false;
+    size_t turn = j->nturns - j->undone;
+    size_t from = (turn > 0) ? j->turns[turn - 1].end : 0;
+    j->replaying = true;
+    for (size_t e = from; e < j->turns[turn].end; e++)
+        put_word(session, j->entries[e].word, j->entries[e].after);
+    j->replaying = false;
+    relink(session, from, j->turns[turn].end);
+    back_to(session, &j->turns[turn]);
+    j->undone--;
+    rescore_flags(session);
+    hints_init(session);
+    sync_shadow(session);
+    return true;
+}
+
 bool is_valid(struct game_t* valgame)
 {
     /*  Save files can be roughly grouped into three groups:
@@ -193,11 +509,9 @@ bool is_valid(struct game_t* valgame)
 
     /* Recalculate tally, throw the towel if in disagreement */
     long temp_tally = 0;
-    for (int treasure = 1; treasure <= NOBJECTS; treasure++) {
-        if (objects[treasure].is_treasure) {
-            if (valgame->prop[treasure] == STATE_NOTFOUND) {
-                ++temp_tally;
-            }
+    for (int t = 0; t < NTREASURES; t++) {
+        if (valgame->prop[treasures[t]] == STATE_NOTFOUND) {
+            ++temp_tally;
         }
     }
     if (temp_tally != valgame->tally) {
@@ -9,11 +9,9 @@
 #include "advent.h"
 #include "dungeon.h"
 
-static int mxscor;	/* ugh..the price for having score() not exit. */
-
-long score(enum termination mode)
-/* mode is 'scoregame' if scoring, 'quitgame' if quitting, 'endgame' if died
- * or won */
+static long rescan(struct session_t* session, enum termination mode)
+/* Work the score out from scratch.  This is the reference the running
+ * total kept by rescore() and rescore_flags() has to agree with. */
 {
     int score = 0;
 
@@ -38,21 +36,16 @@ long score(enum termination mode)
 
     /*  First tally up the treasures.  Must be in building and not broken.
      *  Give the poor guy 2 points just for finding each treasure. */
-    mxscor = 0;
-    for (int i = 1; i <= NOBJECTS; i++) {
-        if (!objects[i].is_treasure)
-            continue;
+    session->mxscor = 0;
+    for (int t = 0; t < NTREASURES; t++) {
+        int i = treasures[t];
         if (objects[i].inventory != 0) {
-            int k = 12;
-            if (i == CHEST)
-                k = 14;
-            if (i > CHEST)
-                k = 16;
-            if (game.prop[i] > STATE_NOTFOUND)
+            int k = deposit_points[i];
+            if (session->game.prop[i] > STATE_NOTFOUND)
                 score += 2;
-            if (game.place[i] == LOC_BUILDING && game.prop[i] == STATE_FOUND)
+            if (session->game.place[i] == LOC_BUILDING && session->game.prop[i] == STATE_FOUND)
                 score += k - 2;
-            mxscor += k;
+            session->mxscor += k;
         }
     }
 
@@ -62,78 +55,182 @@ long score(enum termination mode)
      *  indicates whether he reached the endgame.  And if he got as far as
      *  "cave closed" (indicated by "game.closed"), then bonus is zero for
      *  mundane exits or 133, 134, 135 if he blew it (so to speak). */
-    score += (NDEATHS - game.numdie) * 10;
-    mxscor += NDEATHS * 10;
+    score += (NDEATHS - session->game.numdie) * 10;
+    session->mxscor += NDEATHS * 10;
     if (mode == endgame)
         score += 4;
-    mxscor += 4;
-    if (game.dflag != 0)
+    session->mxscor += 4;
+    if (session->game.dflag != 0)
         score += 25;
-    mxscor += 25;
-    if (game.closng)
+    session->mxscor += 25;
+    if (session->game.closng)
         score += 25;
-    mxscor += 25;
-    if (game.closed) {
-        if (game.bonus == none)
+    session->mxscor += 25;
+    if (session->game.closed) {
+        if (session->game.bonus == none)
             score += 10;
-        if (game.bonus == splatter)
+        if (session->game.bonus == splatter)
             score += 25;
-        if (game.bonus == defeat)
+        if (session->game.bonus == defeat)
             score += 30;
-        if (game.bonus == victory)
+        if (session->game.bonus == victory)
             score += 45;
     }
-    mxscor += 45;
+    session->mxscor += 45;
 
     /* Did he come to Witt's End as he should? */
-    if (game.place[MAGAZINE] == LOC_WITTSEND)
+    if (session->game.place[MAGAZINE] == LOC_WITTSEND)
         score += 1;
-    mxscor += 1;
+    session->mxscor += 1;
 
     /* Round it off. */
     score += 2;
-    mxscor += 2;
+    session->mxscor += 2;
 
     /* Deduct for hints/turns/saves. Hints < 4 are special; see database desc. */
     for (int i = 0; i < NHINTS; i++) {
-        if (game.hinted[i])
+        if (session->game.hinted[i])
             score = score - hints[i].penalty;
     }
-    if (game.novice)
+    if (session->game.novice)
         score -= 5;
-    if (game.clshnt)
+    if (session->game.clshnt)
         score -= 10;
-    score = score - game.trnluz - game.saved;
+    score = score - session->game.trnluz - session->game.saved;
+
+    return score;
+}
+
+/*  The running score.  session->derived.points is what the player has earned so
+ *  far, short of the 4 points for not quitting, which depend on how the
+ *  game ends.  It is the sum of what each object has earned, cached in
+ *  session->derived.earned[], and of the points for everything else, cached in
+ *  session->derived.flag_points.  hashed_set() calls rescore() whenever an
+ *  object's game.prop or game.place changes; whatever changes one of
+ *  the other inputs to the score must call rescore_flags(). */
+
+static int object_points(struct session_t* session, obj_t obj)
+/* What one object contributes to the score as things stand. */
+{
+    if (obj == MAGAZINE)
+        /* Did he come to Witt's End as he should? */
+        return (session->game.place[MAGAZINE] == LOC_WITTSEND) ? 1 : 0;
+    if (!object_treasure[obj] || objects[obj].inventory == 0)
+        return 0;
+
+    int points = 0;
+    if (session->game.prop[obj] > STATE_NOTFOUND)
+        points += 2;
+    if (session->game.place[obj] == LOC_BUILDING && session->game.prop[obj] == STATE_FOUND)
+        points += deposit_points[obj] - 2;
+    return points;
+}
+
+static long flag_points(struct session_t* session)
+/* What everything but the objects contributes to the score. */
+{
+    long points = (NDEATHS - session->game.numdie) * 10;
+    if (session->game.dflag != 0)
+        points += 25;
+    if (session->game.closng)
+        points += 25;
+    if (session->game.closed) {
+        if (session->game.bonus == none)
+            points += 10;
+        if (session->game.bonus == splatter)
+            points += 25;
+        if (session->game.bonus == defeat)
+            points += 30;
+        if (session->game.bonus == victory)
+            points += 45;
+    }
+    points += 2;
+    for (int i = 0; i < NHINTS; i++) {
+        if (session->game.hinted[i])
+            points -= hints[i].penalty;
+    }
+    if (session->game.novice)
+        points -= 5;
+    if (session->game.clshnt)
+        points -= 10;
+    return points - session->game.trnluz - session->game.saved;
+}
+
+void rescore(struct session_t* session, obj_t obj)
+/* Bring the running score up to date after obj has changed. */
+{
+    if (obj < 1 || obj > NOBJECTS)
+        return;
+    int points = object_points(session, obj);
+    session->derived.points += points - session->derived.earned[obj];
+    session->derived.earned[obj] = points;
+}
+
+void rescore_flags(struct session_t* session)
+/* Bring the running score up to date after anything but an object
+ * has changed. */
+{
+    long points = flag_points(session);
+    session->derived.points += points - session->derived.flag_points;
+    session->derived.flag_points = points;
+}
+
+void score_init(struct session_t* session)
+/* Start the running score over from the whole game state, as after
+ * initialization or a restore. */
+{
+    session->derived.points = 0;
+    for (obj_t obj = 0; obj <= NOBJECTS; obj++) {
+        session->derived.earned[obj] = object_points(session, obj);
+        session->derived.points += session->derived.earned[obj];
+    }
+    session->derived.flag_points = flag_points(session);
+    session->derived.points += session->derived.flag_points;
+    (void)rescan(session, quitgame);	/* for session->mxscor */
+}
+
+long score(struct session_t* session, enum termination mode)
+/* mode is 'scoregame' if scoring, 'quitgame' if quitting, 'endgame' if died
+ * or won */
+{
+    long score = session->derived.points;
+    if (mode == endgame)
+        score += 4;
+
+#ifdef SCORE_CHECK
+    if (score != rescan(session, mode))
+        BUG(RUNNING_SCORE_DIVERGED_FROM_RESCAN); // LCOV_EXCL_LINE
+#endif
 
     /* Return to score command if that's where we came from. */
     if (mode == scoregame) {
-        rspeak(GARNERED_POINTS, score, mxscor, game.turns, game.turns);
+        rspeak(session, GARNERED_POINTS, score, session->mxscor, session->game.turns, session->game.turns);
     }
 
     return score;
 }
 
-void terminate(enum termination mode)
+void terminate(struct session_t* session, enum termination mode)
 /* End of game.  Let's tell him all about it. */
 {
-    long points = score(mode);
+    long points = score(session, mode);
 
-    if (points + game.trnluz + 1 >= mxscor && game.trnluz != 0)
-        rspeak(TOOK_LONG);
-    if (points + game.saved + 1 >= mxscor && game.saved != 0)
-        rspeak(WITHOUT_SUSPENDS);
-    rspeak(TOTAL_SCORE, points, mxscor, game.turns, game.turns);
+    if (points + session->game.trnluz + 1 >= session->mxscor && session->game.trnluz != 0)
+        rspeak(session, TOOK_LONG);
+    if (points + session->game.saved + 1 >= session->mxscor && session->game.saved != 0)
+        rspeak(session, WITHOUT_SUSPENDS);
+    rspeak(session, TOTAL_SCORE, points, session->mxscor, session->game.turns, session->game.turns);
     for (int i = 1; i <= (long)NCLASSES; i++) {
         if (classes[i].threshold >= points) {
-            speak(classes[i].message);
+            speak(session, classes[i].message);
             i = classes[i].threshold + 1 - points;
-            rspeak(NEXT_HIGHER, i, i);
-            exit(EXIT_SUCCESS);
+            rspeak(session, NEXT_HIGHER, i, i);
+            session_end(session, EXIT_SUCCESS);
         }
     }
-    rspeak(OFF_SCALE);
-    rspeak(NO_HIGHER);
-    exit(EXIT_SUCCESS);
+    rspeak(session, OFF_SCALE);
+    rspeak(session, NO_HIGHER);
+    session_end(session, EXIT_SUCCESS);
 }
 
 /* end */
@@ -1,9 +1,22 @@
 #include "{h_file}"
 
-const char* arbitrary_messages[] = {{
+const char dungeon_strings[] =
+{dungeon_strings};
+
+const msgop_t message_ops[] = {{
+{message_ops}
+}};
+
+const uint32_t dungeon_lists[] = {{{dungeon_lists}}};
+
+const string_t arbitrary_messages[] = {{
 {arbitrary_messages}
 }};
 
+const msgops_t arbitrary_message_ops[] = {{
+{arbitrary_message_ops}
+}};
+
 const class_t classes[] = {{
 {classes}
 }};
@@ -20,6 +33,35 @@ const object_t objects[] = {{
 {objects}
 }};
 
+/* Per-object and per-location data that the game tests every turn,
+ * kept apart from the descriptive records so that scanning it does
+ * not drag their string references through the cache.
+ */
+const short object_plac[] = {{
+{object_plac}}};
+
+const short object_fixd[] = {{
+{object_fixd}}};
+
+const bool object_treasure[] = {{
+{object_treasure}}};
+
+const short location_sound[] = {{
+{location_sound}}};
+
+const bool location_loud[] = {{
+{location_loud}}};
+
+/* Every treasure, in object order */
+const short treasures[] = {{
+{treasures}}};
+
+const uint64_t treasure_set[OBJWORDS] = {{{treasure_set}}};
+
+/* What each object is worth in the building, 0 if not a treasure */
+const short deposit_points[] = {{
+{deposit_points}}};
+
 const obituary_t obituaries[] = {{
 {obituaries}
 }};
@@ -28,10 +70,14 @@ const hint_t hints[] = {{
 {hints}
 }};
 
-long conditions[] = {{
+const long conditions[] = {{
 {conditions}
 }};
 
+/* The hints that can come due at each location, bit n for hint n */
+const uint32_t location_hints[] = {{
+{location_hints}}};
+
 const motion_t motions[] = {{
 {motions}
 }};
@@ -46,6 +92,20 @@ const travelop_t travel[] = {{
 {travel}
 }};
 
-const char *ignore = "{ignore}";
+const unsigned char travel_index[][NMOTIONS] = {{
+{travel_index}
+}};
+
+const long forced_dest[] = {{{forced_dest}}};
+
+const dwarfmoves_t dwarf_moves[] = {{
+{dwarf_moves}
+}};
+
+const vocab_entry_t vocabulary[] = {{
+{vocab_slots}
+}};
+
+const unsigned short vocab_displace[] = {{{vocab_displace}}};
 
 /* end */
\ No newline at end of file
@@ -3,6 +3,7 @@
 
 #include <stdio.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 #define SILENT	-1	/* no sound */
 
@@ -29,55 +30,79 @@
 #define COND_HOGRE	19	/* Trying to deal with ogre */
 #define COND_HJADE	20	/* Found all treasures except jade */
 
+/* All dungeon text lives in one pool, dungeon_strings[], and the
+ * tables refer to it, to message_ops[] and to dungeon_lists[] by
+ * 32-bit offset rather than by pointer.  That way the generated data
+ * needs no load-time relocations and stays in shared read-only pages.
+ * Offset 0 means no string, or no op list.
+ */
+typedef uint32_t string_t;	/* offset in dungeon_strings[] */
+typedef uint32_t msgops_t;	/* index in message_ops[] */
+typedef uint32_t list_t;	/* index in dungeon_lists[] */
+
+#define STRING(s)	((s) != 0 ? dungeon_strings + (s) : NULL)
+#define MSGOPS(o)	((o) != 0 ? message_ops + (o) : NULL)
+#define LIST(l, i)	(dungeon_lists[(l) + (i)])
+
 typedef struct {{
-  const char** strs;
+  const list_t strs;
   const int n;
 }} string_group_t;
 
+/* Messages are split by the dungeon compiler into op lists so the
+ * renderer never has to scan them.  Each op accounts for len bytes of
+ * the message text; the list is terminated by MSG_END.
+ */
+enum msgop_kind_t {{MSG_END, MSG_TEXT, MSG_INT, MSG_STR, MSG_PLURAL, MSG_VERSION, MSG_FLOOR, MSG_SKIP}};
+
+typedef struct {{
+  const unsigned char kind;
+  const unsigned short len;
+}} msgop_t;
+
 typedef struct {{
   const string_group_t words;
-  const char* inventory;
-  int plac, fixd;
-  bool is_treasure;
-  const char** descriptions;
-  const char** sounds;
-  const char** texts;
-  const char** changes;
+  const string_t inventory;
+  const list_t descriptions;
+  const list_t description_ops;
+  const list_t sounds;
+  const list_t texts;
+  const list_t changes;
 }} object_t;
 
 typedef struct {{
-  const char* small;
-  const char* big;
+  const string_t small;
+  const string_t big;
+  const msgops_t small_ops;
+  const msgops_t big_ops;
 }} descriptions_t;
 
 typedef struct {{
   descriptions_t description;
-  const long sound;
-  const bool loud;
 }} location_t;
 
 typedef struct {{
-  const char* query;
-  const char* yes_response;
+  const string_t query;
+  const string_t yes_response;
 }} obituary_t;
 
 typedef struct {{
   const int threshold;
   const int point_loss;
-  const char* message;
+  const string_t message;
 }} turn_threshold_t;
 
 typedef struct {{
   const int threshold;
-  const char* message;
+  const string_t message;
 }} class_t;
 
 typedef struct {{
   const int number;
   const int turns;
   const int penalty;
-  const char* question;
-  const char* hint;
+  const string_t question;
+  const string_t hint;
 }} hint_t;
 
 typedef struct {{
@@ -86,47 +111,107 @@ typedef struct {{
 
 typedef struct {{
   const string_group_t words;
-  const char* message;
+  const string_t message;
   const bool noaction;
 }} action_t;
 
 enum condtype_t {{cond_goto, cond_pct, cond_carry, cond_with, cond_not}};
 enum desttype_t {{dest_goto, dest_special, dest_speak}};
 
+/* Travel rules are packed into 8 bytes so that the whole table stays
+ * cache-resident; the generator checks every value fits its field.
+ * Use the T_* accessors below rather than the members.
+ */
+#define TF_NODWARVES	0x01
+#define TF_STOP		0x02
+
 typedef struct {{
-  const long motion;
-  const long condtype;
-  const long condarg1;
-  const long condarg2;
-  const enum desttype_t desttype;
-  const long destval;
-  const bool nodwarves;
-  const bool stop;
+  const uint16_t destval;
+  const uint8_t motion;
+  const uint8_t condtype;
+  const uint8_t condarg1;
+  const uint8_t condarg2;
+  const uint8_t desttype;
+  const uint8_t flags;
 }} travelop_t;
 
+/* Where a wandering dwarf may go from a location; both lists end with
+ * LOC_NOWHERE.  newloc is the destination of the location's last
+ * travel entry, which is what dwarf movement has always left behind
+ * in game.newloc.
+ */
+typedef struct {{
+  const list_t dwarves;
+  const list_t pirate;
+  const long newloc;
+}} dwarfmoves_t;
+
+typedef enum {{NO_WORD_TYPE, MOTION, OBJECT, ACTION, NUMERIC}} word_type_t;
+
+typedef struct {{
+  const word_type_t type;
+  const long id;
+}} vocab_match_t;
+
+/* One slot of the perfect-hash vocabulary index.  The key is the
+ * lowercased first TOKLEN characters of a word packed little-endian;
+ * match[0] is what the word means normally, match[1] in oldstyle mode.
+ * Empty slots have key 0, which no nonempty word can produce.
+ */
+typedef struct {{
+  const uint64_t key;
+  const vocab_match_t match[2];
+}} vocab_entry_t;
+
 /* Abstract out the encoding of words in the travel array.  Gives us
  * some hope of getting to a less cryptic representation than we
  * inherited from FORTRAN, someday. To understand these, read the
  * encoding description for travel.
  */
 #define T_TERMINATE(entry)	((entry).motion == 1)
+#define T_MOTION(entry)		((long)(entry).motion)
+#define T_CONDTYPE(entry)	((enum condtype_t)(entry).condtype)
+#define T_CONDARG1(entry)	((long)(entry).condarg1)
+#define T_CONDARG2(entry)	((long)(entry).condarg2)
+#define T_DESTTYPE(entry)	((enum desttype_t)(entry).desttype)
+#define T_DESTVAL(entry)	((long)(entry).destval)
+#define T_NODWARVES(entry)	(((entry).flags & TF_NODWARVES) != 0)
+#define T_STOP(entry)		(((entry).flags & TF_STOP) != 0)
 
+extern const char dungeon_strings[];
+extern const msgop_t message_ops[];
+extern const uint32_t dungeon_lists[];
 extern const location_t locations[];
 extern const object_t objects[];
-extern const char* arbitrary_messages[];
+extern const short object_plac[];
+extern const short object_fixd[];
+extern const bool object_treasure[];
+extern const short location_sound[];
+extern const bool location_loud[];
+extern const short treasures[];
+extern const uint64_t treasure_set[];
+extern const short deposit_points[];
+extern const string_t arbitrary_messages[];
+extern const msgops_t arbitrary_message_ops[];
 extern const class_t classes[];
 extern const turn_threshold_t turn_thresholds[];
 extern const obituary_t obituaries[];
 extern const hint_t hints[];
-extern long conditions[];
+extern const long conditions[];
+extern const uint32_t location_hints[];
 extern const motion_t motions[];
 extern const action_t actions[];
 extern const travelop_t travel[];
 extern const long tkey[];
-extern const char *ignore;
+extern const dwarfmoves_t dwarf_moves[];
+extern const long forced_dest[];
+extern const vocab_entry_t vocabulary[];
+extern const unsigned short vocab_displace[];
 
 #define NLOCATIONS	{num_locations}
 #define NOBJECTS	{num_objects}
+#define NTREASURES	{num_treasures}
+#define OBJWORDS	((NOBJECTS + 64) / 64)	// words in an object bitset
 #define NHINTS		{num_hints}
 #define NCLASSES	{num_classes}
 #define NDEATHS		{num_deaths}
@@ -135,9 +220,16 @@ extern const char *ignore;
 #define NACTIONS  	{num_actions}
 #define NTRAVEL		{num_travel}
 #define NKEYS		{num_keys}
+#define NVOCABSLOTS	{num_vocab_slots}
+#define NVOCABBUCKETS	{num_vocab_buckets}
 
 #define BIRD_ENDSTATE {bird_endstate}
 
+/* travel_index[loc][motion] is 1 + the offset from tkey[loc] of the
+ * travel entry that motion starts from at loc, or 0 if it leads
+ * nowhere.  Built by the dungeon compiler so movement needn't scan. */
+extern const unsigned char travel_index[][NMOTIONS];
+
 enum arbitrary_messages_refs {{
 {arbitrary_messages}
 }};
@@ -0,0 +1,183 @@
+/*
+ * Exercise the session interface a host program sees: stepping a game,
+ * snapshots, the undo journal, the state hash and cloning.  Prints
+ * nothing and exits 0 when everything holds.
+ *
+ * SPDX-License-Identifier: BSD-2-clause
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/uio.h>
+#include "advent.h"
+#include "dungeon.h"
+
+static int failures;
+
+#define CHECK(COND) check(COND, #COND, __LINE__)
+
+static void check(bool cond, const char* what, int line)
+{
+    if (!cond) {
+        fprintf(stderr, "sessioncheck:%d: %s failed\n", line, what);
+        ++failures;
+    }
+}
+
+static int writes;
+
+ssize_t writev(int fd, const struct iovec* iov, int iovcnt)
+/* Stands in for the C library's, so the output sink's calls can be
+ * counted. */
+{
+    ++writes;
+    ssize_t total = 0;
+    for (int i = 0; i < iovcnt; i++) {
+        ssize_t n = write(fd, iov[i].iov_base, iov[i].iov_len);
+        if (n < 0)
+            return total > 0 ? total : n;
+        total += n;
+        if ((size_t)n < iov[i].iov_len)
+            break;
+    }
+    return total;
+}
+
+static char* scripted(struct session_t* session, const char* prompt)
+/* Input routine: the next line of the script the session was given. */
+{
+    (void)prompt;
+    const char** script = session->settings.host;
+    if (**script == '\0')
+        return NULL;
+    size_t len = strcspn(*script, "\n");
+    char* line = strndup(*script, len);
+    *script += len + ((*script)[len] != '\0');
+    return line;
+}
+
+static bool same_game(const struct game_t* a, const struct game_t* b)
+{
+    return memcmp(a, b, sizeof(struct game_t)) == 0;
+}
+
+static void step(struct session_t* s, int commands)
+{
+    while (commands-- > 0)
+        CHECK(play_step(s));
+}
+
+int main(void)
+{
+    struct session_t* session = session_new();
+    session->seed = 1;
+    session->settings.outfd = open("/dev/null", O_WRONLY);
+    session->settings.input = scripted;
+    const char* script =
+        "no\n"
+        "in\ntake lamp\ntake keys\ninventory\nout\n"
+        "drop keys\ndrop lamp\ntake\n"
+        "look\ntake keys\ntake lamp\n"
+        "keys\ntake lamp\n"
+        "in\ninventory\ntake\nfood\nbottle\n"
+        "out\nwest\n";
+    session->settings.host = &script;
+
+    CHECK(play_begin(session, NULL));
+    step(session, 5);
+    CHECK(session->game.loc == LOC_START);
+    CHECK(TOTING(LAMP) && TOTING(KEYS));
+
+    /* A snapshot puts back the game and its hash, whatever came after,
+     * and the verb that was left waiting for an object */
+    step(session, 3);		/* drop keys, drop lamp, take */
+    struct snapshot_t snap;
+    snapshot_take(session, &snap);
+    uint64_t before = game_hash(session, false);
+    step(session, 3);
+    CHECK(TOTING(LAMP) && TOTING(KEYS));
+    CHECK(game_hash(session, false) != before);
+    snapshot_restore(session, &snap);
+    CHECK(game_hash(session, false) == before);
+    CHECK(session->derived.hash == snap.derived.hash);
+    CHECK(same_game(&session->game, &snap.state));
+    step(session, 1);		/* keys */
+    CHECK(TOTING(KEYS) && !TOTING(LAMP));
+    step(session, 1);		/* take lamp */
+    snapshot_free(&snap);
+
+    /* Undo takes back one command at a time, even ones that don't move
+     * the player, and redo puts each back exactly */
+    step(session, 1);		/* in */
+    journal_start(session);
+    struct game_t start = session->game;
+    step(session, 1);		/* inventory */
+    struct game_t middle = session->game;
+    step(session, 1);		/* take, with two things here to take */
+    struct game_t pending = session->game;
+    step(session, 1);		/* food */
+    struct game_t end = session->game;
+    CHECK(TOTING(FOOD));
+    CHECK(journal_undo(session));
+    CHECK(same_game(&session->game, &pending));
+    CHECK(!TOTING(FOOD));
+    CHECK(journal_undo(session));
+    CHECK(same_game(&session->game, &middle));
+    CHECK(journal_undo(session));
+    CHECK(same_game(&session->game, &start));
+    CHECK(!journal_undo(session));
+    CHECK(journal_redo(session));
+    CHECK(journal_redo(session));
+    CHECK(journal_redo(session));
+    CHECK(!journal_redo(session));
+    CHECK(same_game(&session->game, &end));
+
+    /* Undoing back to a verb left waiting for its object leaves it
+     * waiting, so the next command can finish it another way */
+    CHECK(journal_undo(session));
+    step(session, 1);		/* bottle */
+    CHECK(TOTING(BOTTLE) && !TOTING(FOOD));
+    CHECK(!journal_redo(session));
+    end = session->game;
+
+    /* The running hash is still what a fresh count makes it */
+    uint64_t hash = session->derived.hash;
+    hash_init(session);
+    CHECK(session->derived.hash == hash);
+
+    /* A clone goes its own way and leaves the original alone */
+    struct session_t* clone = session_clone(session);
+    const char* other = "drop lamp\nquit\nyes\n";
+    clone->settings.host = &other;
+    CHECK(play_step(clone));
+    CHECK(clone->game.place[LAMP] != CARRIED);
+    CHECK(TOTING(LAMP));
+    CHECK(same_game(&session->game, &end));
+    CHECK(play_on(clone) == EXIT_SUCCESS);
+    CHECK(clone->over && !session->over);
+    session_free(clone);
+
+    /* However much a turn says, it goes out in one write; five
+     * hundred short messages take a thousand iovecs, newlines and all */
+    writes = 0;
+    for (int i = 0; i < 500; i++)
+        rspeak(session, OK_MAN);
+    output_flush(session);
+    CHECK(writes == 1);
+
+    /* The original plays on from where it stood */
+    step(session, 2);
+    CHECK(session->game.loc != LOC_START);
+    CHECK(!play_step(session));
+    CHECK(session->over);
+
+    close(session->settings.outfd);
+    session_free(session);
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+/* end */